@@ -0,0 +1,98 @@
+#include "sheepshead/interface/hand.h"
+#include "learning/double_dummy_solver.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+
+/*
+ * Deal hands, make the picking round decisions at random, and solve the trick
+ * play of each hand that has a picker with every card visible. Reports the
+ * solved points and reward band for each hand and the average time and nodes
+ * per solve, optionally using a transposition table of the given size and an
+ * endgame tablebase file.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 2) {
+    std::cerr << "Usage: double_dummy_analysis <game_seed> [hands] [table_megabytes] "
+              << "[tablebase_file]" << std::endl;
+    exit(1);
+  }
+
+  unsigned long seed = strtoul(argv[1], NULL, 0);
+  int number_of_hands = argc > 2 ? atoi(argv[2]) : 10;
+  int table_megabytes = argc > 3 ? atoi(argv[3]) : 0;
+
+  std::unique_ptr<learning::TranspositionTable> table;
+  if(table_megabytes > 0) table.reset(new learning::TranspositionTable(table_megabytes));
+  learning::DoubleDummySolver solver(table.get());
+
+  std::unique_ptr<learning::Tablebase> tablebase;
+  if(argc > 4) {
+    tablebase.reset(new learning::Tablebase(argv[4]));
+    if(!tablebase->is_open()) {
+      std::cerr << "Couldn't open tablebase " << argv[4] << std::endl;
+      exit(1);
+    }
+    solver.set_tablebase(tablebase.get());
+  }
+  std::default_random_engine generator(seed);
+
+  int solved_hands = 0;
+  long long total_nodes = 0;
+  long long total_band_nodes = 0;
+  std::chrono::duration<double> solve_time(0);
+  std::chrono::duration<double> band_time(0);
+
+  for(int hand_number = 0; hand_number < number_of_hands; hand_number++) {
+    auto hand = sheepshead::interface::Hand(seed + hand_number);
+
+    while(!hand.history().picking_round().is_finished()) {
+      if(hand.is_arbitrable()) {
+        hand.arbiter().arbitrate();
+        continue;
+      }
+      auto current_player = hand.current_player();
+      auto available_plays = hand.available_plays(current_player);
+      std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+      hand.playmaker(current_player).make_play(available_plays[distribution(generator)]);
+    }
+
+    auto position = learning::TrickPosition(hand);
+    if(position.is_leasters()) continue;
+
+    if(table) table->new_search();
+    auto start = std::chrono::steady_clock::now();
+    auto result = solver.solve(position);
+    solve_time += std::chrono::steady_clock::now() - start;
+    solved_hands++;
+    total_nodes += result.nodes;
+
+    // The band alone is what the rewards depend on
+    if(table) table->new_search();
+    start = std::chrono::steady_clock::now();
+    int band = solver.solve_band(position);
+    band_time += std::chrono::steady_clock::now() - start;
+    total_band_nodes += solver.nodes();
+
+    std::cout << "Hand " << hand_number << ": picking team "
+              << result.picking_team_points << ", defenders "
+              << result.defending_team_points << ", lead "
+              << learning::card_debug_string(result.best_card) << ", "
+              << result.nodes << " nodes; band " << band << ", "
+              << solver.nodes() << " nodes" << std::endl;
+  }
+
+  if(solved_hands > 0) {
+    std::cout << "Solved " << solved_hands << " hands. Mean time per solve: "
+              << 1000 * solve_time.count() / solved_hands << " ms, mean nodes: "
+              << total_nodes / solved_hands << std::endl;
+    std::cout << "Mean time per band solve: "
+              << 1000 * band_time.count() / solved_hands << " ms, mean nodes: "
+              << total_band_nodes / solved_hands << std::endl;
+  }
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
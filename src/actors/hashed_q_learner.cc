@@ -0,0 +1,48 @@
+#include "learning/hashed_q_function.h"
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Learn action values for every decision in a hand, picking through the
+ * last trick, by playing hands epsilon-greedily and updating each play made
+ * towards its player's reward. The values are keyed by the default state
+ * features in a table of bounded size. Reports how full the table is and
+ * how fast hands are played.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 2) {
+    std::cerr << "Usage: hashed_q_learner <hands> [megabytes] [seed]" << std::endl;
+    exit(1);
+  }
+
+  long long number_of_hands = strtoll(argv[1], NULL, 0);
+  size_t megabytes = argc > 2 ? strtoul(argv[2], NULL, 0) : 64;
+  unsigned long seed = argc > 3 ? strtoul(argv[3], NULL, 0) : 1;
+  const float exploration = 0.1;
+  const long long report_interval = 10000;
+
+  learning::HashedQFunction q_function(megabytes);
+  std::default_random_engine generator(seed);
+  long long decisions = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  auto report = [&](long long hands) {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const auto& table = q_function.table();
+    std::cout << hands << " hands, " << decisions << " plays, "
+              << hands / elapsed.count() << " hands/s; table holds "
+              << table.size() << " of " << table.capacity() << " values, "
+              << table.evictions() << " evicted" << std::endl;
+  };
+
+  for(long long iter = 0; iter < number_of_hands; iter++) {
+    auto hand = sheepshead::interface::Hand(seed + iter);
+    decisions += learning::learn_from_hand(&q_function, &hand, exploration, generator);
+    if((iter + 1) % report_interval == 0) report(iter + 1);
+  }
+  report(number_of_hands);
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
@@ -0,0 +1,63 @@
+#include "learning/q_trainer.h"
+
+#include <iostream>
+
+/*
+ * Train the same pick/pass QFunction as simple_q_learner, with every thread
+ * learning into one table at once. At each snapshot the table is printed
+ * along with the first player's mean reward when picking greedily by it,
+ * over a fixed set of hands, and the throughput so far. Hands for training
+ * and evaluation are dealt independently, or antithetic or rotated in
+ * groups, as in DealStream.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 3) {
+    std::cerr << "Usage: hogwild_q_learner <threads> <hands> [snapshot_interval] [seed] "
+              << "[independent|antithetic|rotated]" << std::endl;
+    exit(1);
+  }
+
+  learning::QTrainerConfig config;
+  config.number_of_threads = atoi(argv[1]);
+  config.number_of_hands = strtoll(argv[2], NULL, 0);
+  if(argc > 3) config.snapshot_interval = strtoll(argv[3], NULL, 0);
+  config.seed = argc > 4 ? strtoul(argv[4], NULL, 0) : 1;
+  if(config.number_of_threads < 1) {
+    std::cerr << "threads must be at least 1" << std::endl;
+    exit(1);
+  }
+  if(argc > 5 && !learning::parse_deal_scheme(argv[5], &config.deal_scheme)) {
+    std::cerr << "Unknown deal scheme " << argv[5] << std::endl;
+    exit(1);
+  }
+
+  const int evaluation_hands = 2000;
+  const unsigned long evaluation_seed = 12345;
+
+  auto print_progress = [](const learning::QTrainerProgress& progress) {
+    std::cout << progress.hands << " hands in " << progress.seconds << " s, "
+              << progress.hands_per_second << " hands/s" << std::endl;
+  };
+
+  learning::QFunction q_function;
+  auto progress = learning::train_q_function(&q_function, config,
+      [&](const learning::QFunction& snapshot, const learning::QTrainerProgress& progress) {
+        print_progress(progress);
+        std::cout << snapshot.debug_string() << std::endl;
+        std::cout << "Greedy pick reward: "
+                  << learning::greedy_pick_reward(snapshot, evaluation_hands, evaluation_seed,
+                                                  config.deal_scheme)
+                  << std::endl;
+      });
+
+  std::cout << "Finished on " << config.number_of_threads << " threads: ";
+  print_progress(progress);
+  std::cout << q_function.debug_string() << std::endl;
+  std::cout << "Greedy pick reward: "
+            << learning::greedy_pick_reward(q_function, evaluation_hands, evaluation_seed,
+                                            config.deal_scheme)
+            << std::endl;
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
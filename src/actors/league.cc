@@ -0,0 +1,98 @@
+#include "learning/league.h"
+#include "learning/tournament.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace {
+
+void print_population(const learning::League& league)
+{
+  for(int index = 0; index < league.population_size(); index++) {
+    auto& member = league.member(index);
+    std::cout << "  " << std::left << std::setw(14) << member.name << std::right
+              << std::setprecision(1) << std::setw(8) << member.rating
+              << std::setw(8) << member.matches << " matches" << std::endl;
+  }
+}
+
+} // namespace
+
+/*
+ * Train linear learners by self-play against a league of their own frozen
+ * snapshots, with the random and heuristic policies as fixed members,
+ * drawing opponents by prioritized fictitious self-play or as asked. Each
+ * round's results and ratings are printed, the population after every
+ * snapshot, and at the end the first learner plays a duplicate tournament
+ * against the fixed members.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 4) {
+    std::cerr << "Usage: league <rounds> <players> <seed> [learners] [hard|variance|uniform]"
+              << std::endl;
+    exit(1);
+  }
+  int rounds = atoi(argv[1]);
+  int number_of_players = atoi(argv[2]);
+  learning::LeagueConfig config;
+  config.seed = strtoul(argv[3], NULL, 0);
+  if(argc > 4) config.number_of_learners = atoi(argv[4]);
+  if(argc > 5) {
+    std::string matchmaking = argv[5];
+    if(matchmaking == "hard") {
+      config.matchmaking = learning::Matchmaking::HARD;
+    } else if(matchmaking == "variance") {
+      config.matchmaking = learning::Matchmaking::VARIANCE;
+    } else if(matchmaking == "uniform") {
+      config.matchmaking = learning::Matchmaking::UNIFORM;
+    } else {
+      std::cerr << "Unknown matchmaking " << matchmaking << std::endl;
+      exit(1);
+    }
+  }
+  if(number_of_players < 3 || number_of_players > 5 || config.number_of_learners < 1) {
+    std::cerr << "Players must be 3 to 5, with at least one learner" << std::endl;
+    exit(1);
+  }
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(number_of_players);
+  auto rules = mutable_rules.get_rules();
+
+  learning::RandomPolicy random;
+  learning::HeuristicPolicy heuristic;
+  learning::League league(rules, config);
+  league.add_fixed_member("random", &random);
+  league.add_fixed_member("heuristic", &heuristic);
+
+  std::cout << std::fixed;
+  for(int round = 0; round < rounds; round++) {
+    auto stats = league.play_round();
+    std::cout << "Round " << stats.round << ": " << stats.hands << " hands in "
+              << std::setprecision(2) << stats.seconds << " s, reward "
+              << std::setprecision(3) << stats.learner_reward << ", score "
+              << stats.learner_score << ", ratings";
+    for(int learner = 0; learner < config.number_of_learners; learner++) {
+      std::cout << " " << std::setprecision(1) << league.learner_rating(learner);
+    }
+    std::cout << std::endl;
+    if(stats.spawned > 0) print_population(league);
+  }
+
+  learning::LinearQPolicy greedy(&league.learner(0));
+  learning::TournamentConfig tournament;
+  tournament.deals = 200;
+  tournament.seed = config.seed;
+  auto result = learning::run_tournament(rules, {&heuristic, &greedy, &random}, tournament);
+  std::cout << "Against the heuristic policy over " << result.deals << " deals:" << std::endl;
+  const char* names[] = {"learner0", "random"};
+  for(int c = 1; c < 3; c++) {
+    auto& versus = result.competitors[c].versus_first;
+    std::cout << "  " << std::left << std::setw(10) << names[c - 1] << std::right
+              << std::setprecision(3) << std::setw(7) << versus.mean << " ["
+              << versus.lower << ", " << versus.upper << "]" << std::endl;
+  }
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
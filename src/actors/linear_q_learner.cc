@@ -0,0 +1,68 @@
+#include "learning/linear_q_function.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+/*
+ * Learn a LinearQFunction with TD(lambda) from hands played by the heuristic
+ * policy, then measure how fast it evaluates every trick card a player could
+ * lay, over the trick decisions it learned from.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 2) {
+    std::cerr << "Usage: linear_q_learner <hands> [lambda] [learning_rate] [seed]" << std::endl;
+    exit(1);
+  }
+
+  int number_of_hands = atoi(argv[1]);
+  float lambda = argc > 2 ? atof(argv[2]) : 0.8;
+  float learning_rate = argc > 3 ? atof(argv[3]) : 0.05;
+  unsigned long seed = argc > 4 ? strtoul(argv[4], NULL, 0) : 1;
+
+  learning::HeuristicPolicy policy;
+  learning::LinearQFunction q_function(learning_rate);
+  std::default_random_engine generator(seed);
+  std::vector<learning::ExperienceRecord> trick_records;
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<learning::ExperienceRecord> records;
+  for(int n = 0; n < number_of_hands; n++) {
+    records.clear();
+    auto hand = sheepshead::interface::Hand(seed + n);
+    learning::record_hand(policy, &hand, generator, &records);
+    q_function.learn_hand(records.data(), records.size(), lambda);
+    for(auto& record : records) {
+      if(record.observation.leader >= 0) trick_records.push_back(record);
+    }
+  }
+  std::chrono::duration<double> learning_time = std::chrono::steady_clock::now() - start;
+  std::cout << "Learned from " << number_of_hands << " hands in " << learning_time.count()
+            << " s" << std::endl;
+  if(trick_records.empty()) return 0;
+
+  // Evaluate all 32 card slots of each trick decision, as a policy would.
+  const int passes = 20;
+  auto segment = learning::LinearQFunction::segment(
+      sheepshead::interface::Play::PlayType::TRICK_CARD);
+  float values[learning::LinearQFunction::ACTION_SLOTS];
+  float checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for(int pass = 0; pass < passes; pass++) {
+    for(auto& record : trick_records) {
+      int active[learning::LinearQFunction::MAX_ACTIVE_FEATURES];
+      int number_active = learning::LinearQFunction::active_features(
+          record.observation, sheepshead::interface::Play::PlayType::TRICK_CARD, active);
+      q_function.evaluate_all(active, number_active, segment, values);
+      checksum += values[record.action.value];
+    }
+  }
+  std::chrono::duration<double> evaluation_time = std::chrono::steady_clock::now() - start;
+  double states = static_cast<double>(passes) * trick_records.size();
+  std::cout << "Evaluated " << states << " trick states, " << states / evaluation_time.count()
+            << " states/s and " << 32 * states / evaluation_time.count() << " actions/s"
+            << " (checksum " << checksum << ")" << std::endl;
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
@@ -0,0 +1,89 @@
+#include "sheepshead/interface/hand.h"
+#include "learning/mcts.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+/*
+ * Play hands where every trick card is chosen by Monte Carlo tree search and
+ * every picking round decision is random. Reports the average time taken per
+ * searched decision, so the parallelism settings can be compared. Playouts
+ * can finish with double-dummy play over a shared transposition table.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 4) {
+    std::cerr << "Usage: mcts_player <game_seed> <threads> <root|tree> "
+              << "[iterations] [hands] [solve_cards]" << std::endl;
+    exit(1);
+  }
+
+  unsigned long seed = strtoul(argv[1], NULL, 0);
+  learning::MctsConfig config;
+  config.number_of_threads = atoi(argv[2]);
+  config.parallelism = std::string(argv[3]) == "tree" ?
+                       learning::MctsConfig::Parallelism::TREE :
+                       learning::MctsConfig::Parallelism::ROOT;
+  if(argc > 4) config.iterations = atoi(argv[4]);
+  int number_of_hands = argc > 5 ? atoi(argv[5]) : 10;
+  config.seed = seed;
+
+  // Finishing playouts with the solver shares one table between the threads.
+  std::unique_ptr<learning::SharedTranspositionTable> table;
+  if(argc > 6) {
+    config.solve_cards = atoi(argv[6]);
+    table.reset(new learning::SharedTranspositionTable(64));
+    config.table = table.get();
+  }
+
+  learning::Mcts mcts(config);
+  std::default_random_engine generator(seed);
+
+  int searched_decisions = 0;
+  std::chrono::duration<double> search_time(0);
+
+  for(int hand_number = 0; hand_number < number_of_hands; hand_number++) {
+    auto hand = sheepshead::interface::Hand(seed + hand_number);
+
+    while(!hand.is_finished()) {
+      if(hand.is_arbitrable()) {
+        hand.arbiter().arbitrate();
+        continue;
+      }
+
+      auto current_player = hand.current_player();
+      auto available_plays = hand.available_plays(current_player);
+      if(available_plays[0].play_type() ==
+           sheepshead::interface::Play::PlayType::TRICK_CARD &&
+         available_plays.size() > 1) {
+        auto start = std::chrono::steady_clock::now();
+        auto play = mcts.choose_play(hand);
+        search_time += std::chrono::steady_clock::now() - start;
+        searched_decisions++;
+        hand.playmaker(current_player).make_play(play);
+      } else {
+        std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+        hand.playmaker(current_player).make_play(available_plays[distribution(generator)]);
+      }
+    }
+  }
+
+  std::cout << "Searched " << searched_decisions << " decisions with "
+            << config.number_of_threads << " threads, "
+            << config.iterations << " iterations each." << std::endl;
+  if(searched_decisions > 0) {
+    std::cout << "Mean time per decision: "
+              << 1000 * search_time.count() / searched_decisions << " ms" << std::endl;
+  }
+  if(table) {
+    auto stats = table->stats();
+    std::cout << "Table probes: " << stats.probes << ", hits: " << stats.hits
+              << ", stores: " << stats.stores << ", collisions: " << stats.collisions
+              << std::endl;
+  }
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
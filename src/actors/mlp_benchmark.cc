@@ -0,0 +1,93 @@
+#include "learning/mlp.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/*
+ * Measure how fast an Mlp evaluates batches of trick decisions. The network
+ * is read from a file exported by the trainer, or made up with random
+ * weights as 233-256-256-32 when no file is given.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 2) {
+    std::cerr << "Usage: mlp_benchmark <hands> [batch_size] [network_file]" << std::endl;
+    exit(1);
+  }
+
+  int number_of_hands = atoi(argv[1]);
+  int batch_size = argc > 2 ? atoi(argv[2]) : 256;
+
+  learning::Mlp mlp;
+  if(argc > 3) {
+    if(!mlp.load(argv[3])) {
+      std::cerr << "Can't read a network from " << argv[3] << std::endl;
+      exit(1);
+    }
+  } else {
+    std::default_random_engine generator(1);
+    std::normal_distribution<float> normal(0, 0.1);
+    int sizes[] = {learning::observation_input_size(), 256, 256, 32};
+    for(int i = 0; i < 3; i++) {
+      std::vector<float> weights(sizes[i] * sizes[i + 1]);
+      std::vector<float> bias(sizes[i + 1]);
+      for(auto& w : weights) w = normal(generator);
+      mlp.add_layer(sizes[i], sizes[i + 1],
+                    i < 2 ? learning::Activation::RELU : learning::Activation::NONE,
+                    weights.data(), bias.data());
+    }
+  }
+  if(mlp.input_size() != learning::observation_input_size()) {
+    std::cerr << "The network takes " << mlp.input_size() << " inputs, not "
+              << learning::observation_input_size() << std::endl;
+    exit(1);
+  }
+
+  // Encode the trick decisions of some hands as one long list of inputs.
+  learning::HeuristicPolicy policy;
+  std::default_random_engine generator(1);
+  std::vector<learning::ExperienceRecord> records;
+  for(int n = 0; n < number_of_hands; n++) {
+    auto hand = sheepshead::interface::Hand(n + 1);
+    learning::record_hand(policy, &hand, generator, &records);
+  }
+  int input_size = mlp.input_size();
+  std::vector<float> inputs;
+  for(auto& record : records) {
+    if(record.observation.leader < 0) continue;
+    inputs.resize(inputs.size() + input_size);
+    learning::encode_observation(record.observation,
+                                 sheepshead::interface::Play::PlayType::TRICK_CARD,
+                                 &inputs[inputs.size() - input_size]);
+  }
+  int states = inputs.size() / input_size;
+  if(states < batch_size) {
+    std::cerr << "Only " << states << " states for batches of " << batch_size << std::endl;
+    exit(1);
+  }
+
+  const int passes = 20;
+  int batches = states / batch_size;
+  std::vector<float> outputs(batch_size * mlp.output_size());
+  learning::Mlp::Workspace workspace;
+  float checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for(int pass = 0; pass < passes; pass++) {
+    for(int batch = 0; batch < batches; batch++) {
+      mlp.forward(&inputs[batch * batch_size * input_size], batch_size, outputs.data(),
+                  &workspace);
+      checksum += outputs[0];
+    }
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  double evaluations = static_cast<double>(passes) * batches * batch_size;
+  double flops = 2.0 * mlp.number_of_parameters() * evaluations;
+  std::cout << "Evaluated " << evaluations << " states in batches of " << batch_size << ", "
+            << evaluations / elapsed.count() << " states/s, "
+            << flops / elapsed.count() / 1e9 << " GFLOP/s (checksum " << checksum << ")"
+            << std::endl;
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
@@ -0,0 +1,66 @@
+#include "learning/pick_cfr.h"
+#include "learning/tournament.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/*
+ * Learn picking-round strategies with outcome-sampling MCCFR, playing the
+ * tricks with the heuristic policy, and print the exploitability estimates
+ * as training goes. The regrets and strategies are written to a file if one
+ * is given. At the end the learned picking plays a duplicate tournament
+ * against the heuristic picking it started from.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 4) {
+    std::cerr << "Usage: pick_cfr <iterations> <players> <seed> [output_file] "
+              << "[exploitability_interval]" << std::endl;
+    exit(1);
+  }
+  learning::PickCfrConfig config;
+  config.iterations = strtoll(argv[1], NULL, 0);
+  int number_of_players = atoi(argv[2]);
+  config.seed = strtoul(argv[3], NULL, 0);
+  std::string output_file = argc > 4 ? argv[4] : "";
+  if(argc > 5) config.exploitability_interval = strtoll(argv[5], NULL, 0);
+  if(number_of_players < 3 || number_of_players > 5) {
+    std::cerr << "Players must be 3 to 5" << std::endl;
+    exit(1);
+  }
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(number_of_players);
+  auto rules = mutable_rules.get_rules();
+
+  learning::HeuristicPolicy heuristic;
+  learning::PickCfr cfr(rules, &heuristic);
+  std::cout << std::fixed << std::setprecision(3);
+  auto progress = cfr.train(config,
+      [](const learning::PickCfr& cfr, const learning::PickCfrProgress& progress) {
+        std::cout << progress.iterations << " iterations in " << progress.seconds << " s, "
+                  << progress.iterations_per_second << " iterations/s, "
+                  << cfr.visited_information_sets() << " information sets, exploitability "
+                  << progress.exploitability << std::endl;
+      });
+  std::cout << "Finished " << progress.iterations << " iterations on "
+            << config.number_of_threads << " threads in " << progress.seconds << " s"
+            << std::endl;
+  if(!output_file.empty() && !cfr.save(output_file)) {
+    std::cerr << "Can't write " << output_file << std::endl;
+    exit(1);
+  }
+
+  learning::CfrPickPolicy learned(&cfr);
+  learning::TournamentConfig tournament;
+  tournament.deals = 200;
+  tournament.seed = config.seed;
+  auto result = learning::run_tournament(rules, {&heuristic, &learned}, tournament);
+  auto& versus = result.competitors[1].versus_first;
+  std::cout << "Against heuristic picking over " << result.deals << " deals: " << versus.mean
+            << " [" << versus.lower << ", " << versus.upper << "]" << std::endl;
+  auto& picker = result.competitors[1].roles[static_cast<int>(learning::SeatRole::PICKER)];
+  std::cout << "As picker " << picker.mean << " over " << picker.hands << " hands" << std::endl;
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
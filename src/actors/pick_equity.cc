@@ -0,0 +1,87 @@
+#include "sheepshead/interface/rules.h"
+#include "learning/pick_equity.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+/*
+ * Estimate whether a seat should pick with the cards it was dealt. The cards
+ * are given as a comma-separated list like QC,JD,AD,10H,9S,7C. Every possible
+ * blind, or a sample of them with four players, is dealt, with several random deals of the other seats for each, and
+ * each deal is played out both ways by the chosen policy: random, heuristic or
+ * solver. Reports the expected reward for picking and for passing, and their
+ * difference, with 95% confidence intervals.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 5) {
+    std::cerr << "Usage: pick_equity <random|heuristic|solver> <players> <seat> <cards> "
+              << "[deals_per_blind] [seed] [clubs]" << std::endl;
+    exit(1);
+  }
+
+  std::string policy_name = argv[1];
+  std::unique_ptr<learning::Policy> policy;
+  if(policy_name == "random") {
+    policy.reset(new learning::RandomPolicy());
+  } else if(policy_name == "heuristic") {
+    policy.reset(new learning::HeuristicPolicy());
+  } else if(policy_name == "solver") {
+    policy.reset(new learning::SolverPolicy());
+  } else {
+    std::cerr << "Unknown policy " << policy_name << std::endl;
+    exit(1);
+  }
+
+  int number_of_players = atoi(argv[2]);
+  int seat = atoi(argv[3]);
+  if(number_of_players < 3 || number_of_players > 5 || seat < 0 || seat >= number_of_players) {
+    std::cerr << "Players must be 3 to 5 and seat 0 to players - 1" << std::endl;
+    exit(1);
+  }
+
+  learning::CardMask dealt_cards = 0;
+  std::stringstream card_list(argv[4]);
+  std::string card_name;
+  while(std::getline(card_list, card_name, ',')) {
+    int card = learning::parse_card(card_name);
+    if(card == learning::NO_CARD) {
+      std::cerr << "Couldn't read card " << card_name << std::endl;
+      exit(1);
+    }
+    dealt_cards |= learning::card_bit(card);
+  }
+
+  learning::PickEquityConfig config;
+  if(argc > 5) config.deals_per_blind = atoi(argv[5]);
+  if(argc > 6) config.seed = strtoul(argv[6], NULL, 0);
+
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(number_of_players);
+  if(argc > 7 && std::string(argv[7]) == "clubs") mutable_rules.set_trump_is_clubs();
+  auto rules = mutable_rules.get_rules();
+
+  if(learning::mask_size(dealt_cards) != rules.number_of_cards_per_player()) {
+    std::cerr << "Expected " << rules.number_of_cards_per_player() << " distinct cards"
+              << std::endl;
+    exit(1);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto result = learning::estimate_pick_equity(rules, seat, dealt_cards, *policy, config);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << "Cards: " << learning::mask_debug_string(dealt_cards) << std::endl;
+  std::cout << "Deals: " << result.deals << " over " << result.strata
+            << (result.sampled_blinds ? " sampled" : "") << " blinds, "
+            << elapsed.count() << " s on " << config.number_of_threads << " threads"
+            << std::endl;
+  std::cout << "Pick: " << result.pick.mean << " +/- " << result.pick.half_width << std::endl;
+  std::cout << "Pass: " << result.pass.mean << " +/- " << result.pass.half_width << std::endl;
+  std::cout << "Pick - pass: " << result.difference.mean << " +/- "
+            << result.difference.half_width << std::endl;
+  return 0;
+}
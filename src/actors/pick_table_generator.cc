@@ -0,0 +1,79 @@
+#include "sheepshead/interface/rules.h"
+#include "learning/pick_table.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/*
+ * Generate a pick table file for one rule variation: estimate the value of
+ * picking over passing for every seat and every hand a seat can be dealt,
+ * up to relabeling the fail suits, with the chosen policy playing the deals.
+ * Each hand is played out against a sample of blinds, with several deals
+ * per blind so the estimate can use the variance within each blind. A
+ * single deal per blind is faster, but most of its pick and pass decisions
+ * are noise. A limit evaluates only the first hands, for trying settings
+ * out.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 4) {
+    std::cerr << "Usage: pick_table_generator <output_file> <players> "
+              << "<random|heuristic|solver> [blinds_per_hand] [deals_per_blind] [seed] "
+              << "[clubs] [limit]" << std::endl;
+    exit(1);
+  }
+
+  std::string output_path = argv[1];
+  int number_of_players = atoi(argv[2]);
+  if(number_of_players < 4 || number_of_players > 5) {
+    std::cerr << "Only four and five player hands can be tabulated" << std::endl;
+    exit(1);
+  }
+
+  std::string policy_name = argv[3];
+  std::unique_ptr<learning::Policy> policy;
+  if(policy_name == "random") {
+    policy.reset(new learning::RandomPolicy());
+  } else if(policy_name == "heuristic") {
+    policy.reset(new learning::HeuristicPolicy());
+  } else if(policy_name == "solver") {
+    policy.reset(new learning::SolverPolicy());
+  } else {
+    std::cerr << "Unknown policy " << policy_name << std::endl;
+    exit(1);
+  }
+
+  learning::PickEquityConfig config;
+  config.max_blinds = argc > 4 ? atoi(argv[4]) : 64;
+  if(argc > 5) config.deals_per_blind = atoi(argv[5]);
+  config.seed = argc > 6 ? strtoul(argv[6], NULL, 0) : 1;
+  bool trump_is_clubs = argc > 7 && std::string(argv[7]) == "clubs";
+  size_t limit = argc > 8 ? strtoul(argv[8], NULL, 0) : 0;
+
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(number_of_players);
+  if(trump_is_clubs) mutable_rules.set_trump_is_clubs();
+  auto rules = mutable_rules.get_rules();
+
+  auto hands = learning::canonical_hands(rules.number_of_cards_per_player(), trump_is_clubs);
+  if(limit > 0 && limit < hands.size()) hands.resize(limit);
+
+  learning::PickTableBuilder builder(rules);
+  auto start = std::chrono::steady_clock::now();
+  learning::generate_pick_table(rules, *policy, config, hands, &builder);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  if(!builder.write(output_path)) {
+    std::cerr << "Couldn't write " << output_path << std::endl;
+    exit(1);
+  }
+  std::cout << "Evaluated " << hands.size() << " hands for " << number_of_players
+            << " seats, " << builder.size() << " entries with relabelings, in "
+            << elapsed.count() << " s on " << config.number_of_threads << " threads, "
+            << config.deals_per_blind << " deals for each of up to " << config.max_blinds
+            << " blinds" << std::endl;
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
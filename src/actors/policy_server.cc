@@ -0,0 +1,206 @@
+#include "learning/hashed_q_function.h"
+#include "learning/linear_q_function.h"
+#include "learning/mlp.h"
+#include "learning/policy_server.h"
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+learning::PolicyServer* running_server = nullptr;
+
+void stop_server(int)
+{
+  if(running_server) running_server->stop();
+}
+
+void usage()
+{
+  std::cerr << "Usage: policy_server serve <socket> linear <training_hands> "
+            << "[max_batch] [max_wait_us]\n"
+            << "       policy_server serve <socket> mlp <network_file> [max_batch] [max_wait_us]\n"
+            << "       policy_server serve <socket> table <training_hands>\n"
+            << "       policy_server serve <socket> search <iterations>\n"
+            << "       policy_server bench <socket> <clients> <hands_per_client> [seed]"
+            << std::endl;
+  exit(1);
+}
+
+void print_stats(const learning::PolicyServerStats& stats)
+{
+  std::cout << stats.requests << " requests, latency p50 " << stats.p50_microseconds
+            << " us, p90 " << stats.p90_microseconds << " us, p99 " << stats.p99_microseconds
+            << " us, max " << stats.max_microseconds << " us";
+  if(stats.batches > 0) {
+    std::cout << "; " << stats.batches << " batches, " << 100 * stats.mean_fill << "% full";
+  }
+  std::cout << std::endl;
+}
+
+int serve(int argc, char* argv[])
+{
+  if(argc < 5) usage();
+  std::string socket_path = argv[2];
+  std::string model_name = argv[3];
+  learning::InferenceQueueConfig batching;
+  if(argc > 5) batching.max_batch_size = atoi(argv[5]);
+  if(argc > 6) batching.max_wait_microseconds = atoi(argv[6]);
+
+  learning::HeuristicPolicy heuristic;
+  std::default_random_engine generator(1);
+  learning::LinearQFunction linear(0.05);
+  learning::Mlp mlp;
+  std::unique_ptr<learning::HashedQFunction> hashed;
+  std::unique_ptr<learning::DecisionModel> model;
+  if(model_name == "linear") {
+    // Nothing is saved of a linear function, so learn one to serve.
+    std::vector<learning::ExperienceRecord> records;
+    for(int n = 0; n < atoi(argv[4]); n++) {
+      records.clear();
+      auto hand = sheepshead::interface::Hand(n + 1);
+      learning::record_hand(heuristic, &hand, generator, &records);
+      linear.learn_hand(records.data(), records.size(), 0.8);
+    }
+    model.reset(new learning::ValueModel(learning::linear_evaluator(&linear), batching));
+  } else if(model_name == "mlp") {
+    if(!mlp.load(argv[4])) {
+      std::cerr << "Can't read a network from " << argv[4] << std::endl;
+      return 1;
+    }
+    if(mlp.input_size() != learning::observation_input_size() ||
+       mlp.output_size() != learning::LinearQFunction::ACTION_SLOTS) {
+      std::cerr << "The network must take " << learning::observation_input_size()
+                << " inputs and give " << learning::LinearQFunction::ACTION_SLOTS
+                << " action slot values" << std::endl;
+      return 1;
+    }
+    model.reset(new learning::ValueModel(learning::mlp_evaluator(&mlp), batching));
+  } else if(model_name == "table") {
+    hashed.reset(new learning::HashedQFunction(64));
+    for(int n = 0; n < atoi(argv[4]); n++) {
+      auto hand = sheepshead::interface::Hand(n + 1);
+      learning::learn_from_hand(hashed.get(), &hand, 0.1, generator);
+    }
+    model.reset(new learning::HashedModel(hashed.get()));
+  } else if(model_name == "search") {
+    learning::MctsConfig config;
+    config.number_of_threads = 1;
+    config.iterations = atoi(argv[4]);
+    model.reset(new learning::SearchModel(config));
+  } else {
+    usage();
+  }
+
+  learning::PolicyServer server(socket_path, model.get());
+  if(!server.is_open()) {
+    std::cerr << "Can't listen on " << socket_path << std::endl;
+    return 1;
+  }
+  running_server = &server;
+  signal(SIGINT, stop_server);
+  signal(SIGTERM, stop_server);
+  std::cout << "Serving " << model_name << " decisions on " << socket_path << std::endl;
+  server.serve();
+  running_server = nullptr;
+  print_stats(server.stats());
+  return 0;
+}
+
+// Play hands with every decision asked of the server, from several clients
+// at once, and report the latency the clients see.
+int bench(int argc, char* argv[])
+{
+  if(argc < 5) usage();
+  std::string socket_path = argv[2];
+  int number_of_clients = atoi(argv[3]);
+  int hands_per_client = atoi(argv[4]);
+  unsigned long seed = argc > 5 ? strtoul(argv[5], NULL, 0) : 1;
+
+  std::vector<std::vector<float>> latencies(number_of_clients);
+  std::vector<int> failures(number_of_clients, 0);
+  std::vector<std::thread> clients;
+  auto start = std::chrono::steady_clock::now();
+  for(int c = 0; c < number_of_clients; c++) {
+    clients.emplace_back([&, c]() {
+      learning::PolicyClient client(socket_path);
+      if(!client.is_open()) {
+        failures[c]++;
+        return;
+      }
+      for(int n = 0; n < hands_per_client; n++) {
+        auto hand = sheepshead::interface::Hand(seed + c * hands_per_client + n);
+        while(!hand.is_finished()) {
+          if(hand.is_arbitrable()) {
+            hand.arbiter().arbitrate();
+            continue;
+          }
+          auto player = hand.current_player();
+          auto available_plays = hand.available_plays(player);
+          learning::ActionId action;
+          auto asked = std::chrono::steady_clock::now();
+          auto status = client.decide(hand, &action);
+          std::chrono::duration<double, std::micro> latency =
+              std::chrono::steady_clock::now() - asked;
+          latencies[c].push_back(latency.count());
+          int index = status == learning::PolicyStatus::OK ?
+                      learning::find_action(available_plays, action) : -1;
+          if(index < 0) {
+            failures[c]++;
+            index = 0;
+          }
+          hand.playmaker(player).make_play(available_plays[index]);
+        }
+      }
+    });
+  }
+  for(auto& client : clients) client.join();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::vector<float> all;
+  int total_failures = 0;
+  for(int c = 0; c < number_of_clients; c++) {
+    all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+    total_failures += failures[c];
+  }
+  std::sort(all.begin(), all.end());
+  if(!all.empty()) {
+    std::cout << all.size() << " decisions from " << number_of_clients << " clients in "
+              << elapsed.count() << " s, " << all.size() / elapsed.count()
+              << " decisions/s; client latency p50 " << all[all.size() / 2] << " us, p99 "
+              << all[all.size() * 99 / 100] << " us; " << total_failures << " failures"
+              << std::endl;
+  }
+
+  learning::PolicyClient client(socket_path);
+  learning::PolicyServerStats stats;
+  if(client.stats(&stats) == learning::PolicyStatus::OK) {
+    std::cout << "Server: ";
+    print_stats(stats);
+  }
+  return total_failures > 0;
+}
+
+} // namespace
+
+/*
+ * Serve decisions from a policy to other processes on this host over a Unix
+ * socket, batching requests that arrive together, or exercise such a server
+ * with concurrent clients playing hands through it.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 2) usage();
+  std::string mode = argv[1];
+  if(mode != "serve" && mode != "bench") usage();
+  int result = mode == "serve" ? serve(argc, argv) : bench(argc, argv);
+  google::protobuf::ShutdownProtobufLibrary();
+  return result;
+}
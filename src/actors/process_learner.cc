@@ -0,0 +1,149 @@
+#include "learning/linear_q_function.h"
+#include "learning/shared_channel.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+const size_t CHANNEL_CAPACITY = 8192;
+const size_t SNAPSHOT_BYTES = learning::LinearQFunction::NUMBER_OF_FEATURES *
+                              learning::LinearQFunction::ACTION_SLOTS * sizeof(float);
+
+// Play hands with the latest snapshot of the function and push each hand's
+// records to the learner.
+int run_actor(const std::string& experience_name, const std::string& snapshot_name,
+              int number_of_hands, unsigned long seed, float exploration)
+{
+  learning::ExperienceChannel experience(experience_name);
+  learning::SnapshotChannel snapshots(snapshot_name);
+  if(!experience.is_open() || !snapshots.is_open()) {
+    std::cerr << "Actor can't open the channels " << experience_name << " and "
+              << snapshot_name << std::endl;
+    return 1;
+  }
+
+  learning::LinearQFunction q_function;
+  learning::LinearQPolicy policy(&q_function, exploration);
+  std::default_random_engine generator(seed);
+  uint64_t version = 0;
+  std::vector<char> snapshot;
+  std::vector<learning::ExperienceRecord> records;
+  for(int n = 0; n < number_of_hands; n++) {
+    if(snapshots.read_newer(&version, &snapshot) && snapshot.size() == SNAPSHOT_BYTES) {
+      q_function.set_weights(reinterpret_cast<const float*>(snapshot.data()));
+    }
+    records.clear();
+    auto hand = sheepshead::interface::Hand(seed + n);
+    learning::record_hand(policy, &hand, generator, &records);
+    if(records.empty()) continue;
+    if(!experience.push(records.data(), records.size())) break;
+  }
+  google::protobuf::ShutdownProtobufLibrary();
+  return 0;
+}
+
+} // namespace
+
+/*
+ * Learn a LinearQFunction in this process from hands played by separate
+ * actor processes. The actors push their records through shared memory, and
+ * the learner publishes a snapshot of the function back every so many hands
+ * for them to play with. Nothing goes over a network, and actors wait when
+ * the learner falls behind.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc == 7 && std::string(argv[1]) == "actor") {
+    return run_actor(argv[2], argv[3], atoi(argv[4]), strtoul(argv[5], NULL, 0), atof(argv[6]));
+  }
+  if(argc < 3) {
+    std::cerr << "Usage: process_learner <actors> <hands_per_actor> [snapshot_interval] "
+              << "[exploration] [lambda] [seed]" << std::endl;
+    exit(1);
+  }
+
+  int number_of_actors = atoi(argv[1]);
+  int hands_per_actor = atoi(argv[2]);
+  int snapshot_interval = argc > 3 ? atoi(argv[3]) : 100;
+  std::string exploration = argc > 4 ? argv[4] : "0.1";
+  float lambda = argc > 5 ? atof(argv[5]) : 0.8;
+  unsigned long seed = argc > 6 ? strtoul(argv[6], NULL, 0) : 1;
+
+  std::string suffix = std::to_string(getpid());
+  std::string experience_name = "/deepsheep_experience_" + suffix;
+  std::string snapshot_name = "/deepsheep_snapshot_" + suffix;
+  learning::ExperienceChannel experience(experience_name, CHANNEL_CAPACITY);
+  learning::SnapshotChannel snapshots(snapshot_name, SNAPSHOT_BYTES);
+  if(!experience.is_open() || !snapshots.is_open()) {
+    std::cerr << "Can't create the shared memory channels" << std::endl;
+    exit(1);
+  }
+
+  learning::LinearQFunction q_function(0.05);
+  snapshots.publish(q_function.row(0), SNAPSHOT_BYTES);
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<pid_t> actors;
+  for(int actor = 0; actor < number_of_actors; actor++) {
+    pid_t pid = fork();
+    if(pid == 0) {
+      std::string hands = std::to_string(hands_per_actor);
+      std::string actor_seed = std::to_string(seed + 1000000UL * (actor + 1));
+      execl("/proc/self/exe", argv[0], "actor", experience_name.c_str(), snapshot_name.c_str(),
+            hands.c_str(), actor_seed.c_str(), exploration.c_str(), static_cast<char*>(NULL));
+      _exit(127);
+    }
+    if(pid < 0) {
+      std::cerr << "Can't start actor " << actor << std::endl;
+      break;
+    }
+    actors.push_back(pid);
+  }
+
+  std::vector<learning::ExperienceRecord> records(CHANNEL_CAPACITY);
+  long long number_of_records = 0;
+  long long number_of_hands = 0;
+  long long hands_at_last_snapshot = 0;
+  int number_of_snapshots = 1;
+  size_t running = actors.size();
+  for(;;) {
+    int popped = experience.pop(records.data(), records.size(), 100);
+    if(popped < 0) {
+      std::cerr << "A push is larger than the channel" << std::endl;
+      break;
+    }
+    if(popped > 0) {
+      // Whole hands arrive together, and a done record ends a seat's returns,
+      // so hands can be learned from in one call.
+      q_function.learn_hand(records.data(), popped, lambda);
+      number_of_records += popped;
+      for(int i = 0; i < popped; i++) {
+        if(records[i].done && records[i].observation.seat == 0) number_of_hands++;
+      }
+      if(number_of_hands - hands_at_last_snapshot >= snapshot_interval) {
+        snapshots.publish(q_function.row(0), SNAPSHOT_BYTES);
+        hands_at_last_snapshot = number_of_hands;
+        number_of_snapshots++;
+      }
+      continue;
+    }
+    while(running > 0 && waitpid(-1, nullptr, WNOHANG) > 0) running--;
+    if(running == 0 && experience.size() == 0) break;
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << number_of_actors << " actors sent " << number_of_records << " records from "
+            << number_of_hands << " hands in " << elapsed.count() << " s, "
+            << number_of_records / elapsed.count() << " records/s" << std::endl;
+  std::cout << "Published " << number_of_snapshots << " snapshots; actors waited on a full "
+            << "channel " << experience.full_waits() << " times" << std::endl;
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
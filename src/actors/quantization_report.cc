@@ -0,0 +1,296 @@
+#include "learning/hashed_q_function.h"
+#include "learning/linear_q_function.h"
+#include "learning/mlp.h"
+#include "learning/quantization.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using learning::Precision;
+using sheepshead::interface::Play;
+
+namespace {
+
+// The actions a player could choose between at a recorded decision.
+std::vector<learning::ActionId> options(const learning::ExperienceRecord& record)
+{
+  std::vector<learning::ActionId> actions;
+  learning::ActionId action = record.action;
+  auto play_type = static_cast<Play::PlayType>(record.action.play_type);
+  switch(play_type) {
+    case Play::PlayType::PICK:
+    case Play::PlayType::LONER:
+      for(int decision = 0; decision < 2; decision++) {
+        action.value = decision;
+        actions.push_back(action);
+      }
+      break;
+    case Play::PlayType::PARTNER:
+      for(int card = 0; card < learning::NUMBER_OF_CARDS; card++) {
+        action.value = card;
+        actions.push_back(action);
+      }
+      break;
+    default:
+      for(learning::CardMask cards = record.observation.held_cards; cards; cards &= cards - 1) {
+        int card = learning::mask_first(cards);
+        action.value = play_type == Play::PlayType::DISCARD ? learning::card_bit(card) :
+                       play_type == Play::PlayType::UNKNOWN ? 8 * card : card;
+        actions.push_back(action);
+      }
+  }
+  return actions;
+}
+
+// Sum the slots of each action from a segment's values.
+void action_values(const float* slot_values, const std::vector<learning::ActionId>& actions,
+                   std::vector<float>* values)
+{
+  values->clear();
+  for(auto& action : actions) {
+    int slots[4];
+    int number_of_slots = learning::LinearQFunction::action_slots(action, slots);
+    float value = 0;
+    for(int j = 0; j < number_of_slots; j++) value += slot_values[slots[j]];
+    values->push_back(value);
+  }
+}
+
+size_t best(const std::vector<float>& values)
+{
+  size_t best_index = 0;
+  for(size_t i = 1; i < values.size(); i++) {
+    if(values[i] > values[best_index]) best_index = i;
+  }
+  return best_index;
+}
+
+void report(const std::string& model, Precision precision, size_t bytes,
+            const learning::QuantizationError& error, double states_per_second)
+{
+  std::cout << std::left << std::setw(8) << model << std::setw(9)
+            << learning::precision_name(precision) << std::right << std::setw(11) << bytes
+            << " B  mean |err| " << std::setw(10) << error.mean_absolute()
+            << "  max |err| " << std::setw(10) << error.max_absolute
+            << "  same choice " << std::setw(8) << 100 * error.agreement() << "%";
+  if(states_per_second > 0) std::cout << "  " << states_per_second << " states/s";
+  std::cout << std::endl;
+}
+
+// Sum every slot of every recorded decision, for timing.
+template<typename Function_T>
+float evaluate_records(size_t number_of_records, Function_T evaluate_all)
+{
+  float slot_values[learning::LinearQFunction::ACTION_SLOTS];
+  float checksum = 0;
+  for(size_t i = 0; i < number_of_records; i++) {
+    evaluate_all(i, slot_values);
+    checksum += slot_values[0];
+  }
+  return checksum;
+}
+
+template<typename Function_T>
+double states_per_second(int states, Function_T evaluate)
+{
+  const int passes = 10;
+  auto start = std::chrono::steady_clock::now();
+  for(int pass = 0; pass < passes; pass++) evaluate();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return passes * static_cast<double>(states) / elapsed.count();
+}
+
+} // namespace
+
+/*
+ * Learn a linear and a hashed Q-function from hands played by the heuristic
+ * policy, and read or make up an MLP, then report what quantizing each one
+ * costs in accuracy on a held-out set of recorded hands: how far its values
+ * move, and how often the best action changes. Evaluation speed is measured
+ * for each precision too.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 3) {
+    std::cerr << "Usage: quantization_report <training_hands> <held_out_hands> "
+              << "[network_file] [seed]" << std::endl;
+    exit(1);
+  }
+
+  int training_hands = atoi(argv[1]);
+  int held_out_hands = atoi(argv[2]);
+  std::string network_file = argc > 3 ? argv[3] : "";
+  unsigned long seed = argc > 4 ? strtoul(argv[4], NULL, 0) : 1;
+
+  learning::HeuristicPolicy policy;
+  std::default_random_engine generator(seed);
+  learning::LinearQFunction linear(0.05);
+  learning::HashedQFunction hashed(16, learning::HashedQFunction::DEFAULT_FEATURES |
+                                       learning::HashedQFunction::HELD_CARDS);
+  std::vector<learning::ExperienceRecord> records;
+  for(int n = 0; n < training_hands; n++) {
+    records.clear();
+    auto hand = sheepshead::interface::Hand(seed + n);
+    learning::record_hand(policy, &hand, generator, &records);
+    linear.learn_hand(records.data(), records.size(), 0.8);
+    auto hashed_hand = sheepshead::interface::Hand(seed + n);
+    learning::learn_from_hand(&hashed, &hashed_hand, 0.1, generator);
+  }
+
+  // Hands never trained on.
+  records.clear();
+  unsigned long held_out_seed = seed + training_hands + 1000000;
+  for(int n = 0; n < held_out_hands; n++) {
+    auto hand = sheepshead::interface::Hand(held_out_seed + n);
+    learning::record_hand(policy, &hand, generator, &records);
+  }
+  if(records.empty()) return 0;
+  std::cout << "Trained on " << training_hands << " hands, testing on " << records.size()
+            << " decisions from " << held_out_hands << " held-out hands" << std::endl;
+
+  // Linear: every option of each recorded decision.
+  std::vector<std::vector<int>> active(records.size());
+  for(size_t i = 0; i < records.size(); i++) {
+    active[i].resize(learning::LinearQFunction::MAX_ACTIVE_FEATURES);
+    auto play_type = static_cast<Play::PlayType>(records[i].action.play_type);
+    int number_active = learning::LinearQFunction::active_features(records[i].observation,
+                                                                   play_type, active[i].data());
+    active[i].resize(number_active);
+  }
+  auto float_linear = [&](size_t i, float* values) {
+    auto play_type = static_cast<Play::PlayType>(records[i].action.play_type);
+    linear.evaluate_all(active[i].data(), active[i].size(),
+                        learning::LinearQFunction::segment(play_type), values);
+  };
+  double float_speed = states_per_second(records.size(), [&]() {
+    evaluate_records(records.size(), float_linear);
+  });
+  report("linear", Precision::FLOAT32,
+         learning::LinearQFunction::NUMBER_OF_FEATURES * learning::LinearQFunction::ACTION_SLOTS *
+         sizeof(float), learning::QuantizationError(), float_speed);
+
+  for(Precision precision : {Precision::FP16, Precision::INT8}) {
+    learning::QuantizedLinearQFunction quantized(linear, precision);
+    auto quantized_linear = [&](size_t i, float* values) {
+      auto play_type = static_cast<Play::PlayType>(records[i].action.play_type);
+      quantized.evaluate_all(active[i].data(), active[i].size(),
+                             learning::LinearQFunction::segment(play_type), values);
+    };
+    learning::QuantizationError error;
+    std::vector<float> reference, approximation;
+    float reference_slots[learning::LinearQFunction::ACTION_SLOTS];
+    float approximation_slots[learning::LinearQFunction::ACTION_SLOTS];
+    for(size_t i = 0; i < records.size(); i++) {
+      auto actions = options(records[i]);
+      if(actions.empty()) continue;
+      float_linear(i, reference_slots);
+      quantized_linear(i, approximation_slots);
+      action_values(reference_slots, actions, &reference);
+      action_values(approximation_slots, actions, &approximation);
+      for(size_t j = 0; j < actions.size(); j++) error.add(reference[j], approximation[j]);
+      error.add_decision(best(reference) == best(approximation));
+    }
+    double speed = states_per_second(records.size(),
+                                     [&]() {
+      evaluate_records(records.size(), quantized_linear);
+    });
+    report("linear", precision, quantized.weight_bytes(), error, speed);
+  }
+
+  // MLP: every output for each recorded decision.
+  learning::Mlp mlp;
+  if(!network_file.empty()) {
+    if(!mlp.load(network_file)) {
+      std::cerr << "Can't read a network from " << network_file << std::endl;
+      exit(1);
+    }
+  } else {
+    std::normal_distribution<float> normal(0, 0.1);
+    int sizes[] = {learning::observation_input_size(), 256, 256, 32};
+    for(int i = 0; i < 3; i++) {
+      std::vector<float> weights(sizes[i] * sizes[i + 1]);
+      std::vector<float> bias(sizes[i + 1]);
+      for(auto& w : weights) w = normal(generator);
+      mlp.add_layer(sizes[i], sizes[i + 1],
+                    i < 2 ? learning::Activation::RELU : learning::Activation::NONE,
+                    weights.data(), bias.data());
+    }
+  }
+  if(mlp.input_size() == learning::observation_input_size()) {
+    int batch_size = records.size();
+    std::vector<float> inputs(batch_size * mlp.input_size());
+    for(int i = 0; i < batch_size; i++) {
+      learning::encode_observation(records[i].observation,
+                                   static_cast<Play::PlayType>(records[i].action.play_type),
+                                   &inputs[i * mlp.input_size()]);
+    }
+    int width = mlp.output_size();
+    std::vector<float> reference(batch_size * width);
+    learning::Mlp::Workspace workspace;
+    auto run = [&](const learning::Mlp& network, std::vector<float>* outputs) {
+      // Batches of 256, as a batched actor would send them.
+      for(int row = 0; row < batch_size; row += 256) {
+        network.forward(&inputs[row * network.input_size()], std::min(256, batch_size - row),
+                        &(*outputs)[row * width], &workspace);
+      }
+    };
+    run(mlp, &reference);
+    report("mlp", Precision::FLOAT32, mlp.weight_bytes(), learning::QuantizationError(),
+           states_per_second(batch_size, [&]() { run(mlp, &reference); }));
+
+    for(Precision precision : {Precision::FP16, Precision::INT8}) {
+      learning::Mlp quantized(mlp);
+      quantized.quantize(precision);
+      std::vector<float> approximation(batch_size * width);
+      run(quantized, &approximation);
+      learning::QuantizationError error;
+      for(int row = 0; row < batch_size; row++) {
+        std::vector<float> reference_row(&reference[row * width], &reference[(row + 1) * width]);
+        std::vector<float> approximation_row(&approximation[row * width],
+                                             &approximation[(row + 1) * width]);
+        for(int j = 0; j < width; j++) error.add(reference_row[j], approximation_row[j]);
+        error.add_decision(best(reference_row) == best(approximation_row));
+      }
+      report("mlp", precision, quantized.weight_bytes(), error,
+             states_per_second(batch_size, [&]() { run(quantized, &approximation); }));
+    }
+  } else {
+    std::cerr << "The network takes " << mlp.input_size() << " inputs, not "
+              << learning::observation_input_size() << "; skipping it" << std::endl;
+  }
+
+  // Hashed: every available play at each decision of the held-out hands.
+  learning::CompactQTable compact(hashed.table());
+  learning::QuantizationError error;
+  for(int n = 0; n < held_out_hands; n++) {
+    auto hand = sheepshead::interface::Hand(held_out_seed + n);
+    while(!hand.is_finished()) {
+      if(hand.is_arbitrable()) {
+        hand.arbiter().arbitrate();
+        continue;
+      }
+      auto player = hand.current_player();
+      auto available_plays = hand.available_plays(player);
+      uint64_t state_key = hashed.state_key(hand);
+      std::vector<float> reference, approximation;
+      for(auto& play : available_plays) {
+        uint64_t key = hashed.key(state_key, play);
+        float value = 0;
+        compact.find(key, &value);
+        reference.push_back(hashed.evaluate(key));
+        approximation.push_back(value);
+        error.add(reference.back(), approximation.back());
+      }
+      error.add_decision(best(reference) == best(approximation));
+      hand.playmaker(player).make_play(policy.choose_play(hand, generator));
+    }
+  }
+  report("hashed", Precision::FLOAT32, hashed.table().bytes(),
+         learning::QuantizationError(), 0);
+  report("hashed", Precision::FP16, compact.bytes(), error, 0);
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
@@ -0,0 +1,49 @@
+#include "sheepshead/interface/rules.h"
+#include "learning/tablebase.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/*
+ * Generate an endgame tablebase file for the last tricks of hands under one
+ * rule variation, by solving every late position reachable in sampled deals.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 5) {
+    std::cerr << "Usage: tablebase_generator <output_file> <players> <tricks> "
+              << "<deals> [seed] [clubs]" << std::endl;
+    exit(1);
+  }
+
+  std::string output_path = argv[1];
+  int number_of_players = atoi(argv[2]);
+  int max_tricks = atoi(argv[3]);
+  int number_of_deals = atoi(argv[4]);
+  unsigned long seed = argc > 5 ? strtoul(argv[5], NULL, 0) : 1;
+  bool trump_is_clubs = argc > 6 && std::string(argv[6]) == "clubs";
+
+  if(max_tricks < 1 || max_tricks > learning::Tablebase::MAX_TRICKS) {
+    std::cerr << "tricks must be from 1 to " << learning::Tablebase::MAX_TRICKS << std::endl;
+    exit(1);
+  }
+
+  auto rules = sheepshead::interface::MutableRules();
+  rules.set_number_of_players(number_of_players);
+  if(trump_is_clubs) rules.set_trump_is_clubs();
+
+  learning::TablebaseBuilder builder(number_of_players, trump_is_clubs, max_tricks);
+  auto start = std::chrono::steady_clock::now();
+  learning::generate_tablebase(rules.get_rules(), number_of_deals, seed, &builder);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  if(!builder.write(output_path)) {
+    std::cerr << "Couldn't write " << output_path << std::endl;
+    exit(1);
+  }
+  std::cout << "Wrote " << builder.size() << " positions to " << output_path
+            << " in " << elapsed.count() << " s" << std::endl;
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
@@ -0,0 +1,129 @@
+#include "sheepshead/interface/rules.h"
+#include "learning/linear_q_function.h"
+#include "learning/pick_table.h"
+#include "learning/tournament.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+void print_estimate(const learning::BootstrapEstimate& estimate)
+{
+  std::cout << std::fixed << std::setprecision(3) << std::setw(7) << estimate.mean << " ["
+            << std::setw(7) << estimate.lower << ", " << std::setw(7) << estimate.upper
+            << "] over " << estimate.hands << " hands";
+}
+
+} // namespace
+
+/*
+ * Compare policies by playing the same deals in every seating. Policies are
+ * random, heuristic, solver, linear:<training_hands> for a LinearQPolicy
+ * learned from that many heuristic hands, or pick_table:<file> for picking
+ * from a PickTable. Reports each policy's mean reward per hand, overall and
+ * as picker, partner, defender and in leasters, and how far it is from the
+ * first policy, with 95% bootstrap confidence intervals. Deals are
+ * independent unless a deal scheme, antithetic or rotated, is given.
+ */
+int main(int argc, char* argv[])
+{
+  if(argc < 5) {
+    std::cerr << "Usage: tournament <deals> <players> <seed> [independent|antithetic|rotated] "
+              << "<policy> <policy> [policy...]" << std::endl;
+    exit(1);
+  }
+
+  learning::TournamentConfig config;
+  config.deals = atoi(argv[1]);
+  int number_of_players = atoi(argv[2]);
+  config.seed = strtoul(argv[3], NULL, 0);
+  if(number_of_players < 3 || number_of_players > 5 || config.deals < 1) {
+    std::cerr << "Players must be 3 to 5, with at least one deal" << std::endl;
+    exit(1);
+  }
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(number_of_players);
+  auto rules = mutable_rules.get_rules();
+
+  int first_policy = 4;
+  if(learning::parse_deal_scheme(argv[4], &config.deal_scheme)) first_policy++;
+  if(argc - first_policy < 2) {
+    std::cerr << "Give at least two policies" << std::endl;
+    exit(1);
+  }
+
+  std::vector<std::string> names;
+  std::vector<std::unique_ptr<learning::Policy>> policies;
+  std::vector<std::unique_ptr<learning::LinearQFunction>> q_functions;
+  std::vector<std::unique_ptr<learning::PickTable>> tables;
+  for(int i = first_policy; i < argc; i++) {
+    std::string name = argv[i];
+    std::string kind = name.substr(0, name.find(':'));
+    std::string argument = name.find(':') == std::string::npos ? "" :
+                           name.substr(name.find(':') + 1);
+    if(kind == "random") {
+      policies.emplace_back(new learning::RandomPolicy());
+    } else if(kind == "heuristic") {
+      policies.emplace_back(new learning::HeuristicPolicy());
+    } else if(kind == "solver") {
+      policies.emplace_back(new learning::SolverPolicy());
+    } else if(kind == "linear") {
+      learning::HeuristicPolicy teacher;
+      std::default_random_engine generator(1);
+      q_functions.emplace_back(new learning::LinearQFunction(0.05));
+      std::vector<learning::ExperienceRecord> records;
+      for(int n = 0; n < atoi(argument.c_str()); n++) {
+        records.clear();
+        auto hand = sheepshead::interface::Hand(rules, n + 1);
+        learning::record_hand(teacher, &hand, generator, &records);
+        q_functions.back()->learn_hand(records.data(), records.size(), 0.8);
+      }
+      policies.emplace_back(new learning::LinearQPolicy(q_functions.back().get()));
+    } else if(kind == "pick_table") {
+      tables.emplace_back(new learning::PickTable(argument));
+      if(!tables.back()->is_open()) {
+        std::cerr << "Can't read a pick table from " << argument << std::endl;
+        exit(1);
+      }
+      policies.emplace_back(new learning::PickTablePolicy(tables.back().get()));
+    } else {
+      std::cerr << "Unknown policy " << name << std::endl;
+      exit(1);
+    }
+    names.push_back(name);
+  }
+  std::vector<const learning::Policy*> competitors;
+  for(auto& policy : policies) competitors.push_back(policy.get());
+
+  auto start = std::chrono::steady_clock::now();
+  auto result = learning::run_tournament(rules, competitors, config);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << result.deals << " deals, " << result.hands << " hands in " << elapsed.count()
+            << " s on " << config.number_of_threads << " threads" << std::endl;
+
+  for(size_t c = 0; c < names.size(); c++) {
+    auto& competitor = result.competitors[c];
+    std::cout << names[c] << std::endl;
+    std::cout << "  " << std::left << std::setw(10) << "overall" << std::right;
+    print_estimate(competitor.overall);
+    std::cout << std::endl;
+    for(int role = 0; role < learning::NUMBER_OF_SEAT_ROLES; role++) {
+      std::cout << "  " << std::left << std::setw(10)
+                << learning::seat_role_name(static_cast<learning::SeatRole>(role)) << std::right;
+      print_estimate(competitor.roles[role]);
+      std::cout << std::endl;
+    }
+    if(c > 0) {
+      std::cout << "  " << std::left << std::setw(10) << "vs first" << std::right;
+      print_estimate(competitor.versus_first);
+      std::cout << std::endl;
+    }
+  }
+
+  google::protobuf::ShutdownProtobufLibrary();
+}
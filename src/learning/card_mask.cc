@@ -0,0 +1,100 @@
+#include "card_mask.h"
+
+#include <cctype>
+
+namespace learning {
+
+namespace {
+
+struct BinomialTable
+{
+  BinomialTable()
+  {
+    for(int n = 0; n <= NUMBER_OF_CARDS; n++) {
+      values[n][0] = 1;
+      for(int k = 1; k <= NUMBER_OF_CARDS; k++) {
+        values[n][k] = n == 0 ? 0 : values[n - 1][k - 1] + values[n - 1][k];
+      }
+    }
+  }
+
+  uint64_t values[NUMBER_OF_CARDS + 1][NUMBER_OF_CARDS + 1];
+};
+
+const BinomialTable BINOMIALS;
+
+} // namespace
+
+uint64_t binomial(int n, int k)
+{
+  return k < 0 || k > n ? 0 : BINOMIALS.values[n][k];
+}
+
+uint64_t mask_rank(CardMask mask)
+{
+  uint64_t rank = 0;
+  int i = 0;
+  for(; mask; mask &= mask - 1) rank += binomial(mask_first(mask), ++i);
+  return rank;
+}
+
+int mask_point_value(CardMask mask)
+{
+  int points = 0;
+  while(mask) {
+    points += card_point_value(mask_first(mask));
+    mask &= mask - 1;
+  }
+  return points;
+}
+
+int parse_card(const std::string& name)
+{
+  if(name.size() < 2) return NO_CARD;
+  std::string rank_name = name.substr(0, name.size() - 1);
+  for(auto& c : rank_name) c = std::toupper(static_cast<unsigned char>(c));
+
+  static const char* RANK_NAMES[8] = {"A", "10", "K", "Q", "J", "9", "8", "7"};
+  int rank = -1;
+  for(int i = 0; i < 8; i++) {
+    if(rank_name == RANK_NAMES[i]) rank = i;
+  }
+  if(rank_name == "T") rank = 1;
+
+  int suit = -1;
+  switch(std::toupper(static_cast<unsigned char>(name.back()))) {
+    case 'D' : suit = 0; break;
+    case 'H' : suit = 1; break;
+    case 'C' : suit = 2; break;
+    case 'S' : suit = 3; break;
+  }
+  if(rank < 0 || suit < 0) return NO_CARD;
+  return 8 * suit + rank;
+}
+
+std::string card_debug_string(int index)
+{
+  if(index < 0 || index >= NUMBER_OF_CARDS) return "None";
+
+  static const char* RANK_NAMES[8] = {"ACE", "TEN", "KING", "QUEEN",
+                                      "JACK", "NINE", "EIGHT", "SEVEN"};
+  static const char* SUIT_NAMES[4] = {"DIAMONDS", "HEARTS", "CLUBS", "SPADES"};
+
+  std::string out_string = RANK_NAMES[index % 8];
+  out_string += "-";
+  out_string += SUIT_NAMES[index / 8];
+  return out_string;
+}
+
+std::string mask_debug_string(CardMask mask)
+{
+  std::string out_string;
+  while(mask) {
+    out_string += card_debug_string(mask_first(mask));
+    out_string += " ";
+    mask &= mask - 1;
+  }
+  return out_string;
+}
+
+} // namespace learning
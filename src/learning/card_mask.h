@@ -0,0 +1,97 @@
+#ifndef DEEPSHEEP_LEARNING_CARDMASK_H_
+#define DEEPSHEEP_LEARNING_CARDMASK_H_
+
+#include "sheepshead/interface/deck.h"
+
+#include <cstdint>
+#include <string>
+
+//! \file card_mask.h
+//! \brief Compact card indices and sets of cards used by search and learning.
+
+namespace learning {
+
+/// A set of cards, one bit per card index.
+using CardMask = uint32_t;
+
+const int NUMBER_OF_CARDS = 32;
+const int NO_CARD = -1;
+
+/// Return the index, 0 through 31, of the card with the printed suit and rank.
+
+//! Indices follow the order of the interface enums: index = 8 * suit + rank.
+inline int card_index(sheepshead::interface::Card::Suit true_suit,
+                      sheepshead::interface::Card::Rank true_rank)
+{
+  return 8 * static_cast<int>(true_suit) + static_cast<int>(true_rank);
+}
+
+inline int card_index(const sheepshead::interface::Card& card)
+{
+  return card_index(card.true_suit(), card.true_rank());
+}
+
+inline sheepshead::interface::Card::Suit card_true_suit(int index)
+{
+  return static_cast<sheepshead::interface::Card::Suit>(index / 8);
+}
+
+inline sheepshead::interface::Card::Rank card_true_rank(int index)
+{
+  return static_cast<sheepshead::interface::Card::Rank>(index % 8);
+}
+
+/// The point value of a card, the same as Card::point_value().
+inline int card_point_value(int index)
+{
+  static const int RANK_POINTS[8] = {11, 10, 4, 3, 2, 0, 0, 0};
+  return RANK_POINTS[index % 8];
+}
+
+inline CardMask card_bit(int index)
+{
+  return CardMask(1) << index;
+}
+
+inline int mask_size(CardMask mask)
+{
+  return __builtin_popcount(mask);
+}
+
+/// The index of the lowest card in a non-empty mask.
+inline int mask_first(CardMask mask)
+{
+  return __builtin_ctz(mask);
+}
+
+/// The index of the nth lowest card in a mask holding more than n cards.
+inline int mask_nth(CardMask mask, int n)
+{
+  while(n-- > 0) mask &= mask - 1;
+  return mask_first(mask);
+}
+
+/// The summed point value of the cards in a mask.
+int mask_point_value(CardMask mask);
+
+/// The number of ways to choose k of n things, for n up to NUMBER_OF_CARDS.
+uint64_t binomial(int n, int k);
+
+/// The rank of a mask among the masks with as many cards, from 0 to binomial(32, size) - 1.
+
+//! Ranks follow the combinatorial number system, so masks of each size are
+//! numbered densely and can index an array.
+uint64_t mask_rank(CardMask mask);
+
+/// Parse a short card name such as "QC", "10S" or "7d" into a card index.
+
+//! Ranks are A, 10 (or T), K, Q, J, 9, 8 and 7, and suits are C, S, H and D,
+//! in either case. Return NO_CARD if the name isn't a card.
+int parse_card(const std::string& name);
+
+/// Return a string useful for debugging.
+std::string card_debug_string(int index);
+std::string mask_debug_string(CardMask mask);
+
+} // namespace learning
+#endif
@@ -0,0 +1,124 @@
+#include "deal_stream.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <random>
+
+using sheepshead::interface::Card;
+
+namespace learning {
+
+namespace {
+
+// Fail ranks from the strongest down; queens and jacks are trump.
+const Card::Rank FAIL_RANKS[6] = {Card::Rank::ACE, Card::Rank::TEN, Card::Rank::KING,
+                                  Card::Rank::NINE, Card::Rank::EIGHT, Card::Rank::SEVEN};
+const Card::Suit QUEEN_JACK_SUITS[4] = {Card::Suit::CLUBS, Card::Suit::SPADES,
+                                        Card::Suit::HEARTS, Card::Suit::DIAMONDS};
+
+// Pair the cards of an ordering from the strongest down with the same list
+// from the weakest up.
+void mirror_ordering(const std::vector<int>& ordering, int8_t* mirror)
+{
+  for(size_t i = 0; i < ordering.size(); i++) {
+    mirror[ordering[i]] = ordering[ordering.size() - 1 - i];
+  }
+}
+
+} // namespace
+
+unsigned long mix_seed(unsigned long seed, unsigned long stream)
+{
+  unsigned long long z = seed + 0x9E3779B97F4A7C15ULL * (stream + 1);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+DealStream::DealStream(const sheepshead::interface::Rules& rules, unsigned long seed,
+                       DealScheme scheme)
+  : m_rules(rules), m_seed(seed), m_scheme(scheme), m_group_size(1)
+{
+  assert(rules.number_of_players() * rules.number_of_cards_per_player() +
+         rules.number_of_cards_in_blinds() == NUMBER_OF_CARDS);
+  if(scheme == DealScheme::ANTITHETIC) m_group_size = 2;
+  if(scheme == DealScheme::ROTATED) m_group_size = rules.number_of_players();
+
+  Card::Suit trump_suit = rules.trump_is_clubs() ? Card::Suit::CLUBS : Card::Suit::DIAMONDS;
+  std::vector<int> trump;
+  for(auto rank : {Card::Rank::QUEEN, Card::Rank::JACK}) {
+    for(auto suit : QUEEN_JACK_SUITS) trump.push_back(card_index(suit, rank));
+  }
+  for(auto rank : FAIL_RANKS) trump.push_back(card_index(trump_suit, rank));
+  mirror_ordering(trump, m_mirror);
+  for(auto suit : QUEEN_JACK_SUITS) {
+    if(suit == trump_suit) continue;
+    std::vector<int> fail;
+    for(auto rank : FAIL_RANKS) fail.push_back(card_index(suit, rank));
+    mirror_ordering(fail, m_mirror);
+  }
+}
+
+std::vector<int> DealStream::cards(long long n) const
+{
+  assert(n >= 0);
+  long long group = n / m_group_size;
+  int member = n % m_group_size;
+
+  std::default_random_engine generator(mix_seed(m_seed, 2 * group));
+  std::vector<int> cards(NUMBER_OF_CARDS);
+  std::iota(cards.begin(), cards.end(), 0);
+  std::shuffle(cards.begin(), cards.end(), generator);
+  if(member == 0) return cards;
+
+  if(m_scheme == DealScheme::ANTITHETIC) {
+    for(int& card : cards) card = m_mirror[card];
+    return cards;
+  }
+
+  // Seat s takes the hand dealt to seat s + member; the blinds stay.
+  int number_of_players = m_rules.number_of_players();
+  int cards_per_player = m_rules.number_of_cards_per_player();
+  std::vector<int> rotated(cards);
+  for(int seat = 0; seat < number_of_players; seat++) {
+    int from = (seat + member) % number_of_players;
+    std::copy(cards.begin() + from * cards_per_player,
+              cards.begin() + (from + 1) * cards_per_player,
+              rotated.begin() + seat * cards_per_player);
+  }
+  return rotated;
+}
+
+Deck DealStream::deck(long long n) const
+{
+  Deck deck;
+  for(int card : cards(n)) deck.push_back({card_true_suit(card), card_true_rank(card)});
+  return deck;
+}
+
+sheepshead::interface::Hand DealStream::hand(long long n) const
+{
+  return sheepshead::interface::Hand(m_rules, deck(n));
+}
+
+unsigned long DealStream::play_seed(long long n) const
+{
+  return mix_seed(m_seed, 2 * n + 1);
+}
+
+bool parse_deal_scheme(const std::string& name, DealScheme* scheme)
+{
+  if(name == "independent") {
+    *scheme = DealScheme::INDEPENDENT;
+  } else if(name == "antithetic") {
+    *scheme = DealScheme::ANTITHETIC;
+  } else if(name == "rotated") {
+    *scheme = DealScheme::ROTATED;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+} // namespace learning
@@ -0,0 +1,89 @@
+#ifndef DEEPSHEEP_LEARNING_DEALSTREAM_H_
+#define DEEPSHEEP_LEARNING_DEALSTREAM_H_
+
+#include "learning/card_mask.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/rules.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace learning {
+
+/// A stacked deck for Hand's constructor, as printed suit and rank.
+typedef std::vector<std::pair<sheepshead::interface::Card::Suit,
+                              sheepshead::interface::Card::Rank>> Deck;
+
+/// Derive independent seeds from one: splitmix64 of the seed and stream.
+unsigned long mix_seed(unsigned long seed, unsigned long stream);
+
+/// How a DealStream ties its deals together.
+enum class DealScheme
+{
+  //! Every deal shuffled on its own.
+  INDEPENDENT = 0,
+  //! Deals in pairs, the second swapping every card for its mirror in
+  //! strength: the best trump for the worst, the ace of a fail suit for
+  //! the seven, and so on, so a strong hand comes with a weak one.
+  ANTITHETIC = 1,
+  //! Deals in groups of number_of_players, each passing the first deal's
+  //! hands one more seat round the table, so within a group every seat
+  //! holds every hand, and the same trump counts, once.
+  ROTATED = 2
+};
+
+/// A numbered sequence of deals and of random numbers to play them with.
+
+/** Deal n and the seed for playing it depend only on the stream's seed and
+ *  n, so comparisons that play the same numbers from the same stream see
+ *  the same cards and draw the same random numbers downstream, common
+ *  random numbers, whichever order or thread they are played in.
+ *
+ *  Every scheme deals each seat uniformly at random, so averages over any
+ *  number of deals are unbiased, but ANTITHETIC and ROTATED make the deals
+ *  of a group negatively correlated for any one seat, which takes much of
+ *  the luck of the deal out of averages over whole groups. Estimates of
+ *  their error should treat a group, not a deal, as the unit.
+ */
+class DealStream
+{
+public:
+  DealStream(const sheepshead::interface::Rules& rules, unsigned long seed,
+             DealScheme scheme = DealScheme::INDEPENDENT);
+
+  //! The cards of deal n, as card indices: each seat's from the dealer's,
+  //! then the blinds.
+  std::vector<int> cards(long long n) const;
+
+  //! Deal n as a stacked deck.
+  Deck deck(long long n) const;
+
+  //! Deal n, ready for the picking round.
+  sheepshead::interface::Hand hand(long long n) const;
+
+  //! A seed for the random choices made playing deal n.
+  unsigned long play_seed(long long n) const;
+
+  //! The number of consecutive deals the scheme ties together, starting from 0.
+  int group_size() const { return m_group_size; }
+
+  DealScheme scheme() const { return m_scheme; }
+  const sheepshead::interface::Rules& rules() const { return m_rules; }
+
+private:
+  sheepshead::interface::Rules m_rules;
+  unsigned long m_seed;
+  DealScheme m_scheme;
+  int m_group_size;
+  //! Each card's mirror in strength, for ANTITHETIC.
+  int8_t m_mirror[NUMBER_OF_CARDS];
+
+}; // class DealStream
+
+/// Parse "independent", "antithetic" or "rotated", returning false for anything else.
+bool parse_deal_scheme(const std::string& name, DealScheme* scheme);
+
+} // namespace learning
+#endif
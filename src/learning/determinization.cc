@@ -0,0 +1,169 @@
+#include "determinization.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace learning {
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::PlayerId;
+
+// How many times to try honoring every inferred void before giving up on them.
+const int MAX_VOID_ATTEMPTS = 32;
+
+Determinizer::Determinizer(const Hand& hand, const PlayerId& observer)
+  : m_position(hand), m_observer(seat_index(hand, observer)),
+    m_partner_restriction(0)
+{
+  int picker = m_position.picker();
+  bool observer_is_picker = picker == m_observer;
+
+  m_unseen = ~(m_position.held_cards(m_observer) | m_position.played_cards());
+  if(observer_is_picker) m_unseen &= ~m_position.discarded_cards();
+
+  m_leftover_is_discard = picker >= 0 && !observer_is_picker;
+  m_sample_unknown = !observer_is_picker &&
+                     m_position.unknown_card() != NO_CARD &&
+                     !(m_position.played_cards() & card_bit(m_position.unknown_card()));
+
+  for(int seat = 0; seat < TrickPosition::MAX_PLAYERS; seat++) {
+    m_held_counts[seat] = 0;
+    m_allowed[seat] = m_unseen;
+  }
+  for(int seat = 0; seat < m_position.number_of_players(); seat++) {
+    if(seat != m_observer) m_held_counts[seat] = mask_size(m_position.held_cards(seat));
+  }
+  m_leftover_allowed = m_unseen;
+
+  // The picker can't hold the card they called, and it wasn't discarded.
+  int partner_card = m_position.partner_card();
+  if(picker >= 0 && partner_card != NO_CARD && (m_unseen & card_bit(partner_card))) {
+    m_partner_restriction = card_bit(partner_card);
+    m_allowed[picker] &= ~m_partner_restriction;
+    m_leftover_allowed &= ~m_partner_restriction;
+  }
+
+  // A player who didn't follow the led suit has no more cards of that suit.
+  CardMask hidden_unknown = m_sample_unknown ? card_bit(m_position.unknown_card()) : 0;
+  auto history = hand.history();
+  for(auto trick_itr = history.tricks_begin(); trick_itr != history.tricks_end(); ++trick_itr) {
+    int leader = seat_index(hand, *trick_itr->leader());
+    int led_suit = -1;
+    int laid = 0;
+    for(auto card_itr = trick_itr->laid_cards_begin();
+             card_itr != trick_itr->laid_cards_end();
+             ++card_itr, ++laid) {
+      int suit = m_position.effective_suit(card_index(*card_itr));
+      if(laid == 0) {
+        led_suit = suit;
+      } else if(suit != led_suit) {
+        int seat = (leader + laid) % m_position.number_of_players();
+        m_allowed[seat] &= ~(m_position.suit_mask(led_suit) & ~hidden_unknown);
+      }
+    }
+  }
+}
+
+bool Determinizer::try_sample(std::default_random_engine& generator, bool use_voids,
+                              std::array<CardMask, TrickPosition::MAX_PLAYERS>* held_cards,
+                              CardMask* leftover_cards) const
+{
+  // Slots are the seats followed by the discards or blinds.
+  const int number_of_players = m_position.number_of_players();
+  const int leftover_slot = number_of_players;
+  int capacity[TrickPosition::MAX_PLAYERS + 1];
+  CardMask allowed[TrickPosition::MAX_PLAYERS + 1];
+  CardMask assigned[TrickPosition::MAX_PLAYERS + 1];
+
+  int assigned_count = 0;
+  for(int slot = 0; slot < number_of_players; slot++) {
+    capacity[slot] = m_held_counts[slot];
+    assigned_count += capacity[slot];
+    allowed[slot] = use_voids ? m_allowed[slot] : m_unseen;
+    assigned[slot] = 0;
+  }
+  if(!use_voids && m_position.picker() >= 0) {
+    allowed[m_position.picker()] &= ~m_partner_restriction;
+  }
+  capacity[leftover_slot] = mask_size(m_unseen) - assigned_count;
+  allowed[leftover_slot] = m_leftover_allowed;
+  assigned[leftover_slot] = 0;
+
+  // Deal the most constrained cards first, in random order otherwise.
+  std::vector<std::pair<int, int>> cards;
+  for(CardMask remaining = m_unseen; remaining; remaining &= remaining - 1) {
+    int card = mask_first(remaining);
+    int eligible_slots = 0;
+    for(int slot = 0; slot <= leftover_slot; slot++) {
+      if(capacity[slot] > 0 && (allowed[slot] & card_bit(card))) eligible_slots++;
+    }
+    cards.emplace_back(eligible_slots, card);
+  }
+  std::shuffle(cards.begin(), cards.end(), generator);
+  std::stable_sort(cards.begin(), cards.end(),
+      [](const std::pair<int, int>& a, const std::pair<int, int>& b)
+        {return a.first < b.first;});
+
+  for(auto& eligible_card : cards) {
+    int card = eligible_card.second;
+    int total_weight = 0;
+    for(int slot = 0; slot <= leftover_slot; slot++) {
+      if(allowed[slot] & card_bit(card)) total_weight += capacity[slot];
+    }
+    if(total_weight == 0) return false;
+
+    // Weight each slot by its remaining room so every deal is about as likely.
+    std::uniform_int_distribution<int> distribution(0, total_weight - 1);
+    int choice = distribution(generator);
+    for(int slot = 0; slot <= leftover_slot; slot++) {
+      if(!(allowed[slot] & card_bit(card))) continue;
+      if(choice < capacity[slot]) {
+        assigned[slot] |= card_bit(card);
+        capacity[slot]--;
+        break;
+      }
+      choice -= capacity[slot];
+    }
+  }
+
+  for(int slot = 0; slot < number_of_players; slot++) {
+    (*held_cards)[slot] = assigned[slot];
+  }
+  *leftover_cards = assigned[leftover_slot];
+  return true;
+}
+
+TrickPosition Determinizer::sample(std::default_random_engine& generator) const
+{
+  std::array<CardMask, TrickPosition::MAX_PLAYERS> held_cards;
+  held_cards.fill(0);
+  CardMask leftover_cards = 0;
+
+  bool sampled = false;
+  for(int attempt = 0; attempt < MAX_VOID_ATTEMPTS && !sampled; attempt++) {
+    sampled = try_sample(generator, true, &held_cards, &leftover_cards);
+  }
+  if(!sampled) {
+    sampled = try_sample(generator, false, &held_cards, &leftover_cards);
+  }
+  assert(sampled);
+
+  held_cards[m_observer] = m_position.held_cards(m_observer);
+
+  int unknown_card = m_position.unknown_card();
+  if(m_sample_unknown) {
+    CardMask picker_cards = held_cards[m_position.picker()];
+    std::uniform_int_distribution<int> distribution(0, mask_size(picker_cards) - 1);
+    unknown_card = mask_nth(picker_cards, distribution(generator));
+  }
+
+  CardMask discarded_cards = m_leftover_is_discard ? leftover_cards
+                                                   : m_position.discarded_cards();
+
+  TrickPosition position = m_position;
+  position.redeal(held_cards, discarded_cards, unknown_card);
+  return position;
+}
+
+} // namespace learning
@@ -0,0 +1,54 @@
+#ifndef DEEPSHEEP_LEARNING_DETERMINIZATION_H_
+#define DEEPSHEEP_LEARNING_DETERMINIZATION_H_
+
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+
+#include <random>
+
+namespace learning {
+
+/// Samples perfect-information positions consistent with what one player has seen.
+
+/** The observer's own cards and everything laid in tricks are kept. The
+ *  cards the observer has not seen are dealt out again to the other seats,
+ *  in the numbers they hold, and to the picker's discards. Seats that have
+ *  failed to follow a suit get no cards of that suit, the picker never gets
+ *  the called partner card, and when the observer doesn't know which of the
+ *  picker's cards is unknown, one of the picker's cards is chosen at random.
+ */
+class Determinizer
+{
+public:
+  //! Prepare to sample positions of a Hand, whose picking round is finished, as seen by observer.
+  Determinizer(const sheepshead::interface::Hand& hand,
+               const sheepshead::interface::PlayerId& observer);
+
+  //! Return a randomly sampled position.
+  TrickPosition sample(std::default_random_engine& generator) const;
+
+  //! The observer's seat.
+  int observer() const { return m_observer; }
+
+  //! The largest reward magnitude in the sampled positions.
+  int max_reward() const { return m_position.max_reward(); }
+
+private:
+  bool try_sample(std::default_random_engine& generator, bool use_voids,
+                  std::array<CardMask, TrickPosition::MAX_PLAYERS>* held_cards,
+                  CardMask* leftover_cards) const;
+
+  TrickPosition m_position;
+  int m_observer;
+  CardMask m_unseen;
+  int m_held_counts[TrickPosition::MAX_PLAYERS];
+  CardMask m_allowed[TrickPosition::MAX_PLAYERS];
+  CardMask m_leftover_allowed;
+  CardMask m_partner_restriction;
+  bool m_leftover_is_discard;
+  bool m_sample_unknown;
+
+}; // class Determinizer
+
+} // namespace learning
+#endif
@@ -0,0 +1,319 @@
+#include "double_dummy_solver.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace learning {
+
+namespace {
+
+const int TOTAL_POINTS = 120;
+const int LOWEST_BAND = -3;
+const int HIGHEST_BAND = 3;
+
+// Band results share a table with point results, under different keys.
+const uint64_t BAND_KEY_SALT = 0x6a09e667f3bcc909ULL;
+
+int cards_remaining(const TrickPosition& position)
+{
+  return position.number_of_players() * position.number_of_tricks() -
+         mask_size(position.played_cards());
+}
+
+} // namespace
+
+SolverResult::SolverResult()
+  : picking_team_points(0), defending_team_points(0), best_card(NO_CARD), nodes(0)
+{}
+
+template<typename Table_T>
+BasicDoubleDummySolver<Table_T>::BasicDoubleDummySolver(Table_T* table)
+  : m_table(table), m_tablebase(nullptr), m_merge_equivalent_moves(true), m_nodes(0)
+{}
+
+template<typename Table_T>
+SolverResult BasicDoubleDummySolver<Table_T>::solve(const sheepshead::interface::Hand& hand)
+{
+  return solve(TrickPosition(hand));
+}
+
+template<typename Table_T>
+SolverResult BasicDoubleDummySolver<Table_T>::solve(const TrickPosition& root)
+{
+  assert(!root.is_leasters());
+  m_nodes = 0;
+
+  TrickPosition position = root;
+  SolverResult result;
+
+  if(position.is_finished()) {
+    result.picking_team_points = position.picking_team_points();
+  } else {
+    // Search the first move with a full window and the rest against the best
+    // value so far, re-searching only when a move improves on it.
+    bool maximizing = position.on_picking_team(position.to_play());
+    int moves[NUMBER_OF_CARDS];
+    int number_of_moves = order_moves(position, moves);
+    int best_value = maximizing ? -1 : TOTAL_POINTS + 1;
+
+    for(int i = 0; i < number_of_moves; i++) {
+      position.make_move(moves[i]);
+      int value = 0;
+      if(maximizing) {
+        value = search(&position, best_value, TOTAL_POINTS + 1);
+      } else {
+        value = search(&position, -1, best_value);
+      }
+      position.unmake_move();
+
+      if(maximizing ? value > best_value : value < best_value) {
+        best_value = value;
+        result.best_card = moves[i];
+      }
+    }
+    result.picking_team_points = best_value;
+  }
+
+  result.defending_team_points = TOTAL_POINTS - result.picking_team_points;
+  result.nodes = m_nodes;
+  return result;
+}
+
+template<typename Table_T>
+int BasicDoubleDummySolver<Table_T>::search(TrickPosition* position, int alpha, int beta)
+{
+  m_nodes++;
+  if(position->is_finished()) return position->picking_team_points();
+
+  // Points already banked bound the result from both sides.
+  int banked = position->picking_team_points();
+  int lower = banked;
+  int upper = TOTAL_POINTS - position->defending_team_points();
+
+  // Table values are the points still to be won, so they hold whatever has
+  // been banked. The last trick is cheaper to search than to look up.
+  int remaining = cards_remaining(*position);
+  bool use_table = m_table && remaining > position->number_of_players();
+  int table_move = NO_CARD;
+  if(use_table) {
+    TranspositionEntry entry;
+    if(m_table->probe(position->cards_key(), &entry)) {
+      int value = banked + entry.value;
+      if(entry.bound == Bound::EXACT) return value;
+      if(entry.bound == Bound::LOWER) lower = std::max(lower, value);
+      if(entry.bound == Bound::UPPER) upper = std::min(upper, value);
+      table_move = entry.best_move;
+    }
+  }
+  if(lower >= beta) return lower;
+  if(upper <= alpha) return upper;
+
+  // The tablebase covers the starts of the last tricks.
+  int tablebase_points = 0;
+  if(m_tablebase && position->trick_size() == 0 && remaining > position->number_of_players() &&
+     m_tablebase->probe(*position, &tablebase_points)) {
+    return banked + tablebase_points;
+  }
+
+  bool maximizing = position->on_picking_team(position->to_play());
+  int moves[NUMBER_OF_CARDS];
+  int number_of_moves = order_moves(*position, moves);
+  for(int i = 1; i < number_of_moves && table_move != NO_CARD; i++) {
+    if(moves[i] == table_move) std::swap(moves[0], moves[i]);
+  }
+
+  int original_alpha = alpha;
+  int original_beta = beta;
+  int best_value = maximizing ? -1 : TOTAL_POINTS + 1;
+  int best_move = NO_CARD;
+  for(int i = 0; i < number_of_moves; i++) {
+    position->make_move(moves[i]);
+    int value = search(position, alpha, beta);
+    position->unmake_move();
+
+    if(maximizing ? value > best_value : value < best_value) {
+      best_value = value;
+      best_move = moves[i];
+    }
+    if(maximizing) {
+      alpha = std::max(alpha, value);
+    } else {
+      beta = std::min(beta, value);
+    }
+    if(alpha >= beta) break;
+  }
+
+  if(use_table) {
+    Bound bound = Bound::EXACT;
+    if(best_value <= original_alpha) bound = Bound::UPPER;
+    if(best_value >= original_beta) bound = Bound::LOWER;
+    m_table->store(position->cards_key(), best_value - banked, bound,
+                   remaining, best_move);
+  }
+  return best_value;
+}
+
+template<typename Table_T>
+bool BasicDoubleDummySolver<Table_T>::reaches(const TrickPosition& root, int points)
+{
+  assert(!root.is_leasters());
+  m_nodes = 0;
+  TrickPosition position = root;
+  return search(&position, points - 1, points) >= points;
+}
+
+template<typename Table_T>
+int BasicDoubleDummySolver<Table_T>::solve_band(const TrickPosition& root, int first_guess)
+{
+  assert(!root.is_leasters());
+  m_nodes = 0;
+  TrickPosition position = root;
+
+  int lower = LOWEST_BAND;
+  int upper = HIGHEST_BAND;
+  int guess = std::max(LOWEST_BAND, std::min(HIGHEST_BAND, first_guess));
+  while(lower < upper) {
+    int beta = guess == lower ? guess + 1 : guess;
+    guess = search_band(&position, beta - 1, beta);
+    if(guess < beta) {
+      upper = guess;
+    } else {
+      lower = guess;
+    }
+  }
+  return lower;
+}
+
+template<typename Table_T>
+int BasicDoubleDummySolver<Table_T>::search_band(TrickPosition* position, int alpha, int beta)
+{
+  m_nodes++;
+  if(position->is_finished()) return position->picking_team_band();
+
+  // The band can't fall below what the banked points and tricks guarantee,
+  // or rise above what the defenders' banked points and tricks allow.
+  int lower = position->picking_team_tricks() == 0 ?
+              LOWEST_BAND : TrickPosition::points_band(position->picking_team_points());
+  int upper = position->defending_team_tricks() == 0 ?
+              HIGHEST_BAND :
+              TrickPosition::points_band(TOTAL_POINTS - position->defending_team_points());
+
+  // Bands depend on what has been banked, so these entries use the full key.
+  int remaining = cards_remaining(*position);
+  bool use_table = m_table && remaining > position->number_of_players();
+  uint64_t key = position->key() ^ BAND_KEY_SALT;
+  int table_move = NO_CARD;
+  if(use_table) {
+    TranspositionEntry entry;
+    if(m_table->probe(key, &entry)) {
+      if(entry.bound == Bound::EXACT) return entry.value;
+      if(entry.bound == Bound::LOWER) lower = std::max(lower, static_cast<int>(entry.value));
+      if(entry.bound == Bound::UPPER) upper = std::min(upper, static_cast<int>(entry.value));
+      table_move = entry.best_move;
+    }
+  }
+  if(lower >= beta) return lower;
+  if(upper <= alpha) return upper;
+
+  bool maximizing = position->on_picking_team(position->to_play());
+  int moves[NUMBER_OF_CARDS];
+  int number_of_moves = order_moves(*position, moves);
+  for(int i = 1; i < number_of_moves && table_move != NO_CARD; i++) {
+    if(moves[i] == table_move) std::swap(moves[0], moves[i]);
+  }
+
+  int original_alpha = alpha;
+  int original_beta = beta;
+  int best_value = maximizing ? LOWEST_BAND - 1 : HIGHEST_BAND + 1;
+  int best_move = NO_CARD;
+  for(int i = 0; i < number_of_moves; i++) {
+    position->make_move(moves[i]);
+    int value = search_band(position, alpha, beta);
+    position->unmake_move();
+
+    if(maximizing ? value > best_value : value < best_value) {
+      best_value = value;
+      best_move = moves[i];
+    }
+    if(maximizing) {
+      alpha = std::max(alpha, value);
+    } else {
+      beta = std::min(beta, value);
+    }
+    if(alpha >= beta) break;
+  }
+
+  if(use_table) {
+    Bound bound = Bound::EXACT;
+    if(best_value <= original_alpha) bound = Bound::UPPER;
+    if(best_value >= original_beta) bound = Bound::LOWER;
+    m_table->store(key, best_value, bound, remaining, best_move);
+  }
+  return best_value;
+}
+
+template<typename Table_T>
+int BasicDoubleDummySolver<Table_T>::order_moves(const TrickPosition& position, int* moves) const
+{
+  CardMask legal = position.legal_moves();
+  if(m_merge_equivalent_moves) legal = position.distinct_moves(legal);
+  int number_of_moves = 0;
+  int scores[NUMBER_OF_CARDS];
+
+  int seat = position.to_play();
+  bool picking_team = position.on_picking_team(seat);
+
+  if(position.trick_size() == 0) {
+    // Leading: try the strongest cards first, they are most likely to take
+    // the trick and produce early cutoffs.
+    for(CardMask cards = legal; cards; cards &= cards - 1) {
+      int card = mask_first(cards);
+      int suit_bonus = position.effective_suit(card) == TrickPosition::TRUMP_SUIT ? 64 : 0;
+      scores[number_of_moves] = suit_bonus + position.strength(card);
+      moves[number_of_moves++] = card;
+    }
+  } else {
+    int led_suit = position.effective_suit(position.trick_card(0));
+    int winning_offset = position.trick_winning_offset();
+    int winning_card = position.trick_card(winning_offset);
+    int winning_seat = (position.leader() + winning_offset) % position.number_of_players();
+    int winning_score = position.trick_score(winning_card, led_suit);
+    bool teammate_winning = position.on_picking_team(winning_seat) == picking_team;
+
+    for(CardMask cards = legal; cards; cards &= cards - 1) {
+      int card = mask_first(cards);
+      int score = position.trick_score(card, led_suit);
+      int points = card_point_value(card);
+      if(teammate_winning) {
+        // Schmear points onto a trick the team is taking.
+        scores[number_of_moves] = 2 * points - (score > 0 ? score : 0) / 8;
+      } else if(score > winning_score) {
+        // Win as cheaply as possible, preferring to bring points along.
+        scores[number_of_moves] = 1000 + 2 * points - score;
+      } else {
+        // Can't win: throw off the fewest points.
+        scores[number_of_moves] = -100 - 2 * points - (score > 0 ? score : 0) / 8;
+      }
+      moves[number_of_moves++] = card;
+    }
+  }
+
+  // Insertion sort, best score first: there are never more than ten moves.
+  for(int i = 1; i < number_of_moves; i++) {
+    int card = moves[i];
+    int score = scores[i];
+    int j = i - 1;
+    for(; j >= 0 && scores[j] < score; j--) {
+      moves[j + 1] = moves[j];
+      scores[j + 1] = scores[j];
+    }
+    moves[j + 1] = card;
+    scores[j + 1] = score;
+  }
+  return number_of_moves;
+}
+
+template class BasicDoubleDummySolver<TranspositionTable>;
+template class BasicDoubleDummySolver<SharedTranspositionTable>;
+
+} // namespace learning
@@ -0,0 +1,99 @@
+#ifndef DEEPSHEEP_LEARNING_DOUBLEDUMMYSOLVER_H_
+#define DEEPSHEEP_LEARNING_DOUBLEDUMMYSOLVER_H_
+
+#include "learning/shared_transposition_table.h"
+#include "learning/tablebase.h"
+#include "learning/transposition_table.h"
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+
+namespace learning {
+
+/// The outcome of solving a position with every card visible.
+struct SolverResult
+{
+  SolverResult();
+
+  //! Points the picking team takes with best play by both teams, discards included.
+  int picking_team_points;
+  //! Points the defending team takes.
+  int defending_team_points;
+  //! A best card for the player to move, or NO_CARD if the position is finished.
+  int best_card;
+  //! The number of positions searched.
+  long long nodes;
+};
+
+/// An alpha-beta solver for trick play with perfect information.
+
+/** The picking team, the picker and the holder of the partner card as in
+ *  History::partner(), plays to maximize its card points, and the defenders
+ *  play to minimize them. Leasters positions have no teams and can't be
+ *  solved.
+ *
+ *  With a table the solver stores what is still to be won from each
+ *  position, so transposed play orders are searched once. The table is not
+ *  owned, and its owner decides when to call new_search(). Table_T is
+ *  TranspositionTable for a table used by one solver at a time, or
+ *  SharedTranspositionTable for one shared by solvers on several threads.
+ */
+template<typename Table_T>
+class BasicDoubleDummySolver
+{
+public:
+  explicit BasicDoubleDummySolver(Table_T* table = nullptr);
+
+  //! Whether to search only one of each set of equivalent cards, as
+  //! TrickPosition::distinct_moves() finds them. On by default.
+  void set_merge_equivalent_moves(bool merge) { m_merge_equivalent_moves = merge; }
+
+  //! Look up the last tricks of point searches in a tablebase. Not owned.
+  void set_tablebase(const Tablebase* tablebase) { m_tablebase = tablebase; }
+
+  //! Solve a position where the picker is known.
+  SolverResult solve(const TrickPosition& position);
+
+  //! Solve the trick play of a Hand whose picking round is finished.
+  SolverResult solve(const sheepshead::interface::Hand& hand);
+
+  //! Whether the picking team can take at least points with best play.
+
+  //! A single null-window search, much cheaper than solving exactly.
+  bool reaches(const TrickPosition& position, int points);
+
+  /// The reward band the picking team finishes in with best play.
+
+  //! Bands are TrickPosition::picking_team_band() values, and both teams play
+  //! for the band rather than for points, so taking or denying a trick
+  //! matters as much as the points do. Found with MTD(f): null-window
+  //! searches starting from first_guess until the bounds meet.
+  int solve_band(const TrickPosition& position, int first_guess = 1);
+
+  //! The number of positions searched by the last solve, reaches or solve_band.
+  long long nodes() const { return m_nodes; }
+
+  //! The picking team's final points from a position, searched within (alpha, beta).
+
+  //! Fail-soft: a result at or below alpha is an upper bound and a result at
+  //! or above beta is a lower bound. The position is restored before returning.
+  int search(TrickPosition* position, int alpha, int beta);
+
+  //! The picking team's final band from a position, searched within (alpha, beta).
+  int search_band(TrickPosition* position, int alpha, int beta);
+
+private:
+  //! Fill moves with the legal cards, most promising first; return how many.
+  int order_moves(const TrickPosition& position, int* moves) const;
+
+  Table_T* m_table;
+  const Tablebase* m_tablebase;
+  bool m_merge_equivalent_moves;
+  long long m_nodes;
+
+}; // class BasicDoubleDummySolver
+
+typedef BasicDoubleDummySolver<TranspositionTable> DoubleDummySolver;
+typedef BasicDoubleDummySolver<SharedTranspositionTable> SharedDoubleDummySolver;
+
+} // namespace learning
+#endif
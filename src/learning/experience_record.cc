@@ -0,0 +1,193 @@
+#include "experience_record.h"
+
+#include "learning/trick_position.h"
+
+#include <cstring>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+using sheepshead::interface::PlayerId;
+
+namespace learning {
+
+Observation observe(const Hand& hand, const PlayerId& observer)
+{
+  Observation observation;
+  memset(&observation, 0, sizeof(observation));
+
+  auto rules = hand.rules();
+  observation.seat = seat_index(hand, observer);
+  observation.number_of_players = rules.number_of_players();
+  observation.trump_is_clubs = rules.trump_is_clubs();
+  observation.turn = static_cast<uint8_t>(hand.current_turn());
+  observation.leader = -1;
+  observation.picker = -1;
+  observation.partner_card = NO_CARD;
+  for(auto& card : observation.trick_cards) card = NO_CARD;
+
+  auto seat = hand.seat(observer);
+  for(auto card = seat.held_cards_begin(); card != seat.held_cards_end(); ++card) {
+    observation.held_cards |= card_bit(card_index(*card));
+  }
+
+  auto history = hand.history();
+  auto picking_round = history.picking_round();
+  if(picking_round.is_null() || !picking_round.is_started()) return observation;
+
+  if(!picking_round.picker()->is_null()) {
+    observation.picker = seat_index(hand, *picking_round.picker());
+  }
+  auto partner_card = picking_round.partner_card();
+  if(!partner_card.is_null()) observation.partner_card = card_index(partner_card);
+  if(observation.picker == observation.seat) {
+    for(auto& card : picking_round.discarded_cards()) {
+      observation.discarded_cards |= card_bit(card_index(card));
+    }
+  }
+
+  for(auto trick_itr = history.tricks_begin(); trick_itr != history.tricks_end(); ++trick_itr) {
+    CardMask trick = 0;
+    int laid = 0;
+    for(auto card_itr = trick_itr->laid_cards_begin();
+             card_itr != trick_itr->laid_cards_end();
+             ++card_itr) {
+      int card = card_index(*card_itr);
+      trick |= card_bit(card);
+      if(!trick_itr->is_finished()) observation.trick_cards[laid++] = card;
+    }
+    if(trick_itr->is_finished()) {
+      observation.played_cards |= trick;
+    } else {
+      observation.leader = seat_index(hand, *trick_itr->leader());
+    }
+  }
+  return observation;
+}
+
+Observation observe(const TrickPosition& position, int observer)
+{
+  Observation observation;
+  memset(&observation, 0, sizeof(observation));
+
+  observation.seat = observer;
+  observation.number_of_players = position.number_of_players();
+  observation.trump_is_clubs = position.trump_is_clubs();
+  // Hand::current_turn() only has turn types for the first four tricks,
+  // and reports PICK after them until the hand is finished.
+  int finished_tricks = position.number_of_finished_tricks();
+  if(position.is_finished()) {
+    observation.turn = static_cast<uint8_t>(Hand::TurnType::FINISHED);
+  } else if(finished_tricks < 4) {
+    observation.turn = static_cast<uint8_t>(
+        static_cast<int>(Hand::TurnType::TRICK_0) + finished_tricks);
+  } else {
+    observation.turn = static_cast<uint8_t>(Hand::TurnType::PICK);
+  }
+  observation.held_cards = position.held_cards(observer);
+  observation.picker = position.picker();
+  observation.partner_card = position.partner_card();
+  if(position.picker() == observer) observation.discarded_cards = position.discarded_cards();
+
+  CardMask trick = 0;
+  for(int i = 0; i < TrickPosition::MAX_PLAYERS; i++) {
+    observation.trick_cards[i] = i < position.trick_size() ? position.trick_card(i) : NO_CARD;
+    if(i < position.trick_size()) trick |= card_bit(position.trick_card(i));
+  }
+  observation.played_cards = position.played_cards() & ~trick;
+  observation.leader = position.is_finished() ? -1 : position.leader();
+  return observation;
+}
+
+ActionId encode_action(const Play& play)
+{
+  ActionId action;
+  memset(&action, 0, sizeof(action));
+  action.play_type = static_cast<uint8_t>(play.play_type());
+  switch(play.play_type()) {
+    case Play::PlayType::PICK:
+      action.value = static_cast<uint32_t>(*play.pick_decision());
+      break;
+    case Play::PlayType::LONER:
+      action.value = static_cast<uint32_t>(*play.loner_decision());
+      break;
+    case Play::PlayType::PARTNER:
+      action.value = card_index(*play.partner_decision());
+      break;
+    case Play::PlayType::UNKNOWN:
+      action.value = 8 * card_index(play.unknown_decision()->first) +
+                     static_cast<uint32_t>(play.unknown_decision()->second);
+      break;
+    case Play::PlayType::DISCARD:
+      for(auto& card : *play.discard_decision()) action.value |= card_bit(card_index(card));
+      break;
+    case Play::PlayType::TRICK_CARD:
+      action.value = card_index(*play.trick_card_decision());
+      break;
+  }
+  return action;
+}
+
+int find_action(const std::vector<Play>& available_plays, const ActionId& action)
+{
+  for(size_t i = 0; i < available_plays.size(); i++) {
+    ActionId candidate = encode_action(available_plays[i]);
+    if(candidate.play_type == action.play_type && candidate.value == action.value) return i;
+  }
+  return -1;
+}
+
+int record_hand(const Policy& policy, Hand* hand, std::default_random_engine& generator,
+                std::vector<ExperienceRecord>* records)
+{
+  std::vector<const Policy*> seat_policies(hand->rules().number_of_players(), &policy);
+  return record_hand(seat_policies, hand, generator, records);
+}
+
+int record_hand(const std::vector<const Policy*>& seat_policies, Hand* hand,
+                std::default_random_engine& generator, std::vector<ExperienceRecord>* records,
+                int recorded_seat)
+{
+  // Each seat's last record waits for its next observation.
+  const int no_record = -1;
+  int pending[TrickPosition::MAX_PLAYERS];
+  for(auto& index : pending) index = no_record;
+  size_t first_record = records->size();
+
+  while(!hand->is_finished()) {
+    if(hand->is_arbitrable()) {
+      hand->arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand->current_player();
+    int seat = seat_index(*hand, player);
+    auto play = seat_policies[seat]->choose_play(*hand, generator);
+    if(recorded_seat >= 0 && seat != recorded_seat) {
+      hand->playmaker(player).make_play(play);
+      continue;
+    }
+
+    auto observation = observe(*hand, player);
+    if(pending[seat] != no_record) (*records)[pending[seat]].next_observation = observation;
+
+    ExperienceRecord record;
+    memset(&record, 0, sizeof(record));
+    record.observation = observation;
+    record.action = encode_action(play);
+    pending[seat] = records->size();
+    records->push_back(record);
+
+    hand->playmaker(player).make_play(play);
+  }
+
+  for(int seat = 0; seat < hand->rules().number_of_players(); seat++) {
+    if(pending[seat] == no_record) continue;
+    auto player = player_at_seat(*hand, seat);
+    auto& record = (*records)[pending[seat]];
+    record.next_observation = observe(*hand, player);
+    record.reward = hand->reward(player);
+    record.done = 1;
+  }
+  return records->size() - first_record;
+}
+
+} // namespace learning
@@ -0,0 +1,110 @@
+#ifndef DEEPSHEEP_LEARNING_EXPERIENCERECORD_H_
+#define DEEPSHEEP_LEARNING_EXPERIENCERECORD_H_
+
+#include "learning/card_mask.h"
+#include "learning/policy.h"
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/playmaker.h"
+
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace learning {
+
+/// What one player can see of a hand, in 24 bytes.
+
+//! Seats count from the dealer, as seat_index() does, and -1 or NO_CARD
+//! mean not known or not yet decided.
+struct Observation
+{
+  CardMask held_cards;
+  //! Every card laid in finished tricks.
+  CardMask played_cards;
+  //! The picker's discards, only if the observer is the picker.
+  CardMask discarded_cards;
+  //! The current trick in the order laid, padded with NO_CARD.
+  int8_t trick_cards[5];
+  int8_t seat;
+  //! The seat leading the current trick, or -1 before the first trick starts.
+  int8_t leader;
+  int8_t picker;
+  int8_t partner_card;
+  //! The Hand::TurnType of the hand when observed.
+  uint8_t turn;
+  uint8_t number_of_players;
+  uint8_t trump_is_clubs;
+};
+
+/// A play, independent of the Hand it was made in.
+struct ActionId
+{
+  //! The Play::PlayType.
+  uint8_t play_type;
+  uint8_t reserved[3];
+  //! The decision for picking and going alone, the card index for partner
+  //! and trick cards, the card index times 8 plus the suit for unknown
+  //! cards, and the mask of the cards for discards.
+  uint32_t value;
+};
+
+/// One transition, owning everything it describes, in one 64-byte line.
+
+/** Records are plain data: they can be copied with memcpy, stored in
+ *  contiguous buffers and files, and kept for as long as needed. The
+ *  observations are what the acting player could see when making the play
+ *  and at their next play. The reward is 0 until the last play a player
+ *  makes, which gets their reward for the hand and is done.
+ */
+struct ExperienceRecord
+{
+  Observation observation;
+  Observation next_observation;
+  ActionId action;
+  float reward;
+  uint8_t done;
+  uint8_t reserved[3];
+};
+
+static_assert(std::is_trivially_copyable<ExperienceRecord>::value,
+              "ExperienceRecord must be trivially copyable");
+static_assert(sizeof(ExperienceRecord) == 64, "ExperienceRecord should be 64 bytes");
+
+/// Encode what a player can see of a Hand.
+Observation observe(const sheepshead::interface::Hand& hand,
+                    const sheepshead::interface::PlayerId& observer);
+
+/// Encode what a seat can see of a TrickPosition.
+
+//! The observation is the one the Hand the position came from would give
+//! the seat: its own cards, the cards laid, and the picker's discards only
+//! to the picker. For encoding search positions the same way as recorded
+//! ones.
+Observation observe(const TrickPosition& position, int observer);
+
+/// Encode a play.
+ActionId encode_action(const sheepshead::interface::Play& play);
+
+/// The index of the play with an ActionId among available plays, or -1.
+int find_action(const std::vector<sheepshead::interface::Play>& available_plays,
+                const ActionId& action);
+
+/// Play a Hand to the end with policy, appending a record of every play made.
+
+//! Returns the number of records added.
+int record_hand(const Policy& policy, sheepshead::interface::Hand* hand,
+                std::default_random_engine& generator, std::vector<ExperienceRecord>* records);
+
+/// Play a Hand to the end with a policy for each seat, recording one seat's plays.
+
+//! seat_policies has one policy per seat, counting from the dealer. Only
+//! recorded_seat's plays are appended, or every seat's if it is -1.
+//! Returns the number of records added.
+int record_hand(const std::vector<const Policy*>& seat_policies,
+                sheepshead::interface::Hand* hand, std::default_random_engine& generator,
+                std::vector<ExperienceRecord>* records, int recorded_seat = -1);
+
+} // namespace learning
+#endif
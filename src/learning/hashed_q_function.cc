@@ -0,0 +1,158 @@
+#include "hashed_q_function.h"
+
+#include "learning/card_mask.h"
+#include "learning/deal_stream.h"
+#include "learning/trick_position.h"
+
+#include <utility>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace learning {
+
+HashedQFunction::HashedQFunction(size_t megabytes, unsigned features, float learning_rate)
+  : m_features(features), m_learning_rate(learning_rate), m_table(megabytes)
+{}
+
+uint64_t HashedQFunction::state_key(const Hand& state) const
+{
+  auto player = state.current_player();
+  auto seat = state.seat(player);
+  uint64_t hash = mix_seed(0, m_features);
+
+  if(m_features & (TRUMP_COUNT | HELD_CARDS)) {
+    int trump_count = 0;
+    CardMask held = 0;
+    for(auto card = seat.held_cards_begin(); card != seat.held_cards_end(); ++card) {
+      if(card->is_trump()) trump_count++;
+      held |= card_bit(card_index(*card));
+    }
+    if(m_features & TRUMP_COUNT) hash = mix_seed(hash, trump_count);
+    if(m_features & HELD_CARDS) hash = mix_seed(hash, held);
+  }
+  if(m_features & SEAT) hash = mix_seed(hash, seat_index(state, player));
+
+  unsigned trick_features = ROLE | TRICK_NUMBER | TRICK_CARDS | PLAYED_CARDS;
+  // Hand::current_turn() has no turn types past the fourth trick, so ask
+  // the picking round instead.
+  if((m_features & trick_features) && state.history().picking_round().is_finished()) {
+    TrickPosition position(state);
+    int me = position.to_play();
+    if(m_features & ROLE) {
+      // The partner has known since the deal; nobody else is told.
+      int role = 0;
+      if(position.is_leasters()) {
+        role = 3;
+      } else if(me == position.picker()) {
+        role = 1;
+      } else if(me == position.partner()) {
+        role = 2;
+      }
+      hash = mix_seed(hash, role);
+    }
+    if(m_features & TRICK_NUMBER) hash = mix_seed(hash, position.number_of_finished_tricks());
+    if(m_features & (TRICK_CARDS | PLAYED_CARDS)) {
+      CardMask trick = 0;
+      for(int i = 0; i < position.trick_size(); i++) trick |= card_bit(position.trick_card(i));
+      if(m_features & TRICK_CARDS) hash = mix_seed(hash, trick);
+      if(m_features & PLAYED_CARDS) hash = mix_seed(hash, position.played_cards() & ~trick);
+    }
+  }
+  return hash;
+}
+
+uint64_t HashedQFunction::key(uint64_t state_key, const Play& play) const
+{
+  uint64_t decision = 0;
+  switch(play.play_type()) {
+    case Play::PlayType::PICK:
+      decision = static_cast<uint64_t>(*play.pick_decision());
+      break;
+    case Play::PlayType::LONER:
+      decision = static_cast<uint64_t>(*play.loner_decision());
+      break;
+    case Play::PlayType::PARTNER:
+      decision = card_index(*play.partner_decision());
+      break;
+    case Play::PlayType::UNKNOWN:
+      decision = card_index(play.unknown_decision()->first) +
+                 NUMBER_OF_CARDS * static_cast<uint64_t>(play.unknown_decision()->second);
+      break;
+    case Play::PlayType::DISCARD:
+      for(auto& card : *play.discard_decision()) decision |= card_bit(card_index(card));
+      break;
+    case Play::PlayType::TRICK_CARD:
+      decision = card_index(*play.trick_card_decision());
+      break;
+  }
+  return mix_seed(mix_seed(state_key, static_cast<uint64_t>(play.play_type())), decision);
+}
+
+uint64_t HashedQFunction::key(const Hand& state, const Play& play) const
+{
+  return key(state_key(state), play);
+}
+
+float HashedQFunction::evaluate(uint64_t key) const
+{
+  float value = 0;
+  m_table.find(key, &value);
+  return value;
+}
+
+float HashedQFunction::evaluate(const Hand& state, const Play& play) const
+{
+  return evaluate(key(state, play));
+}
+
+void HashedQFunction::update(uint64_t key, float reward)
+{
+  m_table.update(key, reward, m_learning_rate);
+}
+
+int learn_from_hand(HashedQFunction* q_function, Hand* hand, float exploration,
+                    std::default_random_engine& generator)
+{
+  std::uniform_real_distribution<float> explore(0, 1);
+  std::vector<std::pair<sheepshead::interface::PlayerId, uint64_t>> decisions;
+
+  while(!hand->is_finished()) {
+    if(hand->is_arbitrable()) {
+      hand->arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand->current_player();
+    auto available_plays = hand->available_plays(player);
+    uint64_t state_key = q_function->state_key(*hand);
+
+    size_t chosen = 0;
+    uint64_t chosen_key = 0;
+    if(exploration > 0 && explore(generator) < exploration) {
+      std::uniform_int_distribution<size_t> distribution(0, available_plays.size() - 1);
+      chosen = distribution(generator);
+      chosen_key = q_function->key(state_key, available_plays[chosen]);
+    } else {
+      float best_value = 0;
+      for(size_t i = 0; i < available_plays.size(); i++) {
+        uint64_t key = q_function->key(state_key, available_plays[i]);
+        float value = q_function->evaluate(key);
+        if(i == 0 || value > best_value) {
+          chosen = i;
+          chosen_key = key;
+          best_value = value;
+        }
+      }
+    }
+    decisions.push_back(std::make_pair(player, chosen_key));
+    hand->playmaker(player).make_play(available_plays[chosen]);
+  }
+
+  for(auto& decision : decisions) {
+    q_function->update(decision.second, hand->reward(decision.first));
+  }
+  return decisions.size();
+}
+
+} // namespace learning
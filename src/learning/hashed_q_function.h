@@ -0,0 +1,82 @@
+#ifndef DEEPSHEEP_LEARNING_HASHEDQFUNCTION_H_
+#define DEEPSHEEP_LEARNING_HASHEDQFUNCTION_H_
+
+#include "learning/q_table.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/playmaker.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace learning {
+
+/// Action values for every kind of play, keyed by a hash of chosen state features.
+
+/** A state and play are reduced to a 64-bit key: the features selected when
+ *  the function is built, describing what the player to act can see, are
+ *  hashed together with the play type and the play itself. Values are kept
+ *  in a QTable of bounded size, so the feature set can be as fine as memory
+ *  allows and rarely seen keys give way to common ones.
+ *
+ *  Trick features only apply to trick card plays. The other plays happen
+ *  once each in a fixed order, so their type already says where the hand is.
+ */
+class HashedQFunction
+{
+public:
+  //! State features to key values by, or'd together.
+  enum Feature : unsigned
+  {
+    TRUMP_COUNT  = 1 << 0, //!< How many trump the player holds.
+    HELD_CARDS   = 1 << 1, //!< Exactly which cards the player holds.
+    SEAT         = 1 << 2, //!< The player's seat, counting from the dealer.
+    ROLE         = 1 << 3, //!< Whether the player picked or is known to be partner.
+    TRICK_NUMBER = 1 << 4, //!< How many tricks are finished.
+    TRICK_CARDS  = 1 << 5, //!< The cards laid so far in the current trick.
+    PLAYED_CARDS = 1 << 6  //!< Every card laid in finished tricks.
+  };
+  static const unsigned DEFAULT_FEATURES =
+    TRUMP_COUNT | SEAT | ROLE | TRICK_NUMBER | TRICK_CARDS;
+
+  //! Construct a function with about megabytes of table, keyed by features.
+  explicit HashedQFunction(size_t megabytes, unsigned features = DEFAULT_FEATURES,
+                           float learning_rate = 0.05);
+
+  unsigned features() const { return m_features; }
+
+  //! The hash of the selected features of a playable state, for its current player.
+  uint64_t state_key(const sheepshead::interface::Hand& state) const;
+  //! The key of a play from a state with state_key.
+  uint64_t key(uint64_t state_key, const sheepshead::interface::Play& play) const;
+  uint64_t key(const sheepshead::interface::Hand& state,
+               const sheepshead::interface::Play& play) const;
+
+  //! The learned value of a key, 0 if it has never been updated.
+  float evaluate(uint64_t key) const;
+  float evaluate(const sheepshead::interface::Hand& state,
+                 const sheepshead::interface::Play& play) const;
+
+  //! Move the value of a key towards a reward.
+  void update(uint64_t key, float reward);
+
+  const QTable& table() const { return m_table; }
+
+private:
+  unsigned m_features;
+  float m_learning_rate;
+  QTable m_table;
+
+}; // class HashedQFunction
+
+/// Play a hand to the end with every decision epsilon-greedy by q_function, then learn from it.
+
+//! Each play is chosen at random with probability exploration, and
+//! otherwise is the one with the highest value. Once the hand is finished,
+//! the key of every play made is updated towards the reward of the player
+//! who made it. Returns the number of plays learned from.
+int learn_from_hand(HashedQFunction* q_function, sheepshead::interface::Hand* hand,
+                    float exploration, std::default_random_engine& generator);
+
+} // namespace learning
+#endif
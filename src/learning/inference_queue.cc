@@ -0,0 +1,175 @@
+#include "inference_queue.h"
+
+#include <algorithm>
+#include <cassert>
+#include <thread>
+
+using sheepshead::interface::Play;
+
+namespace learning {
+
+InferenceQueueConfig::InferenceQueueConfig()
+  : max_batch_size(64), max_wait_microseconds(200), yield(false)
+{}
+
+InferenceStats::InferenceStats()
+  : requests(0), batches(0), full_batches(0), mean_fill(0),
+    mean_latency_microseconds(0), max_latency_microseconds(0)
+{}
+
+InferenceQueue::InferenceQueue(int input_size, int output_size, BatchEvaluator evaluator,
+                               const InferenceQueueConfig& config)
+  : m_input_size(input_size), m_output_size(output_size), m_evaluator(evaluator),
+    m_config(config), m_next_id(0)
+{
+  assert(input_size > 0 && output_size > 0 && config.max_batch_size > 0);
+  reset_stats();
+  std::unique_lock<std::mutex> lock(m_mutex);
+  take_open_batch();
+}
+
+std::unique_ptr<InferenceQueue::Batch> InferenceQueue::take_open_batch()
+{
+  std::unique_ptr<Batch> batch;
+  if(!m_spare.empty()) {
+    batch = std::move(m_spare.back());
+    m_spare.pop_back();
+  } else {
+    batch.reset(new Batch());
+    batch->inputs.resize(m_config.max_batch_size * m_input_size);
+    batch->outputs.resize(m_config.max_batch_size * m_output_size);
+    batch->destinations.resize(m_config.max_batch_size);
+    batch->finished.resize(m_config.max_batch_size);
+  }
+  batch->id = m_next_id++;
+  batch->size = 0;
+  std::swap(batch, m_open);
+  return batch;
+}
+
+void InferenceQueue::run(std::unique_ptr<Batch> batch, std::unique_lock<std::mutex>* lock)
+{
+  lock->unlock();
+  m_evaluator(batch->inputs.data(), batch->size, batch->outputs.data());
+  lock->lock();
+
+  for(int i = 0; i < batch->size; i++) {
+    std::copy(&batch->outputs[i * m_output_size], &batch->outputs[(i + 1) * m_output_size],
+              batch->destinations[i]);
+    *batch->finished[i] = true;
+  }
+  m_batches++;
+  m_batched_requests += batch->size;
+  if(batch->size == m_config.max_batch_size) m_full_batches++;
+  m_spare.push_back(std::move(batch));
+  m_batch_finished.notify_all();
+}
+
+void InferenceQueue::evaluate(const float* input, float* output)
+{
+  auto submitted = std::chrono::steady_clock::now();
+  bool finished = false;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  Batch* batch = m_open.get();
+  if(batch->size == 0) batch->opened = submitted;
+  int slot = batch->size++;
+  std::copy(input, input + m_input_size, &batch->inputs[slot * m_input_size]);
+  batch->destinations[slot] = output;
+  batch->finished[slot] = &finished;
+  uint64_t id = batch->id;
+  auto deadline = batch->opened + std::chrono::microseconds(m_config.max_wait_microseconds);
+
+  if(batch->size == m_config.max_batch_size) run(take_open_batch(), &lock);
+  while(!finished) {
+    // Until someone takes the batch, the wait ending is this thread's cue.
+    bool still_open = m_open->id == id;
+    if(still_open && std::chrono::steady_clock::now() >= deadline) {
+      run(take_open_batch(), &lock);
+    } else if(m_config.yield) {
+      lock.unlock();
+      std::this_thread::yield();
+      lock.lock();
+    } else if(still_open) {
+      m_batch_finished.wait_until(lock, deadline);
+    } else {
+      m_batch_finished.wait(lock);
+    }
+  }
+
+  std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - submitted;
+  m_requests++;
+  m_total_latency += latency.count();
+  m_max_latency = std::max(m_max_latency, latency.count());
+}
+
+InferenceStats InferenceQueue::stats() const
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  InferenceStats stats;
+  stats.requests = m_requests;
+  stats.batches = m_batches;
+  stats.full_batches = m_full_batches;
+  if(m_batches > 0) {
+    stats.mean_fill = static_cast<double>(m_batched_requests) /
+                      (m_batches * m_config.max_batch_size);
+  }
+  if(m_requests > 0) stats.mean_latency_microseconds = m_total_latency / m_requests;
+  stats.max_latency_microseconds = m_max_latency;
+  return stats;
+}
+
+void InferenceQueue::reset_stats()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_requests = 0;
+  m_batches = 0;
+  m_full_batches = 0;
+  m_batched_requests = 0;
+  m_total_latency = 0;
+  m_max_latency = 0;
+}
+
+InferenceQueue::BatchEvaluator mlp_evaluator(const Mlp* mlp)
+{
+  return [mlp](const float* inputs, int batch_size, float* outputs) {
+    static thread_local Mlp::Workspace workspace;
+    mlp->forward(inputs, batch_size, outputs, &workspace);
+  };
+}
+
+namespace {
+
+InferenceQueue::BatchEvaluator segment_evaluator(const LinearQFunction* q_function,
+                                                 LinearQFunction::Segment segment)
+{
+  return [q_function, segment](const float* inputs, int batch_size, float* outputs) {
+    for(int row = 0; row < batch_size; row++) {
+      const float* features = inputs + row * LinearQFunction::NUMBER_OF_FEATURES;
+      int active[LinearQFunction::NUMBER_OF_FEATURES];
+      int number_active = 0;
+      for(int feature = 0; feature < LinearQFunction::NUMBER_OF_FEATURES; feature++) {
+        if(features[feature] != 0) active[number_active++] = feature;
+      }
+      float* values = outputs + row * LinearQFunction::ACTION_SLOTS;
+      std::fill(values, values + LinearQFunction::ACTION_SLOTS, 0.0f);
+      q_function->evaluate_all(active, number_active, segment, values);
+    }
+  };
+}
+
+} // namespace
+
+InferenceQueue::BatchEvaluator linear_evaluator(const LinearQFunction* q_function,
+                                                Play::PlayType play_type)
+{
+  return segment_evaluator(q_function, LinearQFunction::segment(play_type));
+}
+
+InferenceQueue::BatchEvaluator linear_evaluator(const LinearQFunction* q_function)
+{
+  return segment_evaluator(q_function,
+                           LinearQFunction::Segment{0, LinearQFunction::ACTION_SLOTS});
+}
+
+} // namespace learning
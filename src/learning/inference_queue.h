@@ -0,0 +1,135 @@
+#ifndef DEEPSHEEP_LEARNING_INFERENCEQUEUE_H_
+#define DEEPSHEEP_LEARNING_INFERENCEQUEUE_H_
+
+#include "learning/linear_q_function.h"
+#include "learning/mlp.h"
+#include "sheepshead/interface/playmaker.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace learning {
+
+/// Options for an InferenceQueue.
+struct InferenceQueueConfig
+{
+  InferenceQueueConfig();
+
+  //! The most requests evaluated together.
+  int max_batch_size;
+  //! How long the first request of a batch waits for the batch to fill
+  //! before it is evaluated as it is, in microseconds.
+  int max_wait_microseconds;
+  //! Whether waiting threads spin, yielding the processor, instead of
+  //! sleeping. Spinning answers sooner when there are cores to spare.
+  bool yield;
+};
+
+/// What an InferenceQueue has done since it was built or its stats reset.
+struct InferenceStats
+{
+  InferenceStats();
+
+  long long requests;
+  long long batches;
+  //! Batches evaluated because they filled, rather than at the timeout.
+  long long full_batches;
+  //! The mean batch size as a fraction of max_batch_size.
+  double mean_fill;
+  //! From a request being submitted to its result being ready.
+  double mean_latency_microseconds;
+  double max_latency_microseconds;
+};
+
+/// Gathers single evaluations from many threads into batches.
+
+/** Search threads each need one leaf evaluated at a time, which leaves
+ *  most of a batched evaluator's SIMD width unused. Threads submit their
+ *  input to evaluate() and wait, and the inputs are gathered into a batch
+ *  until it holds max_batch_size of them or its first has waited
+ *  max_wait_microseconds. The thread that fills the batch, or that finds
+ *  the wait over, evaluates it for everyone, so there is no thread to
+ *  manage and nothing waits on a batch that nobody will run. Requests
+ *  arriving meanwhile start the next batch.
+ */
+class InferenceQueue
+{
+public:
+  //! Evaluate batch_size rows of inputs into rows of outputs. May be called
+  //! from several threads at once, on different batches.
+  typedef std::function<void(const float* inputs, int batch_size, float* outputs)> BatchEvaluator;
+
+  InferenceQueue(int input_size, int output_size, BatchEvaluator evaluator,
+                 const InferenceQueueConfig& config = InferenceQueueConfig());
+
+  InferenceQueue(const InferenceQueue&) = delete;
+  InferenceQueue& operator=(const InferenceQueue&) = delete;
+
+  int input_size() const { return m_input_size; }
+  int output_size() const { return m_output_size; }
+  const InferenceQueueConfig& config() const { return m_config; }
+
+  //! Evaluate input_size() floats into output_size() floats, with others.
+  void evaluate(const float* input, float* output);
+
+  InferenceStats stats() const;
+  void reset_stats();
+
+private:
+  struct Batch
+  {
+    uint64_t id;
+    int size;
+    std::chrono::steady_clock::time_point opened;
+    std::vector<float> inputs;
+    std::vector<float> outputs;
+    std::vector<float*> destinations;
+    std::vector<bool*> finished;
+  };
+
+  //! Replace the open batch with an empty one and return it. Call locked.
+  std::unique_ptr<Batch> take_open_batch();
+  //! Evaluate a taken batch unlocked, then hand out its results.
+  void run(std::unique_ptr<Batch> batch, std::unique_lock<std::mutex>* lock);
+
+  int m_input_size;
+  int m_output_size;
+  BatchEvaluator m_evaluator;
+  InferenceQueueConfig m_config;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_batch_finished;
+  std::unique_ptr<Batch> m_open;
+  std::vector<std::unique_ptr<Batch>> m_spare;
+  uint64_t m_next_id;
+
+  long long m_requests;
+  long long m_batches;
+  long long m_full_batches;
+  long long m_batched_requests;
+  double m_total_latency;
+  double m_max_latency;
+
+}; // class InferenceQueue
+
+/// Evaluate batches with a network, each calling thread with its own workspace.
+InferenceQueue::BatchEvaluator mlp_evaluator(const Mlp* mlp);
+
+/// Evaluate batches of encode_observation() inputs with a linear function.
+
+//! Each row of outputs gets LinearQFunction::ACTION_SLOTS values, those
+//! outside the segment for play_type zero.
+InferenceQueue::BatchEvaluator linear_evaluator(const LinearQFunction* q_function,
+                                                sheepshead::interface::Play::PlayType play_type);
+
+//! Each row of outputs gets every one of the LinearQFunction::ACTION_SLOTS
+//! values, whatever the play type the inputs were encoded for.
+InferenceQueue::BatchEvaluator linear_evaluator(const LinearQFunction* q_function);
+
+} // namespace learning
+#endif
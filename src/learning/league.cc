@@ -0,0 +1,225 @@
+#include "league.h"
+
+#include "learning/experience_record.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+
+namespace learning {
+
+namespace {
+
+// A learner's match against a member, and what came of it.
+struct Match
+{
+  int learner;
+  int opponent;
+  long long first_deal;
+  std::vector<ExperienceRecord> records;
+  //! Where each hand's records start in records.
+  std::vector<size_t> hand_offsets;
+  int reward;
+};
+
+} // namespace
+
+LeagueConfig::LeagueConfig()
+  : number_of_learners(1), matches_per_round(32), hands_per_match(10),
+    rounds_per_snapshot(5), max_population(20), matchmaking(Matchmaking::HARD),
+    pfsp_exponent(2), elo_k(16), learning_rate(0.05), exploration(0.1), lambda(0.8),
+    number_of_threads(std::max(1u, std::thread::hardware_concurrency())), seed(0),
+    deal_scheme(DealScheme::ROTATED)
+{}
+
+LeagueMember::LeagueMember()
+  : policy(nullptr), rating(1000), matches(0), fixed(false)
+{}
+
+LeagueRoundStats::LeagueRoundStats()
+  : round(0), hands(0), seconds(0), learner_reward(0), learner_score(0), spawned(0)
+{}
+
+double elo_expected_score(double rating, double opponent_rating)
+{
+  return 1 / (1 + std::pow(10.0, (opponent_rating - rating) / 400));
+}
+
+League::League(const sheepshead::interface::Rules& rules, const LeagueConfig& config)
+  : m_rules(rules), m_config(config),
+    m_seed(config.seed != 0 ? config.seed :
+           std::chrono::system_clock::now().time_since_epoch().count()),
+    m_deals(rules, m_seed, config.deal_scheme), m_rounds(0), m_next_deal(0)
+{
+  assert(config.number_of_learners > 0 && config.matches_per_round > 0);
+  assert(config.hands_per_match > 0 && config.rounds_per_snapshot > 0);
+  assert(config.max_population > 0 && config.number_of_threads > 0);
+  for(int learner = 0; learner < config.number_of_learners; learner++) {
+    Learner state;
+    state.q_function.reset(new LinearQFunction(config.learning_rate));
+    state.exploring_policy.reset(new LinearQPolicy(state.q_function.get(),
+                                                   config.exploration));
+    state.rating = 1000;
+    state.snapshots = 0;
+    m_learners.push_back(std::move(state));
+    spawn_snapshot(learner);
+  }
+}
+
+void League::add_fixed_member(const std::string& name, const Policy* policy, double rating)
+{
+  std::unique_ptr<LeagueMember> member(new LeagueMember());
+  member->name = name;
+  member->policy = policy;
+  member->rating = rating;
+  member->fixed = true;
+  m_population.push_back(std::move(member));
+}
+
+void League::spawn_snapshot(int learner)
+{
+  Learner& state = m_learners[learner];
+  std::unique_ptr<LeagueMember> member(new LeagueMember());
+  member->name = "learner" + std::to_string(learner) + "." + std::to_string(state.snapshots++);
+  member->q_function.reset(new LinearQFunction(*state.q_function));
+  member->owned_policy.reset(new LinearQPolicy(member->q_function.get()));
+  member->policy = member->owned_policy.get();
+  member->rating = state.rating;
+
+  if(static_cast<int>(m_population.size()) >= m_config.max_population) {
+    // Replace the weakest snapshot, if there is one to replace.
+    int weakest = -1;
+    for(size_t index = 0; index < m_population.size(); index++) {
+      if(m_population[index]->fixed) continue;
+      if(weakest < 0 || m_population[index]->rating < m_population[weakest]->rating) {
+        weakest = index;
+      }
+    }
+    if(weakest >= 0) {
+      m_population[weakest] = std::move(member);
+      return;
+    }
+  }
+  m_population.push_back(std::move(member));
+}
+
+int League::learner_seat(int hand) const
+{
+  return hand / m_deals.group_size() % m_rules.number_of_players();
+}
+
+std::vector<double> League::matchmaking_probabilities(int learner) const
+{
+  std::vector<double> weights(m_population.size());
+  double total = 0;
+  for(size_t index = 0; index < m_population.size(); index++) {
+    double p = elo_expected_score(m_learners[learner].rating, m_population[index]->rating);
+    switch(m_config.matchmaking) {
+      case Matchmaking::UNIFORM: weights[index] = 1; break;
+      case Matchmaking::HARD: weights[index] = std::pow(1 - p, m_config.pfsp_exponent); break;
+      case Matchmaking::VARIANCE: weights[index] = p * (1 - p); break;
+    }
+    total += weights[index];
+  }
+  for(double& weight : weights) {
+    weight = total > 0 ? weight / total : 1.0 / weights.size();
+  }
+  return weights;
+}
+
+LeagueRoundStats League::play_round()
+{
+  auto start = std::chrono::steady_clock::now();
+  int number_of_players = m_rules.number_of_players();
+
+  // Draw every match of the round before any is played, from a stream of
+  // seeds apart from the ones m_deals shuffles and plays with.
+  std::default_random_engine generator(mix_seed(mix_seed(m_seed, ~0UL), m_rounds));
+  std::vector<Match> matches;
+  for(int learner = 0; learner < static_cast<int>(m_learners.size()); learner++) {
+    auto probabilities = matchmaking_probabilities(learner);
+    std::discrete_distribution<int> draw(probabilities.begin(), probabilities.end());
+    for(int n = 0; n < m_config.matches_per_round; n++) {
+      Match match;
+      match.learner = learner;
+      match.opponent = draw(generator);
+      match.first_deal = m_next_deal;
+      match.reward = 0;
+      // Start every match on a new group of deals.
+      int group_size = m_deals.group_size();
+      m_next_deal += (m_config.hands_per_match + group_size - 1) / group_size * group_size;
+      matches.push_back(std::move(match));
+    }
+  }
+
+  std::atomic<int> next_match(0);
+  auto worker = [&]() {
+    std::vector<const Policy*> seat_policies(number_of_players);
+    for(int index = next_match++; index < static_cast<int>(matches.size());
+        index = next_match++) {
+      Match& match = matches[index];
+      const Policy* learner_policy = m_learners[match.learner].exploring_policy.get();
+      for(int h = 0; h < m_config.hands_per_match; h++) {
+        long long deal = match.first_deal + h;
+        int seat = learner_seat(h);
+        std::fill(seat_policies.begin(), seat_policies.end(),
+                  m_population[match.opponent]->policy);
+        seat_policies[seat] = learner_policy;
+        auto hand = m_deals.hand(deal);
+        std::default_random_engine play_generator(m_deals.play_seed(deal));
+        match.hand_offsets.push_back(match.records.size());
+        record_hand(seat_policies, &hand, play_generator, &match.records, seat);
+        match.reward += hand.reward(player_at_seat(hand, seat));
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int i = 0; i < m_config.number_of_threads; i++) threads.emplace_back(worker);
+  for(auto& thread : threads) thread.join();
+
+  LeagueRoundStats stats;
+  long long total_reward = 0;
+  double total_score = 0;
+  for(auto& match : matches) {
+    Learner& learner = m_learners[match.learner];
+    for(size_t h = 0; h < match.hand_offsets.size(); h++) {
+      size_t end = h + 1 < match.hand_offsets.size() ? match.hand_offsets[h + 1]
+                                                      : match.records.size();
+      learner.q_function->learn_hand(match.records.data() + match.hand_offsets[h],
+                                     end - match.hand_offsets[h], m_config.lambda);
+    }
+
+    LeagueMember& opponent = *m_population[match.opponent];
+    double score = match.reward > 0 ? 1 : match.reward == 0 ? 0.5 : 0;
+    double change = m_config.elo_k * (score - elo_expected_score(learner.rating,
+                                                                 opponent.rating));
+    learner.rating += change;
+    if(!opponent.fixed) opponent.rating -= change;
+    opponent.matches++;
+    total_reward += match.reward;
+    total_score += score;
+  }
+
+  m_rounds++;
+  if(m_rounds % m_config.rounds_per_snapshot == 0) {
+    for(int learner = 0; learner < static_cast<int>(m_learners.size()); learner++) {
+      spawn_snapshot(learner);
+      stats.spawned++;
+    }
+  }
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  stats.round = m_rounds;
+  stats.hands = static_cast<long long>(matches.size()) * m_config.hands_per_match;
+  stats.seconds = elapsed.count();
+  stats.learner_reward = static_cast<double>(total_reward) / stats.hands;
+  stats.learner_score = total_score / matches.size();
+  return stats;
+}
+
+} // namespace learning
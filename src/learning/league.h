@@ -0,0 +1,165 @@
+#ifndef DEEPSHEEP_LEARNING_LEAGUE_H_
+#define DEEPSHEEP_LEARNING_LEAGUE_H_
+
+#include "learning/deal_stream.h"
+#include "learning/linear_q_function.h"
+#include "learning/policy.h"
+#include "sheepshead/interface/rules.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace learning {
+
+/// How a learner's opponents are drawn from the population.
+enum class Matchmaking
+{
+  //! Every member equally often.
+  UNIFORM = 0,
+  //! Prioritized fictitious self-play: members in proportion to
+  //! (1 - p)^exponent, where p is the learner's expected score against
+  //! them, so the ones it doesn't yet beat come up most.
+  HARD = 1,
+  //! In proportion to p (1 - p), favoring even matches.
+  VARIANCE = 2
+};
+
+/// Options for a self-play league.
+struct LeagueConfig
+{
+  LeagueConfig();
+
+  int number_of_learners;
+  //! Matches each learner plays a round.
+  int matches_per_round;
+  //! Hands in a match. The learner keeps a seat through each group of
+  //! deals the deal scheme ties together, then moves to the next, so with
+  //! ROTATED it holds every hand of a group once. A multiple of the group
+  //! size keeps every group whole.
+  int hands_per_match;
+  //! Each learner joins the population as a frozen snapshot after every
+  //! this many rounds.
+  int rounds_per_snapshot;
+  //! The most members. A new snapshot past this replaces the lowest-rated
+  //! snapshot; fixed members stay.
+  int max_population;
+  Matchmaking matchmaking;
+  //! The exponent for HARD matchmaking.
+  float pfsp_exponent;
+  //! How far one match moves an Elo rating.
+  float elo_k;
+  float learning_rate;
+  //! The probability of a learner trying a random play.
+  float exploration;
+  //! The lambda for LinearQFunction::learn_hand().
+  float lambda;
+  //! The number of threads to play matches on.
+  int number_of_threads;
+  //! Seed for matchmaking, dealing and play. Zero means seed from the clock.
+  unsigned long seed;
+  DealScheme deal_scheme;
+};
+
+/// A policy in the population, with its rating.
+struct LeagueMember
+{
+  LeagueMember();
+
+  std::string name;
+  const Policy* policy;
+  double rating;
+  long long matches;
+  //! Set for members added with add_fixed_member(), which are never
+  //! replaced and whose ratings never move.
+  bool fixed;
+  //! A snapshot's frozen copy of a learner, and the greedy policy playing it.
+  std::unique_ptr<LinearQFunction> q_function;
+  std::unique_ptr<LinearQPolicy> owned_policy;
+};
+
+/// What happened in a round.
+struct LeagueRoundStats
+{
+  LeagueRoundStats();
+
+  int round;
+  long long hands;
+  double seconds;
+  //! The learners' mean reward per hand.
+  double learner_reward;
+  //! The learners' share of match points: 1 a win, a half a draw.
+  double learner_score;
+  //! Snapshots added this round.
+  int spawned;
+};
+
+/// The expected score, 0 to 1, of a player rated rating against one rated opponent_rating.
+double elo_expected_score(double rating, double opponent_rating);
+
+/// Train LinearQFunction learners against a growing population of their own snapshots.
+
+/** Each round, every learner is matched against members drawn from the
+ *  population by config.matchmaking, and plays each match's hands in one
+ *  seat, every other seat taken by the opponent, exploring as it goes. The
+ *  matches are played on a pool of threads with the learners frozen, then
+ *  every learner learns from its own plays and both sides' Elo ratings are
+ *  moved by the match result, one match at a time in schedule order. A
+ *  match is won by a positive total reward.
+ *
+ *  Every rounds_per_snapshot rounds each learner's weights are copied into
+ *  the population as a greedy member carrying its rating. Fixed members,
+ *  such as the heuristic policy, anchor the ratings and keep the learners
+ *  honest against play unlike their own. Results don't depend on
+ *  number_of_threads, only on seed.
+ */
+class League
+{
+public:
+  //! Start the learners from zero weights, each with a snapshot of itself
+  //! in the population.
+  League(const sheepshead::interface::Rules& rules, const LeagueConfig& config = LeagueConfig());
+
+  //! Add a member that never changes and is never replaced. policy isn't owned.
+  void add_fixed_member(const std::string& name, const Policy* policy, double rating = 1000);
+
+  LeagueRoundStats play_round();
+
+  //! The seat a learner takes for hand number hand of a match.
+  int learner_seat(int hand) const;
+  //! Deal numbers handed to matches so far. Each match starts on a new group.
+  long long deals_used() const { return m_next_deal; }
+
+  //! The probability of each member being drawn as learner's next opponent.
+  std::vector<double> matchmaking_probabilities(int learner) const;
+
+  int population_size() const { return m_population.size(); }
+  const LeagueMember& member(int index) const { return *m_population[index]; }
+  const LinearQFunction& learner(int index) const { return *m_learners[index].q_function; }
+  double learner_rating(int index) const { return m_learners[index].rating; }
+  int rounds() const { return m_rounds; }
+
+private:
+  struct Learner
+  {
+    std::unique_ptr<LinearQFunction> q_function;
+    std::unique_ptr<LinearQPolicy> exploring_policy;
+    double rating;
+    int snapshots;
+  };
+
+  void spawn_snapshot(int learner);
+
+  sheepshead::interface::Rules m_rules;
+  LeagueConfig m_config;
+  unsigned long m_seed;
+  DealStream m_deals;
+  std::vector<Learner> m_learners;
+  std::vector<std::unique_ptr<LeagueMember>> m_population;
+  int m_rounds;
+  long long m_next_deal;
+
+}; // class League
+
+} // namespace learning
+#endif
@@ -0,0 +1,611 @@
+#include "linear_q_function.h"
+
+#include "learning/trick_position.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#include <immintrin.h>
+
+using sheepshead::interface::Play;
+
+namespace learning {
+
+namespace {
+
+// Where each group of features starts.
+const int HELD_FEATURES = 0;
+const int PLAYED_FEATURES = 32;
+// 32 cards for each seat after the observer's, in the current trick.
+const int TRICK_FEATURES = 64;
+const int TRICK_PLACE_FEATURES = 192;
+const int TRICK_NUMBER_FEATURES = 197;
+const int ROLE_FEATURES = 207;
+const int PLAY_TYPE_FEATURES = 210;
+const int SEAT_FEATURES = 216;
+const int TRUMP_COUNT_FEATURES = 221;
+const int BIAS_FEATURE = 232;
+static_assert(BIAS_FEATURE + 1 == LinearQFunction::NUMBER_OF_FEATURES,
+              "feature groups should fill the feature space");
+
+// Where each kind of action's slots start.
+const int TRICK_SLOTS = 0;
+const int PARTNER_SLOTS = 32;
+const int UNKNOWN_SLOTS = 64;
+const int DISCARD_SLOTS = 96;
+const int PICK_SLOTS = 128;
+const int LONER_SLOTS = 130;
+
+const int ROW_ALIGNMENT = 32;
+static_assert(LinearQFunction::ACTION_SLOTS * sizeof(float) % ROW_ALIGNMENT == 0,
+              "rows should keep AVX2 alignment");
+
+CardMask trump_mask(bool trump_is_clubs)
+{
+  CardMask queens_and_jacks = 0x18181818;
+  return queens_and_jacks | (trump_is_clubs ? 0x00ff0000 : 0x000000ff);
+}
+
+int cards_in_blinds(int number_of_players)
+{
+  int cards_per_player = number_of_players == 3 ? 10 : number_of_players == 4 ? 7 : 6;
+  return NUMBER_OF_CARDS - number_of_players * cards_per_player;
+}
+
+// The kind of decision the observer faces. Observations are only made
+// inside a trick once the picking round is over.
+Play::PlayType decision_type(const Observation& observation)
+{
+  if(observation.leader >= 0) return Play::PlayType::TRICK_CARD;
+  return static_cast<Play::PlayType>(observation.turn);
+}
+
+void sum_rows_scalar(const float* weights, const int* active, int number_active,
+                     int begin, int end, float* values)
+{
+  for(int slot = begin; slot < end; slot++) values[slot] = 0;
+  for(int i = 0; i < number_active; i++) {
+    const float* row = weights + active[i] * LinearQFunction::ACTION_SLOTS;
+    for(int slot = begin; slot < end; slot++) values[slot] += row[slot];
+  }
+}
+
+// Four registers cover a card segment, so each row is read once.
+__attribute__((target("avx2")))
+void sum_rows_avx2(const float* weights, const int* active, int number_active,
+                   int begin, int end, float* values)
+{
+  int block = begin;
+  for(; block + 32 <= end; block += 32) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    for(int i = 0; i < number_active; i++) {
+      const float* row = weights + active[i] * LinearQFunction::ACTION_SLOTS + block;
+      sum0 = _mm256_add_ps(sum0, _mm256_load_ps(row));
+      sum1 = _mm256_add_ps(sum1, _mm256_load_ps(row + 8));
+      sum2 = _mm256_add_ps(sum2, _mm256_load_ps(row + 16));
+      sum3 = _mm256_add_ps(sum3, _mm256_load_ps(row + 24));
+    }
+    _mm256_storeu_ps(values + block, sum0);
+    _mm256_storeu_ps(values + block + 8, sum1);
+    _mm256_storeu_ps(values + block + 16, sum2);
+    _mm256_storeu_ps(values + block + 24, sum3);
+  }
+  for(; block < end; block += 8) {
+    __m256 sum = _mm256_setzero_ps();
+    for(int i = 0; i < number_active; i++) {
+      const float* row = weights + active[i] * LinearQFunction::ACTION_SLOTS + block;
+      sum = _mm256_add_ps(sum, _mm256_load_ps(row));
+    }
+    _mm256_storeu_ps(values + block, sum);
+  }
+}
+
+bool have_avx2()
+{
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+// The quantized kernels also convert half precision and fuse multiply-adds.
+bool have_avx2_f16c()
+{
+  static const bool supported = __builtin_cpu_supports("avx2") &&
+                                __builtin_cpu_supports("fma") &&
+                                __builtin_cpu_supports("f16c");
+  return supported;
+}
+
+void sum_int8_rows_scalar(const int8_t* weights, const float* scales, const int* active,
+                          int number_active, int begin, int end, float* values)
+{
+  for(int slot = begin; slot < end; slot++) values[slot] = 0;
+  for(int i = 0; i < number_active; i++) {
+    const int8_t* row = weights + active[i] * LinearQFunction::ACTION_SLOTS;
+    float scale = scales[active[i]];
+    for(int slot = begin; slot < end; slot++) values[slot] += scale * row[slot];
+  }
+}
+
+void sum_fp16_rows_scalar(const uint16_t* weights, const int* active, int number_active,
+                          int begin, int end, float* values)
+{
+  for(int slot = begin; slot < end; slot++) values[slot] = 0;
+  for(int i = 0; i < number_active; i++) {
+    const uint16_t* row = weights + active[i] * LinearQFunction::ACTION_SLOTS;
+    for(int slot = begin; slot < end; slot++) values[slot] += half_to_float(row[slot]);
+  }
+}
+
+__attribute__((target("avx2,fma")))
+inline __m256 widen_int8(const int8_t* weights)
+{
+  __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(weights));
+  return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(bytes));
+}
+
+__attribute__((target("avx2,f16c")))
+inline __m256 widen_fp16(const uint16_t* weights)
+{
+  return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(weights)));
+}
+
+// As sum_rows_avx2(), widening each row as it is read. Quantized rows
+// aren't 32-byte aligned, so they're read unaligned.
+__attribute__((target("avx2,fma")))
+void sum_int8_rows_avx2(const int8_t* weights, const float* scales, const int* active,
+                        int number_active, int begin, int end, float* values)
+{
+  int block = begin;
+  for(; block + 32 <= end; block += 32) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    for(int i = 0; i < number_active; i++) {
+      const int8_t* row = weights + active[i] * LinearQFunction::ACTION_SLOTS + block;
+      __m256 scale = _mm256_set1_ps(scales[active[i]]);
+      sum0 = _mm256_fmadd_ps(widen_int8(row), scale, sum0);
+      sum1 = _mm256_fmadd_ps(widen_int8(row + 8), scale, sum1);
+      sum2 = _mm256_fmadd_ps(widen_int8(row + 16), scale, sum2);
+      sum3 = _mm256_fmadd_ps(widen_int8(row + 24), scale, sum3);
+    }
+    _mm256_storeu_ps(values + block, sum0);
+    _mm256_storeu_ps(values + block + 8, sum1);
+    _mm256_storeu_ps(values + block + 16, sum2);
+    _mm256_storeu_ps(values + block + 24, sum3);
+  }
+  for(; block < end; block += 8) {
+    __m256 sum = _mm256_setzero_ps();
+    for(int i = 0; i < number_active; i++) {
+      const int8_t* row = weights + active[i] * LinearQFunction::ACTION_SLOTS + block;
+      sum = _mm256_fmadd_ps(widen_int8(row), _mm256_set1_ps(scales[active[i]]), sum);
+    }
+    _mm256_storeu_ps(values + block, sum);
+  }
+}
+
+__attribute__((target("avx2,f16c")))
+void sum_fp16_rows_avx2(const uint16_t* weights, const int* active, int number_active,
+                        int begin, int end, float* values)
+{
+  int block = begin;
+  for(; block + 32 <= end; block += 32) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    for(int i = 0; i < number_active; i++) {
+      const uint16_t* row = weights + active[i] * LinearQFunction::ACTION_SLOTS + block;
+      sum0 = _mm256_add_ps(sum0, widen_fp16(row));
+      sum1 = _mm256_add_ps(sum1, widen_fp16(row + 8));
+      sum2 = _mm256_add_ps(sum2, widen_fp16(row + 16));
+      sum3 = _mm256_add_ps(sum3, widen_fp16(row + 24));
+    }
+    _mm256_storeu_ps(values + block, sum0);
+    _mm256_storeu_ps(values + block + 8, sum1);
+    _mm256_storeu_ps(values + block + 16, sum2);
+    _mm256_storeu_ps(values + block + 24, sum3);
+  }
+  for(; block < end; block += 8) {
+    __m256 sum = _mm256_setzero_ps();
+    for(int i = 0; i < number_active; i++) {
+      const uint16_t* row = weights + active[i] * LinearQFunction::ACTION_SLOTS + block;
+      sum = _mm256_add_ps(sum, widen_fp16(row));
+    }
+    _mm256_storeu_ps(values + block, sum);
+  }
+}
+
+} // namespace
+
+const int LinearQFunction::NUMBER_OF_FEATURES;
+const int LinearQFunction::ACTION_SLOTS;
+const int LinearQFunction::MAX_ACTIVE_FEATURES;
+
+LinearQFunction::LinearQFunction(float learning_rate)
+  : m_learning_rate(learning_rate), m_weights(nullptr)
+{
+  allocate();
+  memset(m_weights, 0, NUMBER_OF_FEATURES * ACTION_SLOTS * sizeof(float));
+}
+
+LinearQFunction::LinearQFunction(const LinearQFunction& other)
+  : m_learning_rate(other.m_learning_rate), m_weights(nullptr)
+{
+  allocate();
+  *this = other;
+}
+
+LinearQFunction& LinearQFunction::operator=(const LinearQFunction& other)
+{
+  m_learning_rate = other.m_learning_rate;
+  memcpy(m_weights, other.m_weights, NUMBER_OF_FEATURES * ACTION_SLOTS * sizeof(float));
+  return *this;
+}
+
+void LinearQFunction::set_weights(const float* weights)
+{
+  memcpy(m_weights, weights, NUMBER_OF_FEATURES * ACTION_SLOTS * sizeof(float));
+}
+
+void LinearQFunction::allocate()
+{
+  // Over-allocate so the rows can start on an AVX2 boundary.
+  m_storage.reset(new char[NUMBER_OF_FEATURES * ACTION_SLOTS * sizeof(float) + ROW_ALIGNMENT]);
+  uintptr_t address = reinterpret_cast<uintptr_t>(m_storage.get());
+  address = (address + ROW_ALIGNMENT - 1) & ~static_cast<uintptr_t>(ROW_ALIGNMENT - 1);
+  m_weights = reinterpret_cast<float*>(address);
+}
+
+int LinearQFunction::active_features(const Observation& observation, Play::PlayType play_type,
+                                     int* active)
+{
+  int number_active = 0;
+  for(CardMask cards = observation.held_cards; cards; cards &= cards - 1) {
+    active[number_active++] = HELD_FEATURES + mask_first(cards);
+  }
+
+  if(play_type == Play::PlayType::TRICK_CARD) {
+    for(CardMask cards = observation.played_cards; cards; cards &= cards - 1) {
+      active[number_active++] = PLAYED_FEATURES + mask_first(cards);
+    }
+    int players = observation.number_of_players;
+    int place = 0;
+    for(; place < TrickPosition::MAX_PLAYERS && observation.trick_cards[place] != NO_CARD;
+        place++) {
+      int seat = (observation.leader + place) % players;
+      int relative_seat = (seat - observation.seat + players) % players;
+      if(relative_seat == 0) continue;
+      active[number_active++] = TRICK_FEATURES + 32 * (relative_seat - 1) +
+                                observation.trick_cards[place];
+    }
+    active[number_active++] = TRICK_PLACE_FEATURES + place;
+    int finished_tricks = mask_size(observation.played_cards) / players;
+    active[number_active++] = TRICK_NUMBER_FEATURES + std::min(finished_tricks, 9);
+    if(observation.picker < 0) active[number_active++] = ROLE_FEATURES + 2;
+  }
+
+  if(observation.picker >= 0 && observation.picker == observation.seat) {
+    active[number_active++] = ROLE_FEATURES;
+  }
+  if(observation.partner_card != NO_CARD &&
+     (observation.held_cards & card_bit(observation.partner_card))) {
+    active[number_active++] = ROLE_FEATURES + 1;
+  }
+  active[number_active++] = PLAY_TYPE_FEATURES + static_cast<int>(play_type);
+  active[number_active++] = SEAT_FEATURES + observation.seat;
+  int trump_count = mask_size(observation.held_cards & trump_mask(observation.trump_is_clubs));
+  active[number_active++] = TRUMP_COUNT_FEATURES + std::min(trump_count, 10);
+  active[number_active++] = BIAS_FEATURE;
+
+  assert(number_active <= MAX_ACTIVE_FEATURES);
+  return number_active;
+}
+
+LinearQFunction::Segment LinearQFunction::segment(Play::PlayType play_type)
+{
+  switch(play_type) {
+    case Play::PlayType::TRICK_CARD: return Segment{TRICK_SLOTS, TRICK_SLOTS + 32};
+    case Play::PlayType::PARTNER: return Segment{PARTNER_SLOTS, PARTNER_SLOTS + 32};
+    case Play::PlayType::UNKNOWN: return Segment{UNKNOWN_SLOTS, UNKNOWN_SLOTS + 32};
+    case Play::PlayType::DISCARD: return Segment{DISCARD_SLOTS, DISCARD_SLOTS + 32};
+    case Play::PlayType::PICK:
+    case Play::PlayType::LONER: return Segment{PICK_SLOTS, PICK_SLOTS + 8};
+  }
+  return Segment{0, 0};
+}
+
+int LinearQFunction::action_slots(const ActionId& action, int* slots)
+{
+  switch(static_cast<Play::PlayType>(action.play_type)) {
+    case Play::PlayType::TRICK_CARD:
+      slots[0] = TRICK_SLOTS + action.value;
+      return 1;
+    case Play::PlayType::PARTNER:
+      slots[0] = PARTNER_SLOTS + action.value;
+      return 1;
+    case Play::PlayType::UNKNOWN:
+      slots[0] = UNKNOWN_SLOTS + action.value / 8;
+      return 1;
+    case Play::PlayType::PICK:
+      slots[0] = PICK_SLOTS + action.value;
+      return 1;
+    case Play::PlayType::LONER:
+      slots[0] = LONER_SLOTS + action.value;
+      return 1;
+    case Play::PlayType::DISCARD: {
+      int number_of_slots = 0;
+      for(CardMask cards = action.value; cards && number_of_slots < 4; cards &= cards - 1) {
+        slots[number_of_slots++] = DISCARD_SLOTS + mask_first(cards);
+      }
+      return number_of_slots;
+    }
+  }
+  return 0;
+}
+
+void LinearQFunction::evaluate_all(const int* active, int number_active, Segment segment,
+                                   float* values) const
+{
+  if(have_avx2()) {
+    sum_rows_avx2(m_weights, active, number_active, segment.begin, segment.end, values);
+  } else {
+    sum_rows_scalar(m_weights, active, number_active, segment.begin, segment.end, values);
+  }
+}
+
+float LinearQFunction::evaluate(const Observation& observation, const ActionId& action) const
+{
+  int active[MAX_ACTIVE_FEATURES];
+  int number_active = active_features(observation,
+                                      static_cast<Play::PlayType>(action.play_type), active);
+  int slots[4];
+  int number_of_slots = action_slots(action, slots);
+
+  float value = 0;
+  for(int i = 0; i < number_active; i++) {
+    const float* weights = row(active[i]);
+    for(int j = 0; j < number_of_slots; j++) value += weights[slots[j]];
+  }
+  return value;
+}
+
+void LinearQFunction::evaluate_plays(const sheepshead::interface::Hand& hand,
+                                     const std::vector<Play>& available_plays,
+                                     float* values) const
+{
+  if(available_plays.empty()) return;
+  auto play_type = available_plays[0].play_type();
+  auto observation = observe(hand, hand.current_player());
+  int active[MAX_ACTIVE_FEATURES];
+  int number_active = active_features(observation, play_type, active);
+  float slot_values[ACTION_SLOTS];
+  evaluate_all(active, number_active, segment(play_type), slot_values);
+
+  for(size_t i = 0; i < available_plays.size(); i++) {
+    int slots[4];
+    int number_of_slots = action_slots(encode_action(available_plays[i]), slots);
+    values[i] = 0;
+    for(int j = 0; j < number_of_slots; j++) values[i] += slot_values[slots[j]];
+  }
+}
+
+void LinearQFunction::update(const Observation& observation, const ActionId& action,
+                             float target)
+{
+  int active[MAX_ACTIVE_FEATURES];
+  int number_active = active_features(observation,
+                                      static_cast<Play::PlayType>(action.play_type), active);
+  int slots[4];
+  int number_of_slots = action_slots(action, slots);
+
+  float value = 0;
+  for(int i = 0; i < number_active; i++) {
+    for(int j = 0; j < number_of_slots; j++) value += m_weights[active[i] * ACTION_SLOTS + slots[j]];
+  }
+  // Every active feature takes an equal share of the correction.
+  float step = m_learning_rate * (target - value) / number_active;
+  for(int i = 0; i < number_active; i++) {
+    for(int j = 0; j < number_of_slots; j++) m_weights[active[i] * ACTION_SLOTS + slots[j]] += step;
+  }
+}
+
+void LinearQFunction::learn_hand(const ExperienceRecord* records, int number_of_records,
+                                 float lambda, float discount)
+{
+  // The best value a seat could get from an observation, over the actions
+  // it might have.
+  auto best_value = [this](const Observation& observation) {
+    auto play_type = decision_type(observation);
+    int active[MAX_ACTIVE_FEATURES];
+    int number_active = active_features(observation, play_type, active);
+    float values[ACTION_SLOTS];
+    Segment slots = segment(play_type);
+    evaluate_all(active, number_active, slots, values);
+
+    switch(play_type) {
+      case Play::PlayType::PICK:
+        return std::max(values[PICK_SLOTS], values[PICK_SLOTS + 1]);
+      case Play::PlayType::LONER:
+        return std::max(values[LONER_SLOTS], values[LONER_SLOTS + 1]);
+      case Play::PlayType::PARTNER: {
+        float best = values[slots.begin];
+        for(int slot = slots.begin; slot < slots.end; slot++) best = std::max(best, values[slot]);
+        return best;
+      }
+      case Play::PlayType::DISCARD: {
+        // The best cards to lay away, as many as the blinds held.
+        std::vector<float> held;
+        for(CardMask cards = observation.held_cards; cards; cards &= cards - 1) {
+          held.push_back(values[slots.begin + mask_first(cards)]);
+        }
+        int discards = std::min<int>(cards_in_blinds(observation.number_of_players), held.size());
+        std::partial_sort(held.begin(), held.begin() + discards, held.end(),
+                          [](float a, float b) { return a > b; });
+        float best = 0;
+        for(int i = 0; i < discards; i++) best += held[i];
+        return best;
+      }
+      default: {
+        CardMask held = observation.held_cards;
+        if(!held) return 0.0f;
+        float best = values[slots.begin + mask_first(held)];
+        for(; held; held &= held - 1) best = std::max(best, values[slots.begin + mask_first(held)]);
+        return best;
+      }
+    }
+  };
+
+  std::vector<float> targets(number_of_records);
+  for(int seat = 0; seat < TrickPosition::MAX_PLAYERS; seat++) {
+    float lambda_return = 0;
+    for(int i = number_of_records - 1; i >= 0; i--) {
+      const ExperienceRecord& record = records[i];
+      if(record.observation.seat != seat) continue;
+      if(record.done) {
+        lambda_return = record.reward;
+      } else {
+        float bootstrap = best_value(record.next_observation);
+        lambda_return = record.reward +
+                        discount * ((1 - lambda) * bootstrap + lambda * lambda_return);
+      }
+      targets[i] = lambda_return;
+    }
+  }
+
+  for(int i = 0; i < number_of_records; i++) {
+    update(records[i].observation, records[i].action, targets[i]);
+  }
+}
+
+QuantizedLinearQFunction::QuantizedLinearQFunction(const LinearQFunction& q_function,
+                                                   Precision precision)
+  : m_precision(precision)
+{
+  assert(precision == Precision::FP16 || precision == Precision::INT8);
+  const int size = LinearQFunction::NUMBER_OF_FEATURES * LinearQFunction::ACTION_SLOTS;
+  if(precision == Precision::FP16) {
+    m_fp16_weights.resize(size);
+    for(int i = 0; i < size; i++) m_fp16_weights[i] = float_to_half(q_function.row(0)[i]);
+  } else {
+    m_int8_weights.resize(size);
+    m_scales.resize(LinearQFunction::NUMBER_OF_FEATURES);
+    for(int feature = 0; feature < LinearQFunction::NUMBER_OF_FEATURES; feature++) {
+      m_scales[feature] = quantize_int8(q_function.row(feature), LinearQFunction::ACTION_SLOTS,
+                                        &m_int8_weights[feature * LinearQFunction::ACTION_SLOTS]);
+    }
+  }
+}
+
+size_t QuantizedLinearQFunction::weight_bytes() const
+{
+  return m_int8_weights.size() + m_fp16_weights.size() * sizeof(uint16_t) +
+         m_scales.size() * sizeof(float);
+}
+
+float QuantizedLinearQFunction::weight(int feature, int slot) const
+{
+  int index = feature * LinearQFunction::ACTION_SLOTS + slot;
+  if(m_precision == Precision::FP16) return half_to_float(m_fp16_weights[index]);
+  return m_scales[feature] * m_int8_weights[index];
+}
+
+void QuantizedLinearQFunction::evaluate_all(const int* active, int number_active,
+                                            LinearQFunction::Segment segment,
+                                            float* values) const
+{
+  bool simd = have_avx2_f16c();
+  if(m_precision == Precision::FP16) {
+    if(simd) {
+      sum_fp16_rows_avx2(m_fp16_weights.data(), active, number_active, segment.begin,
+                         segment.end, values);
+    } else {
+      sum_fp16_rows_scalar(m_fp16_weights.data(), active, number_active, segment.begin,
+                           segment.end, values);
+    }
+  } else {
+    if(simd) {
+      sum_int8_rows_avx2(m_int8_weights.data(), m_scales.data(), active, number_active,
+                         segment.begin, segment.end, values);
+    } else {
+      sum_int8_rows_scalar(m_int8_weights.data(), m_scales.data(), active, number_active,
+                           segment.begin, segment.end, values);
+    }
+  }
+}
+
+float QuantizedLinearQFunction::evaluate(const Observation& observation,
+                                         const ActionId& action) const
+{
+  int active[LinearQFunction::MAX_ACTIVE_FEATURES];
+  int number_active = LinearQFunction::active_features(
+      observation, static_cast<Play::PlayType>(action.play_type), active);
+  int slots[4];
+  int number_of_slots = LinearQFunction::action_slots(action, slots);
+
+  float value = 0;
+  for(int i = 0; i < number_active; i++) {
+    for(int j = 0; j < number_of_slots; j++) value += weight(active[i], slots[j]);
+  }
+  return value;
+}
+
+LinearQPolicy::LinearQPolicy(const LinearQFunction* q_function, float exploration)
+  : m_q_function(q_function), m_exploration(exploration)
+{}
+
+int LinearQPolicy::choose_card(const TrickPosition& position,
+                               std::default_random_engine& generator) const
+{
+  CardMask legal = position.legal_moves();
+  std::uniform_real_distribution<float> uniform(0, 1);
+  if(m_exploration > 0 && uniform(generator) < m_exploration) {
+    std::uniform_int_distribution<int> distribution(0, mask_size(legal) - 1);
+    return mask_nth(legal, distribution(generator));
+  }
+
+  auto observation = observe(position, position.to_play());
+  int active[LinearQFunction::MAX_ACTIVE_FEATURES];
+  int number_active = LinearQFunction::active_features(observation, Play::PlayType::TRICK_CARD,
+                                                       active);
+  float slot_values[LinearQFunction::ACTION_SLOTS];
+  m_q_function->evaluate_all(active, number_active,
+                             LinearQFunction::segment(Play::PlayType::TRICK_CARD), slot_values);
+
+  ActionId action = ActionId();
+  action.play_type = static_cast<uint8_t>(Play::PlayType::TRICK_CARD);
+  int best_card = mask_first(legal);
+  float best_value = 0;
+  for(CardMask cards = legal; cards; cards &= cards - 1) {
+    action.value = mask_first(cards);
+    int slots[4];
+    LinearQFunction::action_slots(action, slots);
+    if(cards == legal || slot_values[slots[0]] > best_value) {
+      best_card = action.value;
+      best_value = slot_values[slots[0]];
+    }
+  }
+  return best_card;
+}
+
+Play LinearQPolicy::choose_picking_play(const sheepshead::interface::Hand& hand,
+                                        const std::vector<Play>& available_plays,
+                                        std::default_random_engine& generator) const
+{
+  std::uniform_real_distribution<float> uniform(0, 1);
+  if(m_exploration > 0 && uniform(generator) < m_exploration) {
+    std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+    return available_plays[distribution(generator)];
+  }
+
+  std::vector<float> values(available_plays.size());
+  m_q_function->evaluate_plays(hand, available_plays, values.data());
+  return available_plays[std::max_element(values.begin(), values.end()) - values.begin()];
+}
+
+} // namespace learning
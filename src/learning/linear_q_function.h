@@ -0,0 +1,169 @@
+#ifndef DEEPSHEEP_LEARNING_LINEARQFUNCTION_H_
+#define DEEPSHEEP_LEARNING_LINEARQFUNCTION_H_
+
+#include "learning/experience_record.h"
+#include "learning/quantization.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/playmaker.h"
+
+#include <memory>
+#include <vector>
+
+namespace learning {
+
+/// Action values linear in sparse binary features of what a player can see.
+
+/** An Observation and the kind of decision being made switch on a few
+ *  dozen of NUMBER_OF_FEATURES binary features: each card held, each card
+ *  played in finished tricks, each card in the current trick by the seat
+ *  that laid it relative to the observer, the observer's place in the
+ *  trick, the trick number, whether the observer picked or holds the
+ *  partner card, the kind of decision, the seat, the trump count, and a
+ *  bias. Every feature has a row of ACTION_SLOTS weights, one per action,
+ *  and the value of an action is the sum of its weight over the active
+ *  rows.
+ *
+ *  Actions have a slot in the segment for their kind of play: a card's
+ *  slot for trick cards, partner calls, unknown cards and discards (a
+ *  discard's value is the sum over its cards), and a slot per decision for
+ *  picking and going alone. evaluate_all() sums the active rows over one
+ *  segment at once, eight slots to an AVX2 register when the processor has
+ *  them, so every legal action of a state costs one pass.
+ *
+ *  Evaluation is safe on any number of threads; updates are for one thread
+ *  at a time.
+ */
+class LinearQFunction
+{
+public:
+  static const int NUMBER_OF_FEATURES = 233;
+  //! Slots for every kind of action, padded to a multiple of 8.
+  static const int ACTION_SLOTS = 136;
+  //! The most features an observation switches on.
+  static const int MAX_ACTIVE_FEATURES = 64;
+
+  //! A range of slots, a multiple of 8 wide.
+  struct Segment
+  {
+    int begin;
+    int end;
+  };
+
+  explicit LinearQFunction(float learning_rate = 0.01);
+
+  LinearQFunction(const LinearQFunction& other);
+  LinearQFunction& operator=(const LinearQFunction& other);
+
+  //! Write the active features for a decision of play_type and return how many.
+  static int active_features(const Observation& observation,
+                             sheepshead::interface::Play::PlayType play_type, int* active);
+
+  //! The slots of one kind of play.
+  static Segment segment(sheepshead::interface::Play::PlayType play_type);
+
+  //! The slots an action's value is summed over. Returns how many, at most 4.
+  static int action_slots(const ActionId& action, int* slots);
+
+  //! Sum the rows of the active features over a segment into values[segment.begin, segment.end).
+  void evaluate_all(const int* active, int number_active, Segment segment, float* values) const;
+
+  float evaluate(const Observation& observation, const ActionId& action) const;
+
+  //! The value of each available play for the player to act in a Hand.
+  void evaluate_plays(const sheepshead::interface::Hand& hand,
+                      const std::vector<sheepshead::interface::Play>& available_plays,
+                      float* values) const;
+
+  //! One step of gradient descent, correcting learning_rate of the action's error.
+  void update(const Observation& observation, const ActionId& action, float target);
+
+  /// Learn from the records of a hand with TD(lambda).
+
+  //! Records are grouped by the acting seat and taken in order, as
+  //! record_hand() appends them. Each play is moved towards its lambda-return,
+  //! bootstrapping from the best value among the cards the seat holds at its
+  //! next play, or its next decision's options, as an optimistic stand-in
+  //! for the legal plays. lambda 1 learns Monte Carlo returns, 0 one-step
+  //! Q-learning targets.
+  void learn_hand(const ExperienceRecord* records, int number_of_records, float lambda,
+                  float discount = 1);
+
+  float learning_rate() const { return m_learning_rate; }
+  const float* row(int feature) const { return &m_weights[feature * ACTION_SLOTS]; }
+
+  //! Replace every weight from NUMBER_OF_FEATURES rows of ACTION_SLOTS
+  //! floats, laid out as row() reads them, such as a copy of row(0) onwards.
+  void set_weights(const float* weights);
+
+private:
+  void allocate();
+
+  float m_learning_rate;
+  std::unique_ptr<char[]> m_storage;
+  float* m_weights;
+
+}; // class LinearQFunction
+
+/// A LinearQFunction's weights at reduced precision, for evaluation only.
+
+/** Each row is stored as FP16, or as INT8 with a scale for the row, and is
+ *  widened back to float as it is summed, so an evaluation reads a half or
+ *  a quarter of the bytes the float function does. The values agree with
+ *  the float function's to within the rounding of the weights.
+ */
+class QuantizedLinearQFunction
+{
+public:
+  //! Quantize q_function's weights as they are now. precision is FP16 or INT8.
+  QuantizedLinearQFunction(const LinearQFunction& q_function, Precision precision);
+
+  Precision precision() const { return m_precision; }
+  //! The memory the weights and scales take.
+  size_t weight_bytes() const;
+
+  //! The stored weight of a feature for a slot, widened to float.
+  float weight(int feature, int slot) const;
+
+  //! As LinearQFunction::evaluate_all().
+  void evaluate_all(const int* active, int number_active, LinearQFunction::Segment segment,
+                    float* values) const;
+
+  float evaluate(const Observation& observation, const ActionId& action) const;
+
+private:
+  Precision m_precision;
+  std::vector<int8_t> m_int8_weights;
+  std::vector<uint16_t> m_fp16_weights;
+  std::vector<float> m_scales;
+
+}; // class QuantizedLinearQFunction
+
+/// Take the action a LinearQFunction values most, or with some probability a random one.
+
+/** Every decision, trick cards included, is made from what the player to
+ *  act can see. The function is not owned, and may be updated between
+ *  hands but not while choosing.
+ */
+class LinearQPolicy : public Policy
+{
+public:
+  //! exploration is the probability of choosing uniformly instead.
+  explicit LinearQPolicy(const LinearQFunction* q_function, float exploration = 0);
+
+  int choose_card(const TrickPosition& position,
+                  std::default_random_engine& generator) const override;
+
+protected:
+  sheepshead::interface::Play
+  choose_picking_play(const sheepshead::interface::Hand& hand,
+                      const std::vector<sheepshead::interface::Play>& available_plays,
+                      std::default_random_engine& generator) const override;
+
+private:
+  const LinearQFunction* m_q_function;
+  float m_exploration;
+
+}; // class LinearQPolicy
+
+} // namespace learning
+#endif
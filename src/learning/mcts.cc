@@ -0,0 +1,325 @@
+#include "mcts.h"
+
+#include "learning/deal_stream.h"
+#include "learning/double_dummy_solver.h"
+#include "learning/experience_record.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace learning {
+
+namespace {
+
+// Node values are sums of rewards scaled to [0, 1]. They are kept in fixed
+// point so that threads can add to them with a single atomic instruction.
+const double VALUE_SCALE = 1 << 20;
+
+struct Node
+{
+  Node() : visits(0), availability(0), value(0)
+  {
+    for(auto& child : children) child.store(nullptr, std::memory_order_relaxed);
+  }
+
+  ~Node()
+  {
+    for(auto& child : children) delete child.load(std::memory_order_relaxed);
+  }
+
+  std::atomic<Node*> children[NUMBER_OF_CARDS];
+  std::atomic<int> visits;
+  // How many times the move into this node was legal when its parent was
+  // visited. Moves aren't legal in every determinization.
+  std::atomic<int> availability;
+  std::atomic<long long> value;
+};
+
+// Return the child of node for a card, creating it if no thread has yet.
+Node* get_or_create_child(Node* node, int card)
+{
+  Node* child = node->children[card].load(std::memory_order_acquire);
+  if(child) return child;
+
+  Node* new_child = new Node();
+  if(node->children[card].compare_exchange_strong(child, new_child,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_acquire)) {
+    return new_child;
+  }
+  // Another thread got there first; child now holds its node.
+  delete new_child;
+  return child;
+}
+
+int random_card(CardMask cards, std::default_random_engine& generator)
+{
+  std::uniform_int_distribution<int> distribution(0, mask_size(cards) - 1);
+  return mask_nth(cards, distribution(generator));
+}
+
+int select_child(Node* node, CardMask legal, double exploration)
+{
+  int best_card = mask_first(legal);
+  double best_score = -std::numeric_limits<double>::infinity();
+  for(CardMask remaining = legal; remaining; remaining &= remaining - 1) {
+    int card = mask_first(remaining);
+    Node* child = node->children[card].load(std::memory_order_acquire);
+    int visits = child->visits.load(std::memory_order_relaxed);
+    if(visits <= 0) return card;
+
+    double mean = child->value.load(std::memory_order_relaxed) / VALUE_SCALE / visits;
+    int availability = std::max(1, child->availability.load(std::memory_order_relaxed));
+    double score = mean + exploration * std::sqrt(std::log(availability) / visits);
+    if(score > best_score) {
+      best_score = score;
+      best_card = card;
+    }
+  }
+  return best_card;
+}
+
+// One selection, expansion, playout and backpropagation.
+void run_iteration(Node* root, TrickPosition position, const MctsConfig& config,
+                   int virtual_loss, std::default_random_engine& generator)
+{
+  Node* path[NUMBER_OF_CARDS];
+  int movers[NUMBER_OF_CARDS];
+  int depth = 0;
+
+  Node* node = root;
+  bool expanded = false;
+  while(!position.is_finished() && !expanded) {
+    CardMask legal = position.legal_moves();
+    CardMask untried = 0;
+    for(CardMask remaining = legal; remaining; remaining &= remaining - 1) {
+      int card = mask_first(remaining);
+      Node* child = node->children[card].load(std::memory_order_acquire);
+      if(child) {
+        child->availability.fetch_add(1, std::memory_order_relaxed);
+      } else {
+        untried |= card_bit(card);
+      }
+    }
+
+    int card = 0;
+    if(untried) {
+      card = random_card(untried, generator);
+      node = get_or_create_child(node, card);
+      node->availability.fetch_add(1, std::memory_order_relaxed);
+      expanded = true;
+    } else {
+      card = select_child(node, legal, config.exploration);
+      node = node->children[card].load(std::memory_order_acquire);
+    }
+
+    node->visits.fetch_add(virtual_loss, std::memory_order_relaxed);
+    path[depth] = node;
+    movers[depth] = position.to_play();
+    depth++;
+    position.make_move(card);
+  }
+
+  double max_reward = position.max_reward();
+  int number_of_players = position.number_of_players();
+  if(config.leaf_evaluator && !position.is_finished()) {
+    // The evaluator's values are by seat, counting from the one to move.
+    InferenceQueue* evaluator = config.leaf_evaluator;
+    assert(evaluator->input_size() == observation_input_size());
+    assert(evaluator->output_size() >= number_of_players);
+    int to_play = position.to_play();
+    std::vector<float> inputs(evaluator->input_size());
+    std::vector<float> outputs(evaluator->output_size());
+    encode_observation(observe(position, to_play),
+                       sheepshead::interface::Play::PlayType::TRICK_CARD, inputs.data());
+    evaluator->evaluate(inputs.data(), outputs.data());
+    for(int i = 0; i < depth; i++) {
+      double reward = outputs[(movers[i] - to_play + number_of_players) % number_of_players];
+      double value = std::max(0.0, std::min(1.0, (reward + max_reward) / (2 * max_reward)));
+      path[i]->value.fetch_add(static_cast<long long>(value * VALUE_SCALE),
+                               std::memory_order_relaxed);
+      path[i]->visits.fetch_add(1 - virtual_loss, std::memory_order_relaxed);
+    }
+    return;
+  }
+
+  // Play out at random, then with best play once few enough cards are left
+  // to solve cheaply.
+  bool can_solve = config.table && !position.is_leasters();
+  int cards_in_hands = position.number_of_players() * position.number_of_tricks();
+  SharedDoubleDummySolver solver(config.table);
+  solver.set_tablebase(config.tablebase);
+  while(!position.is_finished()) {
+    if(can_solve && cards_in_hands - mask_size(position.played_cards()) <= config.solve_cards) {
+      position.make_move(solver.solve(position).best_card);
+    } else {
+      position.make_move(random_card(position.legal_moves(), generator));
+    }
+  }
+
+  for(int i = 0; i < depth; i++) {
+    double value = (position.reward(movers[i]) + max_reward) / (2 * max_reward);
+    path[i]->value.fetch_add(static_cast<long long>(value * VALUE_SCALE),
+                             std::memory_order_relaxed);
+    path[i]->visits.fetch_add(1 - virtual_loss, std::memory_order_relaxed);
+  }
+}
+
+// Add the statistics of a root's children to a result.
+void accumulate_root(const Node& root, MctsResult* result, std::array<double, NUMBER_OF_CARDS>* values)
+{
+  for(int card = 0; card < NUMBER_OF_CARDS; card++) {
+    Node* child = root.children[card].load(std::memory_order_acquire);
+    if(!child) continue;
+    result->visits[card] += child->visits.load(std::memory_order_relaxed);
+    (*values)[card] += child->value.load(std::memory_order_relaxed) / VALUE_SCALE;
+  }
+}
+
+void finish_result(int max_reward, const std::array<double, NUMBER_OF_CARDS>& values,
+                   MctsResult* result)
+{
+  int best_visits = -1;
+  for(int card = 0; card < NUMBER_OF_CARDS; card++) {
+    int visits = result->visits[card];
+    if(visits == 0) continue;
+    result->mean_reward[card] = (values[card] / visits) * 2 * max_reward - max_reward;
+    if(visits > best_visits ||
+       (visits == best_visits && result->mean_reward[card] > result->mean_reward[result->best_card])) {
+      best_visits = visits;
+      result->best_card = card;
+    }
+  }
+}
+
+} // namespace
+
+MctsConfig::MctsConfig()
+  : parallelism(Parallelism::ROOT), number_of_threads(1), iterations(10000),
+    determinizations(16), exploration(0.7), virtual_loss(3), seed(0),
+    solve_cards(0), table(nullptr), tablebase(nullptr), leaf_evaluator(nullptr)
+{}
+
+MctsResult::MctsResult()
+  : best_card(NO_CARD), iterations(0)
+{
+  visits.fill(0);
+  mean_reward.fill(0);
+}
+
+Mcts::Mcts(const MctsConfig& config)
+  : m_config(config)
+{}
+
+MctsResult Mcts::search(const sheepshead::interface::Hand& hand) const
+{
+  assert(hand.is_playable());
+  Determinizer determinizer(hand, hand.current_player());
+
+  unsigned long seed = m_config.seed;
+  if(seed == 0) {
+    seed = std::chrono::system_clock::now().time_since_epoch().count();
+  }
+
+  if(m_config.parallelism == MctsConfig::Parallelism::TREE) {
+    return search_tree_parallel(determinizer, seed);
+  }
+  return search_root_parallel(determinizer, seed);
+}
+
+MctsResult Mcts::search_root_parallel(const Determinizer& determinizer,
+                                      unsigned long seed) const
+{
+  int number_of_trees = m_config.determinizations > 0 ? m_config.determinizations
+                                                      : m_config.number_of_threads;
+  // Every tree gets a playout at least, and the first trees one more each
+  // until the iterations are spent exactly.
+  number_of_trees = std::max(1, std::min(number_of_trees, m_config.iterations));
+  int number_of_threads = std::max(1, std::min(m_config.number_of_threads, number_of_trees));
+  int iterations_per_tree = m_config.iterations / number_of_trees;
+  int longer_trees = m_config.iterations % number_of_trees;
+
+  std::vector<std::unique_ptr<Node>> roots(number_of_trees);
+  auto build_trees = [&](int thread_number) {
+    for(int tree = thread_number; tree < number_of_trees; tree += number_of_threads) {
+      std::default_random_engine generator(mix_seed(seed, tree));
+      TrickPosition position = determinizer.sample(generator);
+      roots[tree].reset(new Node());
+      int iterations = iterations_per_tree + (tree < longer_trees ? 1 : 0);
+      for(int iteration = 0; iteration < iterations; iteration++) {
+        run_iteration(roots[tree].get(), position, m_config, 0, generator);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int thread_number = 1; thread_number < number_of_threads; thread_number++) {
+    threads.emplace_back(build_trees, thread_number);
+  }
+  build_trees(0);
+  for(auto& thread : threads) thread.join();
+
+  MctsResult result;
+  std::array<double, NUMBER_OF_CARDS> values;
+  values.fill(0);
+  for(auto& root : roots) {
+    accumulate_root(*root, &result, &values);
+  }
+  result.iterations = iterations_per_tree * number_of_trees + longer_trees;
+  finish_result(determinizer.max_reward(), values, &result);
+  return result;
+}
+
+MctsResult Mcts::search_tree_parallel(const Determinizer& determinizer,
+                                      unsigned long seed) const
+{
+  Node root;
+  std::atomic<int> iteration_counter(0);
+  int number_of_threads = std::max(1, m_config.number_of_threads);
+
+  auto grow_tree = [&](int thread_number) {
+    std::default_random_engine generator(mix_seed(seed, thread_number));
+    while(iteration_counter.fetch_add(1, std::memory_order_relaxed) < m_config.iterations) {
+      run_iteration(&root, determinizer.sample(generator), m_config,
+                    m_config.virtual_loss, generator);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int thread_number = 1; thread_number < number_of_threads; thread_number++) {
+    threads.emplace_back(grow_tree, thread_number);
+  }
+  grow_tree(0);
+  for(auto& thread : threads) thread.join();
+
+  MctsResult result;
+  std::array<double, NUMBER_OF_CARDS> values;
+  values.fill(0);
+  accumulate_root(root, &result, &values);
+  result.iterations = m_config.iterations;
+  finish_result(determinizer.max_reward(), values, &result);
+  return result;
+}
+
+sheepshead::interface::Play Mcts::choose_play(const sheepshead::interface::Hand& hand) const
+{
+  auto available_plays = hand.available_plays(hand.current_player());
+  assert(!available_plays.empty() &&
+         available_plays[0].play_type() == sheepshead::interface::Play::PlayType::TRICK_CARD);
+  if(available_plays.size() == 1) return available_plays[0];
+
+  int best_card = search(hand).best_card;
+  for(auto& play : available_plays) {
+    if(card_index(*play.trick_card_decision()) == best_card) return play;
+  }
+  return available_plays[0];
+}
+
+} // namespace learning
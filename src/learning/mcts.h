@@ -0,0 +1,107 @@
+#ifndef DEEPSHEEP_LEARNING_MCTS_H_
+#define DEEPSHEEP_LEARNING_MCTS_H_
+
+#include "learning/card_mask.h"
+#include "learning/determinization.h"
+#include "learning/inference_queue.h"
+#include "learning/shared_transposition_table.h"
+#include "learning/tablebase.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/playmaker.h"
+
+#include <array>
+
+namespace learning {
+
+/// Options for a Monte Carlo tree search.
+struct MctsConfig
+{
+  /// How the search is spread over threads.
+
+  //! ROOT builds independent trees, each over its own determinization, and
+  //! merges their visit counts at the root. TREE has every thread share one
+  //! tree, sampling a new determinization each iteration, with lock-free node
+  //! statistics and virtual loss to keep threads on different paths.
+  enum class Parallelism {ROOT, TREE};
+
+  MctsConfig();
+
+  Parallelism parallelism;
+  //! The number of search threads.
+  int number_of_threads;
+  //! The total number of playouts per decision, over all threads.
+  int iterations;
+  //! The number of trees for ROOT parallelism, each over its own sampled
+  //! deal, so a search on one thread still averages over the cards it
+  //! can't see. Zero means one per thread. There are never more trees
+  //! than iterations, which are shared among them exactly.
+  int determinizations;
+  //! The UCB exploration constant, for rewards scaled to [0, 1].
+  double exploration;
+  //! Visits added to a node while a TREE thread is below it.
+  int virtual_loss;
+  //! Seed for the search's random numbers. Zero means seed from the clock.
+  unsigned long seed;
+  //! Playouts reaching this many unplayed cards or fewer finish with
+  //! double-dummy best play instead of random cards. Needs a table.
+  int solve_cards;
+  //! The table the playout solvers share across threads, or null. Not owned.
+  SharedTranspositionTable* table;
+  //! A tablebase for the playout solvers, or null. Not owned.
+  const Tablebase* tablebase;
+  /// Values for new leaves in place of playouts, or null. Not owned.
+
+  //! The queue takes encode_observation() of what the seat to move at the
+  //! leaf sees, and gives at least number_of_players outputs: the expected
+  //! reward of that seat and each seat after it in turn. Search threads
+  //! share the queue, so their leaves are evaluated in batches.
+  InferenceQueue* leaf_evaluator;
+};
+
+/// The statistics gathered at the root by a search.
+struct MctsResult
+{
+  MctsResult();
+
+  //! The card with the most visits.
+  int best_card;
+  //! Visits of each card at the root.
+  std::array<int, NUMBER_OF_CARDS> visits;
+  //! The mean reward of each card for the player to move.
+  std::array<double, NUMBER_OF_CARDS> mean_reward;
+  //! The number of playouts that were run.
+  int iterations;
+};
+
+/// Determinized Monte Carlo tree search over the trick plays of a Hand.
+
+/** Searches from the point of view of the current player, who can only see
+ *  their own cards. Playouts choose uniformly among legal cards, until the
+ *  cards left are few enough to solve with a SharedDoubleDummySolver, or
+ *  are replaced by a learned leaf evaluator's values.
+ */
+class Mcts
+{
+public:
+  explicit Mcts(const MctsConfig& config = MctsConfig());
+
+  //! Search a Hand that is waiting on a trick card from its current player.
+  MctsResult search(const sheepshead::interface::Hand& hand) const;
+
+  //! Search a Hand and return the available Play for the best card.
+  sheepshead::interface::Play choose_play(const sheepshead::interface::Hand& hand) const;
+
+  const MctsConfig& config() const { return m_config; }
+
+private:
+  MctsResult search_root_parallel(const Determinizer& determinizer,
+                                  unsigned long seed) const;
+  MctsResult search_tree_parallel(const Determinizer& determinizer,
+                                  unsigned long seed) const;
+
+  MctsConfig m_config;
+
+}; // class Mcts
+
+} // namespace learning
+#endif
@@ -0,0 +1,528 @@
+#include "mlp.h"
+
+#include "learning/linear_q_function.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#include <immintrin.h>
+
+using sheepshead::interface::Play;
+
+namespace learning {
+
+namespace {
+
+const char MAGIC[8] = {'D', 'S', 'M', 'L', 'P', '0', '0', '1'};
+// Layers above this size are taken to be a corrupt file.
+const uint32_t MAX_LAYER_SIZE = 1 << 16;
+const uint32_t MAX_LAYERS = 64;
+
+const int WEIGHT_ALIGNMENT = 32;
+static_assert(Mlp::PANEL_WIDTH % 8 == 0, "panels should be whole AVX2 registers");
+
+bool have_avx2()
+{
+  static const bool supported = __builtin_cpu_supports("avx2") &&
+                                __builtin_cpu_supports("fma") &&
+                                __builtin_cpu_supports("f16c");
+  return supported;
+}
+
+inline float widen(float weight) { return weight; }
+inline float widen(uint16_t weight) { return half_to_float(weight); }
+inline float widen(int8_t weight) { return weight; }
+
+__attribute__((target("avx2")))
+inline __m256 load_weights(const float* weights) { return _mm256_load_ps(weights); }
+
+__attribute__((target("avx2,f16c")))
+inline __m256 load_weights(const uint16_t* weights)
+{
+  return _mm256_cvtph_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(weights)));
+}
+
+__attribute__((target("avx2")))
+inline __m256 load_weights(const int8_t* weights)
+{
+  __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(weights));
+  return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(bytes));
+}
+
+// outputs = (inputs * weights) * scales + bias for a batch, where weights
+// are [number_of_inputs][padded_outputs].
+template<typename Weight_T>
+void dense_scalar(const float* inputs, int input_stride, int batch_size,
+                  int number_of_inputs, const Weight_T* weights, const float* scales,
+                  const float* bias, int padded_outputs, bool relu, float* outputs)
+{
+  for(int row = 0; row < batch_size; row++) {
+    const float* in = inputs + row * input_stride;
+    float* out = outputs + row * padded_outputs;
+    std::fill(out, out + padded_outputs, 0.0f);
+    for(int k = 0; k < number_of_inputs; k++) {
+      // Feature inputs are mostly zeros.
+      if(in[k] == 0) continue;
+      const Weight_T* w = weights + k * padded_outputs;
+      for(int o = 0; o < padded_outputs; o++) out[o] += in[k] * widen(w[o]);
+    }
+    for(int o = 0; o < padded_outputs; o++) {
+      out[o] = out[o] * scales[o] + bias[o];
+      if(relu) out[o] = std::max(out[o], 0.0f);
+    }
+  }
+}
+
+// Inputs are taken in blocks so the panel of weights being used stays in
+// L1 across the batch. Partial sums wait in outputs between blocks, and
+// are scaled and biased after the last.
+template<typename Weight_T>
+__attribute__((target("avx2,fma,f16c")))
+void dense_avx2(const float* inputs, int input_stride, int batch_size,
+                int number_of_inputs, const Weight_T* weights, const float* scales,
+                const float* bias, int padded_outputs, bool relu, float* outputs)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  for(int k0 = 0; k0 < number_of_inputs; k0 += Mlp::BLOCK_INPUTS) {
+    int k1 = std::min(k0 + Mlp::BLOCK_INPUTS, number_of_inputs);
+    bool first_block = k0 == 0;
+    bool last_block = k1 == number_of_inputs;
+
+    for(int panel = 0; panel < padded_outputs; panel += Mlp::PANEL_WIDTH) {
+      const Weight_T* w = weights + panel;
+      const __m256 scale0 = _mm256_load_ps(scales + panel);
+      const __m256 scale1 = _mm256_load_ps(scales + panel + 8);
+      const __m256 bias0 = _mm256_load_ps(bias + panel);
+      const __m256 bias1 = _mm256_load_ps(bias + panel + 8);
+      int row = 0;
+
+      // Four rows by sixteen outputs in eight accumulators, with two weight
+      // and one input register: every weight load feeds four FMAs.
+      for(; row + 4 <= batch_size; row += 4) {
+        const float* in0 = inputs + (row + 0) * input_stride;
+        const float* in1 = inputs + (row + 1) * input_stride;
+        const float* in2 = inputs + (row + 2) * input_stride;
+        const float* in3 = inputs + (row + 3) * input_stride;
+        float* out0 = outputs + (row + 0) * padded_outputs + panel;
+        float* out1 = outputs + (row + 1) * padded_outputs + panel;
+        float* out2 = outputs + (row + 2) * padded_outputs + panel;
+        float* out3 = outputs + (row + 3) * padded_outputs + panel;
+
+        __m256 a00, a01, a10, a11, a20, a21, a30, a31;
+        if(first_block) {
+          a00 = a01 = a10 = a11 = a20 = a21 = a30 = a31 = zero;
+        } else {
+          a00 = _mm256_loadu_ps(out0); a01 = _mm256_loadu_ps(out0 + 8);
+          a10 = _mm256_loadu_ps(out1); a11 = _mm256_loadu_ps(out1 + 8);
+          a20 = _mm256_loadu_ps(out2); a21 = _mm256_loadu_ps(out2 + 8);
+          a30 = _mm256_loadu_ps(out3); a31 = _mm256_loadu_ps(out3 + 8);
+        }
+
+        for(int k = k0; k < k1; k++) {
+          __m256 w0 = load_weights(w + k * padded_outputs);
+          __m256 w1 = load_weights(w + k * padded_outputs + 8);
+          __m256 x = _mm256_broadcast_ss(in0 + k);
+          a00 = _mm256_fmadd_ps(x, w0, a00);
+          a01 = _mm256_fmadd_ps(x, w1, a01);
+          x = _mm256_broadcast_ss(in1 + k);
+          a10 = _mm256_fmadd_ps(x, w0, a10);
+          a11 = _mm256_fmadd_ps(x, w1, a11);
+          x = _mm256_broadcast_ss(in2 + k);
+          a20 = _mm256_fmadd_ps(x, w0, a20);
+          a21 = _mm256_fmadd_ps(x, w1, a21);
+          x = _mm256_broadcast_ss(in3 + k);
+          a30 = _mm256_fmadd_ps(x, w0, a30);
+          a31 = _mm256_fmadd_ps(x, w1, a31);
+        }
+
+        if(last_block) {
+          a00 = _mm256_fmadd_ps(a00, scale0, bias0); a01 = _mm256_fmadd_ps(a01, scale1, bias1);
+          a10 = _mm256_fmadd_ps(a10, scale0, bias0); a11 = _mm256_fmadd_ps(a11, scale1, bias1);
+          a20 = _mm256_fmadd_ps(a20, scale0, bias0); a21 = _mm256_fmadd_ps(a21, scale1, bias1);
+          a30 = _mm256_fmadd_ps(a30, scale0, bias0); a31 = _mm256_fmadd_ps(a31, scale1, bias1);
+          if(relu) {
+            a00 = _mm256_max_ps(a00, zero); a01 = _mm256_max_ps(a01, zero);
+            a10 = _mm256_max_ps(a10, zero); a11 = _mm256_max_ps(a11, zero);
+            a20 = _mm256_max_ps(a20, zero); a21 = _mm256_max_ps(a21, zero);
+            a30 = _mm256_max_ps(a30, zero); a31 = _mm256_max_ps(a31, zero);
+          }
+        }
+        _mm256_storeu_ps(out0, a00); _mm256_storeu_ps(out0 + 8, a01);
+        _mm256_storeu_ps(out1, a10); _mm256_storeu_ps(out1 + 8, a11);
+        _mm256_storeu_ps(out2, a20); _mm256_storeu_ps(out2 + 8, a21);
+        _mm256_storeu_ps(out3, a30); _mm256_storeu_ps(out3 + 8, a31);
+      }
+
+      for(; row < batch_size; row++) {
+        const float* in = inputs + row * input_stride;
+        float* out = outputs + row * padded_outputs + panel;
+        __m256 a0 = first_block ? zero : _mm256_loadu_ps(out);
+        __m256 a1 = first_block ? zero : _mm256_loadu_ps(out + 8);
+        for(int k = k0; k < k1; k++) {
+          __m256 x = _mm256_broadcast_ss(in + k);
+          a0 = _mm256_fmadd_ps(x, load_weights(w + k * padded_outputs), a0);
+          a1 = _mm256_fmadd_ps(x, load_weights(w + k * padded_outputs + 8), a1);
+        }
+        if(last_block) {
+          a0 = _mm256_fmadd_ps(a0, scale0, bias0);
+          a1 = _mm256_fmadd_ps(a1, scale1, bias1);
+          if(relu) {
+            a0 = _mm256_max_ps(a0, zero);
+            a1 = _mm256_max_ps(a1, zero);
+          }
+        }
+        _mm256_storeu_ps(out, a0);
+        _mm256_storeu_ps(out + 8, a1);
+      }
+    }
+  }
+}
+
+template<typename Weight_T>
+void dense(bool avx2, const float* inputs, int input_stride, int batch_size,
+           int number_of_inputs, const char* weights, const float* scales,
+           const float* bias, int padded_outputs, bool relu, float* outputs)
+{
+  const Weight_T* typed_weights = reinterpret_cast<const Weight_T*>(weights);
+  if(avx2) {
+    dense_avx2(inputs, input_stride, batch_size, number_of_inputs, typed_weights, scales,
+               bias, padded_outputs, relu, outputs);
+  } else {
+    dense_scalar(inputs, input_stride, batch_size, number_of_inputs, typed_weights, scales,
+                 bias, padded_outputs, relu, outputs);
+  }
+}
+
+template<typename T>
+bool read_value(std::istream& in, T* value)
+{
+  return static_cast<bool>(in.read(reinterpret_cast<char*>(value), sizeof(T)));
+}
+
+template<typename T>
+void write_value(std::ostream& out, T value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+} // namespace
+
+const int Mlp::PANEL_WIDTH;
+const int Mlp::BLOCK_INPUTS;
+
+Mlp::Mlp()
+  : m_precision(Precision::FLOAT32)
+{}
+
+Mlp::Mlp(const Mlp& other)
+  : m_precision(Precision::FLOAT32)
+{
+  copy_layers(other);
+}
+
+Mlp& Mlp::operator=(const Mlp& other)
+{
+  if(this != &other) copy_layers(other);
+  return *this;
+}
+
+void Mlp::allocate(Layer* layer, Precision precision)
+{
+  // Scales and biases first, then the weights, each on an AVX2 boundary
+  // since padded_outputs floats are whole registers.
+  size_t vector_bytes = layer->padded_outputs * sizeof(float);
+  layer->bytes = 2 * vector_bytes +
+                 static_cast<size_t>(layer->inputs) * layer->padded_outputs *
+                 precision_bytes(precision);
+  // Over-allocate so each row of a panel starts on an AVX2 boundary.
+  layer->storage.reset(new char[layer->bytes + WEIGHT_ALIGNMENT]);
+  uintptr_t address = reinterpret_cast<uintptr_t>(layer->storage.get());
+  address = (address + WEIGHT_ALIGNMENT - 1) & ~static_cast<uintptr_t>(WEIGHT_ALIGNMENT - 1);
+  char* base = reinterpret_cast<char*>(address);
+  memset(base, 0, layer->bytes);
+  layer->scales = reinterpret_cast<float*>(base);
+  layer->bias = reinterpret_cast<float*>(base + vector_bytes);
+  layer->weights = base + 2 * vector_bytes;
+}
+
+float Mlp::weight(const Layer& layer, int input, int output) const
+{
+  size_t index = static_cast<size_t>(input) * layer.padded_outputs + output;
+  switch(m_precision) {
+    case Precision::FLOAT32: return reinterpret_cast<const float*>(layer.weights)[index];
+    case Precision::FP16: return half_to_float(reinterpret_cast<const uint16_t*>(layer.weights)[index]);
+    case Precision::INT8:
+      return layer.scales[output] * reinterpret_cast<const int8_t*>(layer.weights)[index];
+  }
+  return 0;
+}
+
+void Mlp::copy_layers(const Mlp& other)
+{
+  m_layers.clear();
+  m_precision = other.m_precision;
+  for(const Layer& other_layer : other.m_layers) {
+    Layer layer;
+    layer.inputs = other_layer.inputs;
+    layer.outputs = other_layer.outputs;
+    layer.padded_outputs = other_layer.padded_outputs;
+    layer.activation = other_layer.activation;
+    allocate(&layer, m_precision);
+    memcpy(layer.scales, other_layer.scales, layer.bytes);
+    m_layers.push_back(std::move(layer));
+  }
+}
+
+void Mlp::add_layer(int inputs, int outputs, Activation activation,
+                    const float* weights, const float* bias)
+{
+  assert(inputs > 0 && outputs > 0);
+  assert(m_layers.empty() || m_layers.back().outputs == inputs);
+  assert(m_precision == Precision::FLOAT32);
+
+  Layer layer;
+  layer.inputs = inputs;
+  layer.outputs = outputs;
+  layer.padded_outputs = (outputs + PANEL_WIDTH - 1) / PANEL_WIDTH * PANEL_WIDTH;
+  layer.activation = activation;
+  allocate(&layer, Precision::FLOAT32);
+
+  float* layer_weights = reinterpret_cast<float*>(layer.weights);
+  for(int o = 0; o < outputs; o++) {
+    for(int k = 0; k < inputs; k++) {
+      layer_weights[k * layer.padded_outputs + o] = weights[o * inputs + k];
+    }
+    layer.bias[o] = bias[o];
+  }
+  std::fill(layer.scales, layer.scales + layer.padded_outputs, 1.0f);
+  m_layers.push_back(std::move(layer));
+}
+
+void Mlp::quantize(Precision precision)
+{
+  assert(m_precision == Precision::FLOAT32);
+  if(precision == Precision::FLOAT32) return;
+
+  std::vector<float> column;
+  std::vector<int8_t> quantized;
+  for(Layer& layer : m_layers) {
+    Layer narrow;
+    narrow.inputs = layer.inputs;
+    narrow.outputs = layer.outputs;
+    narrow.padded_outputs = layer.padded_outputs;
+    narrow.activation = layer.activation;
+    allocate(&narrow, precision);
+    std::copy(layer.bias, layer.bias + layer.padded_outputs, narrow.bias);
+    std::fill(narrow.scales, narrow.scales + narrow.padded_outputs, 1.0f);
+
+    const float* weights = reinterpret_cast<const float*>(layer.weights);
+    size_t number_of_weights = static_cast<size_t>(layer.inputs) * layer.padded_outputs;
+    if(precision == Precision::FP16) {
+      uint16_t* halves = reinterpret_cast<uint16_t*>(narrow.weights);
+      for(size_t i = 0; i < number_of_weights; i++) halves[i] = float_to_half(weights[i]);
+    } else {
+      // Each output's weights, a row of the file's matrix, get their own scale.
+      int8_t* bytes = reinterpret_cast<int8_t*>(narrow.weights);
+      column.resize(layer.inputs);
+      quantized.resize(layer.inputs);
+      for(int o = 0; o < layer.outputs; o++) {
+        for(int k = 0; k < layer.inputs; k++) column[k] = weights[k * layer.padded_outputs + o];
+        narrow.scales[o] = quantize_int8(column.data(), layer.inputs, quantized.data());
+        for(int k = 0; k < layer.inputs; k++) bytes[k * layer.padded_outputs + o] = quantized[k];
+      }
+    }
+    layer = std::move(narrow);
+  }
+  m_precision = precision;
+}
+
+bool Mlp::load(const std::string& path)
+{
+  m_layers.clear();
+  m_precision = Precision::FLOAT32;
+  std::ifstream in(path, std::ios::binary);
+  if(!in) return false;
+  in.seekg(0, std::ios::end);
+  std::streamoff file_size = in.tellg();
+  in.seekg(0, std::ios::beg);
+  if(file_size < 0) return false;
+
+  char magic[sizeof(MAGIC)];
+  uint32_t number_of_layers = 0;
+  if(!in.read(magic, sizeof(magic)) || memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+     !read_value(in, &number_of_layers) || number_of_layers == 0 ||
+     number_of_layers > MAX_LAYERS) {
+    return false;
+  }
+
+  std::vector<float> weights;
+  std::vector<float> bias;
+  for(uint32_t i = 0; i < number_of_layers; i++) {
+    uint32_t inputs = 0;
+    uint32_t outputs = 0;
+    uint32_t activation = 0;
+    if(!read_value(in, &inputs) || !read_value(in, &outputs) ||
+       !read_value(in, &activation) ||
+       inputs == 0 || inputs > MAX_LAYER_SIZE || outputs == 0 || outputs > MAX_LAYER_SIZE ||
+       activation > static_cast<uint32_t>(Activation::RELU) ||
+       (!m_layers.empty() && static_cast<int>(inputs) != m_layers.back().outputs)) {
+      m_layers.clear();
+      return false;
+    }
+    // Check the file holds the layer before allocating for it, so a corrupt
+    // size can't ask for gigabytes.
+    uint64_t layer_bytes = (static_cast<uint64_t>(inputs) + 1) * outputs * sizeof(float);
+    if(layer_bytes > static_cast<uint64_t>(file_size - in.tellg())) {
+      m_layers.clear();
+      return false;
+    }
+    weights.resize(static_cast<size_t>(inputs) * outputs);
+    bias.resize(outputs);
+    if(!in.read(reinterpret_cast<char*>(weights.data()), weights.size() * sizeof(float)) ||
+       !in.read(reinterpret_cast<char*>(bias.data()), bias.size() * sizeof(float))) {
+      m_layers.clear();
+      return false;
+    }
+    add_layer(inputs, outputs, static_cast<Activation>(activation), weights.data(), bias.data());
+  }
+
+  // Trailing bytes mean the file isn't what we think it is.
+  if(in.peek() != std::char_traits<char>::eof()) {
+    m_layers.clear();
+    return false;
+  }
+  return true;
+}
+
+bool Mlp::save(const std::string& path) const
+{
+  std::ofstream out(path, std::ios::binary);
+  out.write(MAGIC, sizeof(MAGIC));
+  write_value<uint32_t>(out, m_layers.size());
+  for(const Layer& layer : m_layers) {
+    write_value<uint32_t>(out, layer.inputs);
+    write_value<uint32_t>(out, layer.outputs);
+    write_value<uint32_t>(out, static_cast<uint32_t>(layer.activation));
+    for(int o = 0; o < layer.outputs; o++) {
+      for(int k = 0; k < layer.inputs; k++) write_value<float>(out, weight(layer, k, o));
+    }
+    out.write(reinterpret_cast<const char*>(layer.bias), layer.outputs * sizeof(float));
+  }
+  return static_cast<bool>(out);
+}
+
+int Mlp::input_size() const
+{
+  return m_layers.empty() ? 0 : m_layers.front().inputs;
+}
+
+int Mlp::output_size() const
+{
+  return m_layers.empty() ? 0 : m_layers.back().outputs;
+}
+
+size_t Mlp::weight_bytes() const
+{
+  size_t bytes = 0;
+  for(const Layer& layer : m_layers) bytes += layer.bytes;
+  return bytes;
+}
+
+long long Mlp::number_of_parameters() const
+{
+  long long parameters = 0;
+  for(const Layer& layer : m_layers) {
+    parameters += static_cast<long long>(layer.inputs + 1) * layer.outputs;
+  }
+  return parameters;
+}
+
+void Mlp::forward(const float* inputs, int batch_size, float* outputs,
+                  Workspace* workspace) const
+{
+  assert(!m_layers.empty());
+  if(batch_size <= 0) return;
+
+  bool avx2 = have_avx2();
+  const float* layer_inputs = inputs;
+  int input_stride = input_size();
+  for(size_t i = 0; i < m_layers.size(); i++) {
+    const Layer& layer = m_layers[i];
+    std::vector<float>& activations = workspace->activations[i % 2];
+    activations.resize(static_cast<size_t>(batch_size) * layer.padded_outputs);
+    bool relu = layer.activation == Activation::RELU;
+    switch(m_precision) {
+      case Precision::FLOAT32:
+        dense<float>(avx2, layer_inputs, input_stride, batch_size, layer.inputs, layer.weights,
+                     layer.scales, layer.bias, layer.padded_outputs, relu, activations.data());
+        break;
+      case Precision::FP16:
+        dense<uint16_t>(avx2, layer_inputs, input_stride, batch_size, layer.inputs,
+                        layer.weights, layer.scales, layer.bias, layer.padded_outputs, relu,
+                        activations.data());
+        break;
+      case Precision::INT8:
+        dense<int8_t>(avx2, layer_inputs, input_stride, batch_size, layer.inputs,
+                      layer.weights, layer.scales, layer.bias, layer.padded_outputs, relu,
+                      activations.data());
+        break;
+    }
+    layer_inputs = activations.data();
+    input_stride = layer.padded_outputs;
+  }
+
+  // Drop the padding from the last layer's rows.
+  int width = output_size();
+  for(int row = 0; row < batch_size; row++) {
+    std::copy(layer_inputs + row * input_stride, layer_inputs + row * input_stride + width,
+              outputs + row * width);
+  }
+}
+
+void Mlp::forward(const float* inputs, int batch_size, float* outputs) const
+{
+  Workspace workspace;
+  forward(inputs, batch_size, outputs, &workspace);
+}
+
+void Mlp::softmax(const float* logits, const uint8_t* legal, int batch_size,
+                  int width, float* probabilities)
+{
+  for(int row = 0; row < batch_size; row++) {
+    const float* x = logits + row * width;
+    const uint8_t* allowed = legal + row * width;
+    float* p = probabilities + row * width;
+
+    float largest = -INFINITY;
+    for(int i = 0; i < width; i++) {
+      if(allowed[i]) largest = std::max(largest, x[i]);
+    }
+    float sum = 0;
+    for(int i = 0; i < width; i++) {
+      p[i] = allowed[i] ? std::exp(x[i] - largest) : 0.0f;
+      sum += p[i];
+    }
+    if(sum > 0) {
+      for(int i = 0; i < width; i++) p[i] /= sum;
+    }
+  }
+}
+
+int observation_input_size()
+{
+  return LinearQFunction::NUMBER_OF_FEATURES;
+}
+
+void encode_observation(const Observation& observation, Play::PlayType play_type,
+                        float* inputs)
+{
+  std::fill(inputs, inputs + LinearQFunction::NUMBER_OF_FEATURES, 0.0f);
+  int active[LinearQFunction::MAX_ACTIVE_FEATURES];
+  int number_active = LinearQFunction::active_features(observation, play_type, active);
+  for(int i = 0; i < number_active; i++) inputs[active[i]] = 1.0f;
+}
+
+} // namespace learning
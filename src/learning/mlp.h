@@ -0,0 +1,156 @@
+#ifndef DEEPSHEEP_LEARNING_MLP_H_
+#define DEEPSHEEP_LEARNING_MLP_H_
+
+#include "learning/experience_record.h"
+#include "learning/quantization.h"
+#include "sheepshead/interface/playmaker.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace learning {
+
+/// How a layer transforms its outputs.
+enum class Activation
+{
+  NONE = 0,
+  RELU = 1
+};
+
+/// A multilayer perceptron evaluated on batches of inputs.
+
+/** Each layer is dense, outputs = activation(W * inputs + bias), and the
+ *  last one's outputs are the network's, usually logits for softmax() or
+ *  action values. A batch of inputs is pushed through one layer at a time
+ *  as a matrix product, so each weight loaded serves every row of the
+ *  batch. Weights are stored input-major in panels of PANEL_WIDTH outputs,
+ *  and the product is blocked so a panel's weights for BLOCK_INPUTS inputs
+ *  stay in L1 while the whole batch passes over them, four rows at a time
+ *  in FMA registers when the processor has AVX2.
+ *
+ *  Networks are built with add_layer() or read from a file written by
+ *  save() or by the Python trainer, all little-endian:
+ *
+ *    char[8]   "DSMLP001"
+ *    uint32    number of layers
+ *    per layer:
+ *      uint32  inputs
+ *      uint32  outputs
+ *      uint32  activation, 0 for none and 1 for ReLU
+ *      float32 weights[outputs][inputs], as torch.nn.Linear stores them
+ *      float32 bias[outputs]
+ *
+ *  Each layer's inputs must match the previous layer's outputs. After
+ *  quantize() the weights are kept as FP16, or INT8 with a scale for each
+ *  output, and widened to float inside the product, so a layer reads a
+ *  half or a quarter of the bytes.
+ *  forward() is const and safe on any number of threads, each with its own
+ *  Workspace.
+ */
+class Mlp
+{
+public:
+  //! Outputs are computed this many at a time, and layers pad to it.
+  static const int PANEL_WIDTH = 16;
+  //! Inputs accumulated per pass over a panel.
+  static const int BLOCK_INPUTS = 256;
+
+  //! Scratch space for forward(), reused between calls.
+  struct Workspace
+  {
+    std::vector<float> activations[2];
+  };
+
+  //! Construct a network with no layers.
+  Mlp();
+
+  Mlp(const Mlp& other);
+  Mlp& operator=(const Mlp& other);
+
+  //! Read a network file. Returns false, leaving the network empty, if the
+  //! file is missing or malformed.
+  bool load(const std::string& path);
+
+  //! Write the network in the format load() reads. Quantized weights are
+  //! written as the floats they stand for.
+  bool save(const std::string& path) const;
+
+  //! Store every layer's weights at a lower precision. Only from FLOAT32.
+  void quantize(Precision precision);
+
+  //! Append a layer. weights are [outputs][inputs] and bias [outputs].
+  void add_layer(int inputs, int outputs, Activation activation,
+                 const float* weights, const float* bias);
+
+  int number_of_layers() const { return static_cast<int>(m_layers.size()); }
+  int input_size() const;
+  int output_size() const;
+  //! The number of weights and biases in all layers.
+  long long number_of_parameters() const;
+  //! The precision weights are stored at, FLOAT32 until quantize().
+  Precision precision() const { return m_precision; }
+  //! The memory the weights, scales and biases take, padding included.
+  size_t weight_bytes() const;
+
+  /// Evaluate a batch of inputs.
+
+  //! inputs holds batch_size rows of input_size() floats and outputs gets
+  //! batch_size rows of output_size().
+  void forward(const float* inputs, int batch_size, float* outputs,
+               Workspace* workspace) const;
+
+  //! Evaluate a batch with a temporary workspace.
+  void forward(const float* inputs, int batch_size, float* outputs) const;
+
+  /// Softmax over the legal entries of each row of logits.
+
+  //! legal holds a byte per logit, nonzero where the action may be taken.
+  //! Illegal actions get probability zero. A row with no legal actions is
+  //! all zeros.
+  static void softmax(const float* logits, const uint8_t* legal, int batch_size,
+                      int width, float* probabilities);
+
+private:
+  struct Layer
+  {
+    int inputs;
+    int outputs;
+    //! outputs rounded up to PANEL_WIDTH.
+    int padded_outputs;
+    Activation activation;
+    //! [inputs][padded_outputs] of m_precision, zero beyond outputs.
+    char* weights;
+    //! [padded_outputs], multiplying the sums. 1 unless INT8.
+    float* scales;
+    //! [padded_outputs].
+    float* bias;
+    size_t bytes;
+    std::unique_ptr<char[]> storage;
+  };
+
+  //! Allocate a layer's storage for its sizes at a precision.
+  static void allocate(Layer* layer, Precision precision);
+  //! A weight as the float it stands for.
+  float weight(const Layer& layer, int input, int output) const;
+  void copy_layers(const Mlp& other);
+
+  Precision m_precision;
+  std::vector<Layer> m_layers;
+
+}; // class Mlp
+
+//! The size of the inputs encode_observation() writes.
+int observation_input_size();
+
+/// Write a decision's features as dense inputs for a network.
+
+//! The features are LinearQFunction::active_features(), one input each,
+//! 1 when active and 0 otherwise, so a network can be trained on the same
+//! view of the game as the linear learner.
+void encode_observation(const Observation& observation,
+                        sheepshead::interface::Play::PlayType play_type, float* inputs);
+
+} // namespace learning
+#endif
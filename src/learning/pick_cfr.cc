@@ -0,0 +1,514 @@
+#include "pick_cfr.h"
+
+#include "learning/deal_stream.h"
+#include "learning/trick_position.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
+using sheepshead::interface::Card;
+using sheepshead::interface::Hand;
+using sheepshead::interface::LonerDecision;
+using sheepshead::interface::PickDecision;
+using sheepshead::interface::Play;
+
+namespace learning {
+
+namespace {
+
+const char MAGIC[8] = {'D', 'S', 'P', 'C', 'F', 'R', '0', '1'};
+
+template<typename T>
+bool read_value(std::istream& in, T* value)
+{
+  return static_cast<bool>(in.read(reinterpret_cast<char*>(value), sizeof(T)));
+}
+
+template<typename T>
+void write_value(std::ostream& out, T value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Hogwild addition: concurrent adds may lose one another, but never tear.
+void add_relaxed(std::atomic<float>* value, float addend)
+{
+  value->store(value->load(std::memory_order_relaxed) + addend, std::memory_order_relaxed);
+}
+
+int sample_action(const float* probabilities, int number_of_actions,
+                  std::default_random_engine& generator)
+{
+  std::uniform_real_distribution<float> distribution(0, 1);
+  float draw = distribution(generator);
+  for(int action = 0; action < number_of_actions - 1; action++) {
+    draw -= probabilities[action];
+    if(draw < 0) return action;
+  }
+  return number_of_actions - 1;
+}
+
+// Normalize the positive parts of values, or spread evenly if there are none.
+void normalize_positive(const std::atomic<float>* values, int number_of_actions,
+                        float* probabilities)
+{
+  float total = 0;
+  for(int action = 0; action < number_of_actions; action++) {
+    probabilities[action] = std::max(0.0f, values[action].load(std::memory_order_relaxed));
+    total += probabilities[action];
+  }
+  for(int action = 0; action < number_of_actions; action++) {
+    probabilities[action] = total > 0 ? probabilities[action] / total : 1.0f / number_of_actions;
+  }
+}
+
+// Play a deal's picking round, letting choose make every decision with a
+// choice, then the tricks with the rollout policy, and write each seat's
+// reward. choose is called with the number of choices made before, the
+// seat, the information set and its number of actions, and returns an
+// abstract action.
+template<typename Chooser>
+void play_deal(const sheepshead::interface::Rules& rules, const Deck& deck,
+               const Policy& rollout_policy, std::default_random_engine& generator,
+               const Chooser& choose, std::vector<int>* rewards)
+{
+  auto hand = Hand(rules, deck);
+  std::vector<int> actions;
+  int choices = 0;
+  while(!hand.is_finished() && !hand.history().picking_round().is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand.current_player();
+    auto available_plays = hand.available_plays(player);
+    int information_set = PickCfr::information_set(hand, available_plays, &actions);
+    int index = actions.empty() ? 0 : actions[0];
+    if(information_set >= 0) {
+      index = actions[choose(choices++, seat_index(hand, player), information_set,
+                             static_cast<int>(actions.size()))];
+    }
+    bool made = hand.playmaker(player).make_play(available_plays[index]);
+    assert(made);
+    (void)made;
+  }
+
+  int number_of_players = rules.number_of_players();
+  rewards->assign(number_of_players, 0);
+  // A doubler hand ends without tricks.
+  if(hand.is_finished()) {
+    for(int seat = 0; seat < number_of_players; seat++) {
+      (*rewards)[seat] = hand.reward(player_at_seat(hand, seat));
+    }
+    return;
+  }
+  TrickPosition position(hand);
+  while(!position.is_finished()) {
+    position.make_move(rollout_policy.choose_card(position, generator));
+  }
+  for(int seat = 0; seat < number_of_players; seat++) (*rewards)[seat] = position.reward(seat);
+}
+
+// A choice the updated seat made in an iteration.
+struct SampledChoice
+{
+  int information_set;
+  int number_of_actions;
+  int action;
+  float strategy[PickCfr::MAX_ACTIONS];
+  float sample_probability;
+};
+
+// A choice on the path an exploitability estimate deviates from.
+struct PathChoice
+{
+  int seat;
+  int information_set;
+  int number_of_actions;
+  int action;
+};
+
+// What deviating at one information set was worth, summed over deals.
+struct Deviation
+{
+  double action_sums[PickCfr::MAX_ACTIONS];
+  double strategy_sum;
+};
+
+} // namespace
+
+const int PickCfr::MAX_ACTIONS;
+const int PickCfr::DECISION_KINDS;
+const int PickCfr::MAX_SEATS;
+const int PickCfr::HOLDING_BUCKETS;
+const int PickCfr::INFORMATION_SETS;
+
+PickCfrConfig::PickCfrConfig()
+  : iterations(200000), number_of_threads(std::max(1u, std::thread::hardware_concurrency())),
+    exploration(0.6), exploitability_interval(50000), exploitability_deals(200), seed(0)
+{}
+
+PickCfrProgress::PickCfrProgress()
+  : iterations(0), seconds(0), iterations_per_second(0), exploitability(-1)
+{}
+
+PickCfr::PickCfr(const sheepshead::interface::Rules& rules, const Policy* rollout_policy)
+  : m_rules(rules), m_rollout_policy(rollout_policy),
+    m_regrets(new std::atomic<float>[INFORMATION_SETS * MAX_ACTIONS]),
+    m_strategy_sums(new std::atomic<float>[INFORMATION_SETS * MAX_ACTIONS])
+{
+  assert(rules.number_of_players() <= MAX_SEATS);
+  for(int slot = 0; slot < INFORMATION_SETS * MAX_ACTIONS; slot++) {
+    m_regrets[slot].store(0, std::memory_order_relaxed);
+    m_strategy_sums[slot].store(0, std::memory_order_relaxed);
+  }
+}
+
+int PickCfr::holding_bucket(CardMask cards, bool trump_is_clubs)
+{
+  auto trump_suit = trump_is_clubs ? Card::Suit::CLUBS : Card::Suit::DIAMONDS;
+  int queens = 0, jacks = 0, other_trump = 0, fail_aces = 0;
+  for(; cards; cards &= cards - 1) {
+    int card = mask_first(cards);
+    auto rank = card_true_rank(card);
+    if(rank == Card::Rank::QUEEN) {
+      queens++;
+    } else if(rank == Card::Rank::JACK) {
+      jacks++;
+    } else if(card_true_suit(card) == trump_suit) {
+      other_trump++;
+    } else if(rank == Card::Rank::ACE) {
+      fail_aces++;
+    }
+  }
+  return ((queens * 5 + jacks) * 7 + other_trump) * 4 + fail_aces;
+}
+
+int PickCfr::information_set(const Hand& hand, const std::vector<Play>& available_plays,
+                             std::vector<int>* actions)
+{
+  actions->clear();
+  auto play_type = available_plays[0].play_type();
+  if(play_type == Play::PlayType::TRICK_CARD) return -1;
+
+  switch(play_type) {
+    case Play::PlayType::PICK :
+      for(auto decision : {PickDecision::PASS, PickDecision::PICK}) {
+        for(size_t i = 0; i < available_plays.size(); i++) {
+          if(*available_plays[i].pick_decision() == decision) actions->push_back(i);
+        }
+      }
+      break;
+    case Play::PlayType::LONER :
+      for(auto decision : {LonerDecision::PARTNER, LonerDecision::LONER}) {
+        for(size_t i = 0; i < available_plays.size(); i++) {
+          if(*available_plays[i].loner_decision() == decision) actions->push_back(i);
+        }
+      }
+      break;
+    case Play::PlayType::DISCARD : {
+      // Bury the most points, keeping trump, first.
+      std::vector<int> scores;
+      for(size_t i = 0; i < available_plays.size(); i++) {
+        int score = 0;
+        for(auto& card : *available_plays[i].discard_decision()) {
+          score += card.is_trump() ? -100 : card.point_value();
+        }
+        scores.push_back(score);
+        actions->push_back(i);
+      }
+      std::stable_sort(actions->begin(), actions->end(),
+                       [&scores](int lhs, int rhs) { return scores[lhs] > scores[rhs]; });
+      break;
+    }
+    default :
+      for(size_t i = 0; i < available_plays.size(); i++) actions->push_back(i);
+      break;
+  }
+  if(actions->size() > static_cast<size_t>(MAX_ACTIONS)) actions->resize(MAX_ACTIONS);
+  if(actions->size() < 2) return -1;
+
+  auto player = hand.current_player();
+  auto seat = hand.seat(player);
+  CardMask held = 0;
+  for(auto card = seat.held_cards_begin(); card != seat.held_cards_end(); ++card) {
+    held |= card_bit(card_index(*card));
+  }
+  int bucket = holding_bucket(held, hand.rules().trump_is_clubs());
+  int kind = static_cast<int>(play_type);
+  return ((kind * MAX_SEATS + seat_index(hand, player)) * HOLDING_BUCKETS + bucket) *
+         (MAX_ACTIONS - 1) + actions->size() - 2;
+}
+
+void PickCfr::current_strategy(int information_set, int number_of_actions,
+                               float* probabilities) const
+{
+  normalize_positive(&m_regrets[information_set * MAX_ACTIONS], number_of_actions,
+                     probabilities);
+}
+
+void PickCfr::average_strategy(int information_set, int number_of_actions,
+                               float* probabilities) const
+{
+  normalize_positive(&m_strategy_sums[information_set * MAX_ACTIONS], number_of_actions,
+                     probabilities);
+}
+
+bool PickCfr::visited(int information_set) const
+{
+  for(int action = 0; action < MAX_ACTIONS; action++) {
+    if(m_strategy_sums[information_set * MAX_ACTIONS + action].load(std::memory_order_relaxed)
+       > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int PickCfr::visited_information_sets() const
+{
+  int count = 0;
+  for(int information_set = 0; information_set < INFORMATION_SETS; information_set++) {
+    if(visited(information_set)) count++;
+  }
+  return count;
+}
+
+PickCfrProgress PickCfr::train(const PickCfrConfig& config, const PickCfrCallback& on_progress)
+{
+  assert(config.iterations >= 0 && config.number_of_threads > 0);
+  assert(config.exploration > 0 && config.exploration <= 1);
+  unsigned long seed = config.seed;
+  if(seed == 0) {
+    seed = std::chrono::system_clock::now().time_since_epoch().count();
+  }
+  // Every estimate plays the same deals, so they can be compared.
+  unsigned long evaluation_seed = mix_seed(seed, 0);
+  DealStream deals(m_rules, seed);
+  int number_of_players = m_rules.number_of_players();
+
+  auto start = std::chrono::steady_clock::now();
+  auto progress_at = [&](long long iterations, double exploitability) {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    PickCfrProgress progress;
+    progress.iterations = iterations;
+    progress.seconds = elapsed.count();
+    if(progress.seconds > 0) progress.iterations_per_second = iterations / progress.seconds;
+    progress.exploitability = exploitability;
+    return progress;
+  };
+
+  std::atomic<long long> next_iteration(0);
+  std::atomic<long long> finished_iterations(0);
+  std::mutex estimate_mutex;
+  double latest_estimate = -1;
+
+  auto worker = [&]() {
+    std::vector<SampledChoice> choices;
+    std::vector<int> rewards;
+    for(long long n = next_iteration++; n < config.iterations; n = next_iteration++) {
+      std::default_random_engine generator(deals.play_seed(n));
+      int updated_seat = n % number_of_players;
+      choices.clear();
+
+      auto choose = [&](int, int seat, int information_set, int number_of_actions) {
+        float strategy[MAX_ACTIONS];
+        current_strategy(information_set, number_of_actions, strategy);
+        if(seat != updated_seat) {
+          for(int action = 0; action < number_of_actions; action++) {
+            add_relaxed(&m_strategy_sums[information_set * MAX_ACTIONS + action],
+                        strategy[action]);
+          }
+          return sample_action(strategy, number_of_actions, generator);
+        }
+
+        SampledChoice choice;
+        choice.information_set = information_set;
+        choice.number_of_actions = number_of_actions;
+        float sampling[MAX_ACTIONS];
+        for(int action = 0; action < number_of_actions; action++) {
+          choice.strategy[action] = strategy[action];
+          sampling[action] = config.exploration / number_of_actions +
+                             (1 - config.exploration) * strategy[action];
+        }
+        choice.action = sample_action(sampling, number_of_actions, generator);
+        choice.sample_probability = sampling[choice.action];
+        choices.push_back(choice);
+        return choice.action;
+      };
+      play_deal(m_rules, deals.deck(n), *m_rollout_policy, generator, choose, &rewards);
+
+      // Only the updated seat's sampling is corrected for: the others
+      // sampled on-policy and chance exactly, so their probabilities cancel.
+      double sample_probability = 1;
+      for(auto& choice : choices) sample_probability *= choice.sample_probability;
+      double weighted_reward = rewards[updated_seat] / sample_probability;
+      double tail = 1;
+      for(auto choice = choices.rbegin(); choice != choices.rend(); ++choice) {
+        double sampled_value = weighted_reward * tail;
+        float sampled_strategy = choice->strategy[choice->action];
+        for(int action = 0; action < choice->number_of_actions; action++) {
+          double regret = action == choice->action ? sampled_value * (1 - sampled_strategy)
+                                                   : -sampled_value * sampled_strategy;
+          add_relaxed(&m_regrets[choice->information_set * MAX_ACTIONS + action], regret);
+        }
+        tail *= sampled_strategy;
+      }
+
+      long long finished = ++finished_iterations;
+      if(config.exploitability_interval > 0 && finished % config.exploitability_interval == 0) {
+        std::lock_guard<std::mutex> lock(estimate_mutex);
+        latest_estimate = estimate_exploitability(config.exploitability_deals, evaluation_seed);
+        if(on_progress) on_progress(*this, progress_at(finished, latest_estimate));
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int i = 0; i < config.number_of_threads; i++) threads.emplace_back(worker);
+  for(auto& thread : threads) thread.join();
+
+  return progress_at(finished_iterations, latest_estimate);
+}
+
+double PickCfr::estimate_exploitability(int deals, unsigned long seed) const
+{
+  DealStream stream(m_rules, seed);
+  std::unordered_map<int, Deviation> deviations;
+  std::vector<PathChoice> path;
+  std::vector<int> rewards;
+
+  for(int deal = 0; deal < deals; deal++) {
+    auto deck = stream.deck(deal);
+    unsigned long play_seed = stream.play_seed(deal);
+
+    // Everyone follows the average strategy.
+    path.clear();
+    std::default_random_engine generator(play_seed);
+    auto follow = [&](int, int seat, int information_set, int number_of_actions) {
+      float strategy[MAX_ACTIONS];
+      average_strategy(information_set, number_of_actions, strategy);
+      PathChoice choice;
+      choice.seat = seat;
+      choice.information_set = information_set;
+      choice.number_of_actions = number_of_actions;
+      choice.action = sample_action(strategy, number_of_actions, generator);
+      path.push_back(choice);
+      return choice.action;
+    };
+    play_deal(m_rules, deck, *m_rollout_policy, generator, follow, &rewards);
+
+    // Try every action at each choice on the way, finishing each the same way.
+    for(size_t step = 0; step < path.size(); step++) {
+      const PathChoice& deviating = path[step];
+      float strategy[MAX_ACTIONS];
+      average_strategy(deviating.information_set, deviating.number_of_actions, strategy);
+      auto inserted = deviations.insert({deviating.information_set, Deviation()});
+      Deviation& deviation = inserted.first->second;
+      if(inserted.second) {
+        std::fill(deviation.action_sums, deviation.action_sums + MAX_ACTIONS, 0.0);
+        deviation.strategy_sum = 0;
+      }
+
+      for(int action = 0; action < deviating.number_of_actions; action++) {
+        std::default_random_engine finish_generator(mix_seed(play_seed, step));
+        auto deviate = [&](int choices, int, int information_set, int number_of_actions) {
+          if(choices < static_cast<int>(step)) return path[choices].action;
+          if(choices == static_cast<int>(step)) return action;
+          float finish_strategy[MAX_ACTIONS];
+          average_strategy(information_set, number_of_actions, finish_strategy);
+          return sample_action(finish_strategy, number_of_actions, finish_generator);
+        };
+        play_deal(m_rules, deck, *m_rollout_policy, finish_generator, deviate, &rewards);
+        deviation.action_sums[action] += rewards[deviating.seat];
+        deviation.strategy_sum += strategy[action] * rewards[deviating.seat];
+      }
+    }
+  }
+
+  double gain = 0;
+  for(auto& entry : deviations) {
+    int number_of_actions = entry.first % (MAX_ACTIONS - 1) + 2;
+    const Deviation& deviation = entry.second;
+    double best = *std::max_element(deviation.action_sums,
+                                    deviation.action_sums + number_of_actions);
+    gain += best - deviation.strategy_sum;
+  }
+  return deals > 0 ? gain / deals / m_rules.number_of_players() : 0;
+}
+
+bool PickCfr::save(const std::string& path) const
+{
+  std::ofstream out(path, std::ios::binary);
+  out.write(MAGIC, sizeof(MAGIC));
+  write_value<uint32_t>(out, m_rules.number_of_players());
+  write_value<uint32_t>(out, m_rules.trump_is_clubs());
+  write_value<uint32_t>(out, INFORMATION_SETS);
+  write_value<uint32_t>(out, MAX_ACTIONS);
+  for(int slot = 0; slot < INFORMATION_SETS * MAX_ACTIONS; slot++) {
+    write_value<float>(out, m_regrets[slot].load(std::memory_order_relaxed));
+  }
+  for(int slot = 0; slot < INFORMATION_SETS * MAX_ACTIONS; slot++) {
+    write_value<float>(out, m_strategy_sums[slot].load(std::memory_order_relaxed));
+  }
+  return static_cast<bool>(out);
+}
+
+bool PickCfr::load(const std::string& path)
+{
+  std::ifstream in(path, std::ios::binary);
+  if(!in) return false;
+  char magic[sizeof(MAGIC)];
+  uint32_t number_of_players = 0;
+  uint32_t trump_is_clubs = 0;
+  uint32_t information_sets = 0;
+  uint32_t max_actions = 0;
+  if(!in.read(magic, sizeof(magic)) || memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+     !read_value(in, &number_of_players) || !read_value(in, &trump_is_clubs) ||
+     !read_value(in, &information_sets) || !read_value(in, &max_actions) ||
+     static_cast<int>(number_of_players) != m_rules.number_of_players() ||
+     (trump_is_clubs != 0) != m_rules.trump_is_clubs() ||
+     information_sets != INFORMATION_SETS || max_actions != MAX_ACTIONS) {
+    return false;
+  }
+
+  std::vector<float> values(2 * INFORMATION_SETS * MAX_ACTIONS);
+  if(!in.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(float))) {
+    return false;
+  }
+  for(int slot = 0; slot < INFORMATION_SETS * MAX_ACTIONS; slot++) {
+    m_regrets[slot].store(values[slot], std::memory_order_relaxed);
+    m_strategy_sums[slot].store(values[INFORMATION_SETS * MAX_ACTIONS + slot],
+                                std::memory_order_relaxed);
+  }
+  return true;
+}
+
+CfrPickPolicy::CfrPickPolicy(const PickCfr* cfr, int pick_threshold)
+  : HeuristicPolicy(pick_threshold), m_cfr(cfr)
+{}
+
+Play CfrPickPolicy::choose_picking_play(const Hand& hand, const std::vector<Play>& available_plays,
+                                        std::default_random_engine& generator) const
+{
+  auto rules = hand.rules();
+  std::vector<int> actions;
+  int information_set = PickCfr::information_set(hand, available_plays, &actions);
+  if(information_set < 0 || !m_cfr->visited(information_set) ||
+     rules.number_of_players() != m_cfr->rules().number_of_players() ||
+     rules.trump_is_clubs() != m_cfr->rules().trump_is_clubs()) {
+    return HeuristicPolicy::choose_picking_play(hand, available_plays, generator);
+  }
+  float strategy[PickCfr::MAX_ACTIONS];
+  m_cfr->average_strategy(information_set, actions.size(), strategy);
+  return available_plays[actions[sample_action(strategy, actions.size(), generator)]];
+}
+
+} // namespace learning
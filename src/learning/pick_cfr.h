@@ -0,0 +1,176 @@
+#ifndef DEEPSHEEP_LEARNING_PICKCFR_H_
+#define DEEPSHEEP_LEARNING_PICKCFR_H_
+
+#include "learning/card_mask.h"
+#include "learning/policy.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/playmaker.h"
+#include "sheepshead/interface/rules.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace learning {
+
+/// Options for training a PickCfr.
+struct PickCfrConfig
+{
+  PickCfrConfig();
+
+  //! Sampled deals to learn from, over all threads.
+  long long iterations;
+  int number_of_threads;
+  //! How much the updated seat's sampling mixes in uniform play, so every
+  //! action keeps being tried.
+  float exploration;
+  //! Estimate exploitability after every this many iterations. Zero for never.
+  long long exploitability_interval;
+  //! Deals each exploitability estimate plays.
+  int exploitability_deals;
+  //! Seed for dealing and sampling. Zero means seed from the clock.
+  unsigned long seed;
+};
+
+/// How far training has got.
+struct PickCfrProgress
+{
+  PickCfrProgress();
+
+  long long iterations;
+  double seconds;
+  double iterations_per_second;
+  //! The latest estimate, in reward per hand, or -1 if none was made.
+  double exploitability;
+};
+
+class PickCfr;
+
+typedef std::function<void(const PickCfr& cfr, const PickCfrProgress& progress)>
+    PickCfrCallback;
+
+/// Strategies for the picking round learned by outcome-sampling Monte Carlo CFR.
+
+/** The picking round, from the first pick or pass through going alone,
+ *  calling a partner, placing an unknown card and discarding, is treated
+ *  as a game of its own whose payoffs come from playing the tricks with a
+ *  fixed rollout policy.
+ *
+ *  A player's information set is the kind of decision, their seat, how many
+ *  abstract actions they have, and their holding abstracted to counts of
+ *  queens, jacks, other trump and fail aces. Seats decide in order, so the
+ *  seat says what they've seen of the others. Pick and loner decisions are
+ *  their two options. For the rest, the legal plays are ranked, discards by
+ *  the points buried less a penalty for burying trump, and the first
+ *  MAX_ACTIONS are the abstract actions.
+ *
+ *  Every information set has MAX_ACTIONS slots of cumulative regret and of
+ *  cumulative strategy in two flat arrays of relaxed atomics, so threads
+ *  train at once without locks, Hogwild style, as QFunction does. Each
+ *  iteration samples a deal and one seat to update. That seat samples from
+ *  its regret-matching strategy mixed with uniform play, and the others
+ *  sample on-policy and add their strategy to the averages. The updated
+ *  seat's sampled regrets are weighted by the inverse of its own sampling
+ *  probability, which keeps them unbiased.
+ */
+class PickCfr
+{
+public:
+  static const int MAX_ACTIONS = 4;
+  static const int DECISION_KINDS = 5;
+  static const int MAX_SEATS = 5;
+  //! Queens 0-4, jacks 0-4, other trump 0-6, fail aces 0-3.
+  static const int HOLDING_BUCKETS = 5 * 5 * 7 * 4;
+  //! Information sets have 2 to MAX_ACTIONS actions.
+  static const int INFORMATION_SETS = DECISION_KINDS * MAX_SEATS * HOLDING_BUCKETS *
+                                      (MAX_ACTIONS - 1);
+
+  //! Trick play in training and evaluation uses rollout_policy, which isn't owned.
+  PickCfr(const sheepshead::interface::Rules& rules, const Policy* rollout_policy);
+
+  PickCfr(const PickCfr&) = delete;
+  PickCfr& operator=(const PickCfr&) = delete;
+
+  /// Run config.iterations iterations, calling on_progress after each exploitability estimate.
+
+  //! Iteration n is dealt and sampled from seeds derived from config.seed and n
+  //! alone. Estimates are made by the thread finishing each interval, one at
+  //! a time, while the others go on training. Training may be resumed by
+  //! calling train() again with another seed.
+  PickCfrProgress train(const PickCfrConfig& config,
+                        const PickCfrCallback& on_progress = PickCfrCallback());
+
+  /// Estimate how much a seat could gain by deviating from the average strategy.
+
+  //! Deals are played with every seat following the average strategy. At
+  //! each decision on the way, every abstract action is tried with the rest
+  //! played the same way from the same random numbers, and the results are
+  //! pooled by information set. The estimate is the mean over seats of what
+  //! taking each information set's best action would add per hand. It looks
+  //! one decision ahead, so it understates a full best response, while the
+  //! noise in picking each best action overstates it. The same deals and
+  //! seed give comparable estimates across training.
+  double estimate_exploitability(int deals, unsigned long seed) const;
+
+  /// The information set of the player to act in a Hand's picking round.
+
+  //! Writes the indices into available_plays of the abstract actions, in
+  //! order, and returns -1 when there's at most one.
+  static int information_set(const sheepshead::interface::Hand& hand,
+                             const std::vector<sheepshead::interface::Play>& available_plays,
+                             std::vector<int>* actions);
+
+  //! The holding bucket of a set of cards.
+  static int holding_bucket(CardMask cards, bool trump_is_clubs);
+
+  //! The strategy regret matching gives now, over number_of_actions actions.
+  void current_strategy(int information_set, int number_of_actions,
+                        float* probabilities) const;
+  //! The average strategy, or uniform for a set never reached.
+  void average_strategy(int information_set, int number_of_actions,
+                        float* probabilities) const;
+  //! Whether the average strategy of an information set has been updated.
+  bool visited(int information_set) const;
+  int visited_information_sets() const;
+
+  const sheepshead::interface::Rules& rules() const { return m_rules; }
+
+  //! Write the cumulative regrets and strategies. Returns false on failure.
+  bool save(const std::string& path) const;
+  //! Read what save() wrote for the same number of players and trump suit.
+  bool load(const std::string& path);
+
+private:
+  sheepshead::interface::Rules m_rules;
+  const Policy* m_rollout_policy;
+  std::unique_ptr<std::atomic<float>[]> m_regrets;
+  std::unique_ptr<std::atomic<float>[]> m_strategy_sums;
+
+}; // class PickCfr
+
+/// Make picking-round decisions by sampling a PickCfr's average strategy.
+
+/** Tricks, and decisions in information sets training never reached, are
+ *  left to HeuristicPolicy. Queries cost an abstraction and a table read.
+ *  The PickCfr is not owned and shouldn't train while the policy is used.
+ */
+class CfrPickPolicy : public HeuristicPolicy
+{
+public:
+  explicit CfrPickPolicy(const PickCfr* cfr, int pick_threshold = 8);
+
+protected:
+  sheepshead::interface::Play
+  choose_picking_play(const sheepshead::interface::Hand& hand,
+                      const std::vector<sheepshead::interface::Play>& available_plays,
+                      std::default_random_engine& generator) const override;
+
+private:
+  const PickCfr* m_cfr;
+
+}; // class CfrPickPolicy
+
+} // namespace learning
+#endif
@@ -0,0 +1,228 @@
+#include "pick_equity.h"
+
+#include "learning/deal_stream.h"
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::PickDecision;
+using sheepshead::interface::Play;
+
+namespace learning {
+
+namespace {
+
+const double Z_95 = 1.96;
+
+// Every set of size cards from cards, in increasing order of mask.
+void enumerate_subsets(CardMask cards, int size, CardMask chosen,
+                       std::vector<CardMask>* subsets)
+{
+  if(size == 0) {
+    subsets->push_back(chosen);
+    return;
+  }
+  for(CardMask remaining = cards; mask_size(remaining) >= size; remaining &= remaining - 1) {
+    int card = mask_first(remaining);
+    enumerate_subsets(remaining & (remaining - 1), size - 1, chosen | card_bit(card), subsets);
+  }
+}
+
+void append_cards(const std::vector<int>& cards, Deck* deck)
+{
+  for(int card : cards) deck->push_back({card_true_suit(card), card_true_rank(card)});
+}
+
+// Play a deal to the end with seat picking or passing, returning its reward.
+int play_deal(const sheepshead::interface::Rules& rules, const Deck& deck, int seat,
+              bool pick, const Policy& policy, unsigned long seed)
+{
+  std::default_random_engine generator(seed);
+  auto hand = Hand(rules, deck);
+  auto player = player_at_seat(hand, seat);
+
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto current_player = hand.current_player();
+    auto available_plays = hand.available_plays(current_player);
+    if(available_plays[0].play_type() != Play::PlayType::PICK) break;
+
+    // Seats before seat pass, and seat makes the decision being measured.
+    auto wanted = PickDecision::PASS;
+    if(current_player == player && pick) wanted = PickDecision::PICK;
+    auto play = available_plays[0];
+    for(auto& available_play : available_plays) {
+      if(*available_play.pick_decision() == wanted) play = available_play;
+    }
+    hand.playmaker(current_player).make_play(play);
+    if(current_player == player) break;
+  }
+
+  return policy.play_out(&hand, seat, generator);
+}
+
+// Combine per-deal values, laid out stratum by stratum, into a stratified
+// estimate. Without stratification every deal is an independent sample.
+RewardEstimate stratified_estimate(const std::vector<double>& values, int strata,
+                                   int deals_per_stratum, bool stratified)
+{
+  RewardEstimate estimate;
+  double mean = 0;
+  double variance_of_mean = 0;
+  for(int stratum = 0; stratum < strata; stratum++) {
+    auto begin = values.begin() + stratum * deals_per_stratum;
+    double stratum_mean = 0;
+    for(auto value = begin; value != begin + deals_per_stratum; ++value) {
+      stratum_mean += *value;
+    }
+    stratum_mean /= deals_per_stratum;
+    mean += stratum_mean;
+
+    if(deals_per_stratum > 1) {
+      double sum_of_squares = 0;
+      for(auto value = begin; value != begin + deals_per_stratum; ++value) {
+        sum_of_squares += (*value - stratum_mean) * (*value - stratum_mean);
+      }
+      variance_of_mean += sum_of_squares / (deals_per_stratum - 1) / deals_per_stratum;
+    }
+  }
+  mean /= strata;
+  variance_of_mean /= static_cast<double>(strata) * strata;
+
+  // One deal per stratum gives no within-stratum variance, so fall back to
+  // the variance of all deals, which overstates the error.
+  if((!stratified || deals_per_stratum == 1) && values.size() > 1) {
+    double sum_of_squares = 0;
+    for(double value : values) sum_of_squares += (value - mean) * (value - mean);
+    variance_of_mean = sum_of_squares / (values.size() - 1) / values.size();
+  }
+
+  estimate.mean = mean;
+  estimate.half_width = Z_95 * std::sqrt(variance_of_mean);
+  return estimate;
+}
+
+} // namespace
+
+PickEquityConfig::PickEquityConfig()
+  : deals_per_blind(8),
+    max_blinds(1000),
+    number_of_threads(std::max(1u, std::thread::hardware_concurrency())),
+    seed(0)
+{}
+
+RewardEstimate::RewardEstimate()
+  : mean(0), half_width(0)
+{}
+
+PickEquityResult::PickEquityResult()
+  : deals(0), strata(0), sampled_blinds(false)
+{}
+
+PickEquityResult estimate_pick_equity(const sheepshead::interface::Rules& rules,
+                                      int seat, CardMask dealt_cards,
+                                      const Policy& policy,
+                                      const PickEquityConfig& config)
+{
+  int number_of_players = rules.number_of_players();
+  int cards_per_player = rules.number_of_cards_per_player();
+  assert(seat >= 0 && seat < number_of_players);
+  assert(mask_size(dealt_cards) == cards_per_player);
+  assert(config.deals_per_blind > 0 && config.max_blinds > 0 && config.number_of_threads > 0);
+
+  unsigned long seed = config.seed;
+  if(seed == 0) {
+    seed = std::chrono::system_clock::now().time_since_epoch().count();
+  }
+
+  CardMask unseen = ~dealt_cards;
+  int blind_size = rules.number_of_cards_in_blinds();
+  std::vector<CardMask> blinds;
+  enumerate_subsets(unseen, blind_size, 0, &blinds);
+  bool sampled_blinds = static_cast<int>(blinds.size()) > config.max_blinds;
+  if(sampled_blinds) {
+    std::default_random_engine generator(seed);
+    std::uniform_int_distribution<size_t> distribution(0, blinds.size() - 1);
+    std::vector<CardMask> sample;
+    for(int i = 0; i < config.max_blinds; i++) sample.push_back(blinds[distribution(generator)]);
+    blinds.swap(sample);
+  }
+  int strata = blinds.size();
+  int deals_per_stratum = config.deals_per_blind;
+
+  std::vector<double> pick_rewards(strata * deals_per_stratum);
+  std::vector<double> pass_rewards(strata * deals_per_stratum);
+  std::atomic<int> next_stratum(0);
+
+  auto worker = [&]() {
+    for(int stratum = next_stratum++; stratum < strata; stratum = next_stratum++) {
+      std::default_random_engine generator(mix_seed(seed, stratum));
+      std::vector<int> others;
+      for(CardMask cards = unseen & ~blinds[stratum]; cards; cards &= cards - 1) {
+        others.push_back(mask_first(cards));
+      }
+      std::vector<int> own;
+      for(CardMask cards = dealt_cards; cards; cards &= cards - 1) {
+        own.push_back(mask_first(cards));
+      }
+      std::vector<int> blind;
+      for(CardMask cards = blinds[stratum]; cards; cards &= cards - 1) {
+        blind.push_back(mask_first(cards));
+      }
+
+      for(int deal = 0; deal < deals_per_stratum; deal++) {
+        std::shuffle(others.begin(), others.end(), generator);
+        Deck deck;
+        auto next_other = others.begin();
+        for(int dealt_seat = 0; dealt_seat < number_of_players; dealt_seat++) {
+          if(dealt_seat == seat) {
+            append_cards(own, &deck);
+          } else {
+            append_cards(std::vector<int>(next_other, next_other + cards_per_player), &deck);
+            next_other += cards_per_player;
+          }
+        }
+        append_cards(blind, &deck);
+
+        // Both plays of the deal draw the same random numbers.
+        unsigned long play_seed = generator();
+        int index = stratum * deals_per_stratum + deal;
+        pick_rewards[index] = play_deal(rules, deck, seat, true, policy, play_seed);
+        pass_rewards[index] = play_deal(rules, deck, seat, false, policy, play_seed);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int i = 0; i < config.number_of_threads; i++) threads.emplace_back(worker);
+  for(auto& thread : threads) thread.join();
+
+  std::vector<double> differences(pick_rewards.size());
+  for(size_t i = 0; i < differences.size(); i++) {
+    differences[i] = pick_rewards[i] - pass_rewards[i];
+  }
+
+  PickEquityResult result;
+  bool stratified = !sampled_blinds;
+  result.pick = stratified_estimate(pick_rewards, strata, deals_per_stratum, stratified);
+  result.pass = stratified_estimate(pass_rewards, strata, deals_per_stratum, stratified);
+  result.difference = stratified_estimate(differences, strata, deals_per_stratum, stratified);
+  result.deals = strata * deals_per_stratum;
+  result.strata = strata;
+  result.sampled_blinds = sampled_blinds;
+  return result;
+}
+
+} // namespace learning
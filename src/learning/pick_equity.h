@@ -0,0 +1,75 @@
+#ifndef DEEPSHEEP_LEARNING_PICKEQUITY_H_
+#define DEEPSHEEP_LEARNING_PICKEQUITY_H_
+
+#include "learning/card_mask.h"
+#include "learning/policy.h"
+#include "sheepshead/interface/rules.h"
+
+namespace learning {
+
+/// Options for estimating the value of picking.
+struct PickEquityConfig
+{
+  PickEquityConfig();
+
+  //! Opponent deals sampled for each blind.
+  int deals_per_blind;
+  //! The most blinds to enumerate. When the unseen cards can form more,
+  //! this many blinds are sampled at random instead.
+  int max_blinds;
+  //! The number of threads to play deals on.
+  int number_of_threads;
+  //! Seed for dealing and for the policy. Zero means seed from the clock.
+  unsigned long seed;
+};
+
+/// A mean reward and the half-width of its 95% confidence interval.
+struct RewardEstimate
+{
+  RewardEstimate();
+
+  double mean;
+  double half_width;
+};
+
+/// Expected rewards for picking and for passing a dealt hand.
+struct PickEquityResult
+{
+  PickEquityResult();
+
+  RewardEstimate pick;
+  RewardEstimate pass;
+  //! Picking's reward minus passing's, estimated from the paired deals.
+  RewardEstimate difference;
+  //! The number of deals played, each once picking and once passing.
+  int deals;
+  //! The number of blinds the deals were stratified over.
+  int strata;
+  //! Whether the blinds were sampled rather than enumerated.
+  bool sampled_blinds;
+};
+
+/// Estimate a seat's reward for picking and for passing its dealt cards.
+
+/** Every blind the unseen cards could form is a stratum with the same
+ *  probability, unless there are more than max_blinds of them, as with four
+ *  players, when max_blinds blinds are drawn at random. Within each,
+ *  deals_per_blind deals of the other unseen cards to the other seats are
+ *  sampled, and each deal is played to the end twice from the same random
+ *  numbers: once with seat picking and once with it passing. Seats asked
+ *  before seat always pass, and everything else is decided by policy.
+ *  Pairing the plays and stratifying by blind takes out much of the
+ *  variance between deals, so the difference is estimated more tightly
+ *  than either reward.
+ *
+ *  Results don't depend on number_of_threads, only on seed. When a seat
+ *  can't pass, because the rules force the last seat to pick, both plays
+ *  pick.
+ */
+PickEquityResult estimate_pick_equity(const sheepshead::interface::Rules& rules,
+                                      int seat, CardMask dealt_cards,
+                                      const Policy& policy,
+                                      const PickEquityConfig& config = PickEquityConfig());
+
+} // namespace learning
+#endif
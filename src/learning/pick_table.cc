@@ -0,0 +1,239 @@
+#include "pick_table.h"
+
+#include "learning/suit_permutation.h"
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using sheepshead::interface::PickDecision;
+using sheepshead::interface::Play;
+
+namespace learning {
+
+namespace {
+
+const char MAGIC[8] = {'D', 'S', 'P', 'I', 'C', 'K', '0', '1'};
+
+struct PickTableHeader
+{
+  char magic[8];
+  uint32_t number_of_players;
+  uint32_t trump_is_clubs;
+  uint32_t cards_per_player;
+  uint32_t value_scale;
+  uint64_t entries;
+};
+
+} // namespace
+
+PickTable::PickTable()
+  : m_mapping(nullptr), m_mapping_size(0), m_number_of_players(0),
+    m_trump_is_clubs(false), m_cards_per_player(0), m_entries(0), m_values(nullptr)
+{}
+
+PickTable::PickTable(const std::string& path)
+  : PickTable()
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if(fd < 0) return;
+
+  struct stat file_stat;
+  if(fstat(fd, &file_stat) != 0 ||
+     static_cast<size_t>(file_stat.st_size) < sizeof(PickTableHeader)) {
+    close(fd);
+    return;
+  }
+  size_t size = file_stat.st_size;
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(mapping == MAP_FAILED) return;
+
+  const PickTableHeader* header = static_cast<const PickTableHeader*>(mapping);
+  if(memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+     header->value_scale != VALUE_SCALE ||
+     header->number_of_players > TrickPosition::MAX_PLAYERS ||
+     header->entries != binomial(NUMBER_OF_CARDS, header->cards_per_player) ||
+     sizeof(PickTableHeader) + header->number_of_players * header->entries != size) {
+    munmap(mapping, size);
+    return;
+  }
+
+  m_mapping = mapping;
+  m_mapping_size = size;
+  m_number_of_players = header->number_of_players;
+  m_trump_is_clubs = header->trump_is_clubs;
+  m_cards_per_player = header->cards_per_player;
+  m_entries = header->entries;
+  m_values = reinterpret_cast<const int8_t*>(static_cast<const char*>(mapping) +
+                                             sizeof(PickTableHeader));
+}
+
+PickTable::~PickTable()
+{
+  if(m_mapping) munmap(m_mapping, m_mapping_size);
+}
+
+bool PickTable::lookup(int seat, CardMask dealt_cards, double* difference) const
+{
+  if(!m_values || seat < 0 || seat >= m_number_of_players ||
+     mask_size(dealt_cards) != m_cards_per_player) {
+    return false;
+  }
+  int8_t value = m_values[seat * m_entries + mask_rank(dealt_cards)];
+  if(value == MISSING) return false;
+  *difference = static_cast<double>(value) / VALUE_SCALE;
+  return true;
+}
+
+PickTableBuilder::PickTableBuilder(const sheepshead::interface::Rules& rules)
+  : m_number_of_players(rules.number_of_players()),
+    m_trump_is_clubs(rules.trump_is_clubs()),
+    m_cards_per_player(rules.number_of_cards_per_player()),
+    m_entries(binomial(NUMBER_OF_CARDS, m_cards_per_player))
+{
+  assert(m_entries <= PickTable::MAX_ENTRIES);
+  m_values.assign(m_number_of_players * m_entries, PickTable::MISSING);
+}
+
+void PickTableBuilder::set(int seat, CardMask dealt_cards, double difference)
+{
+  assert(seat >= 0 && seat < m_number_of_players);
+  assert(mask_size(dealt_cards) == m_cards_per_player);
+  double scaled = std::round(difference * PickTable::VALUE_SCALE);
+  int8_t value = static_cast<int8_t>(std::max(-127.0, std::min(127.0, scaled)));
+  for(int n = 0; n < SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+    auto permutation = SuitPermutation::fail_permutation(m_trump_is_clubs, n);
+    m_values[seat * m_entries + mask_rank(permutation.mask(dealt_cards))] = value;
+  }
+}
+
+bool PickTableBuilder::contains(int seat, CardMask dealt_cards) const
+{
+  return m_values[seat * m_entries + mask_rank(dealt_cards)] != PickTable::MISSING;
+}
+
+size_t PickTableBuilder::size() const
+{
+  return m_values.size() - std::count(m_values.begin(), m_values.end(), PickTable::MISSING);
+}
+
+bool PickTableBuilder::write(const std::string& path) const
+{
+  PickTableHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.number_of_players = m_number_of_players;
+  header.trump_is_clubs = m_trump_is_clubs;
+  header.cards_per_player = m_cards_per_player;
+  header.value_scale = PickTable::VALUE_SCALE;
+  header.entries = m_entries;
+
+  std::ofstream out(path, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(m_values.data()), m_values.size());
+  return static_cast<bool>(out);
+}
+
+std::vector<CardMask> canonical_hands(int number_of_cards, bool trump_is_clubs)
+{
+  SuitPermutation permutations[SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS];
+  for(int n = 0; n < SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+    permutations[n] = SuitPermutation::fail_permutation(trump_is_clubs, n);
+  }
+
+  // Step through the masks with number_of_cards bits in increasing order.
+  std::vector<CardMask> hands;
+  uint64_t mask = (uint64_t(1) << number_of_cards) - 1;
+  while(mask < (uint64_t(1) << NUMBER_OF_CARDS)) {
+    CardMask hand = mask;
+    bool canonical = true;
+    for(int n = 1; n < SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS && canonical; n++) {
+      canonical = permutations[n].mask(hand) >= hand;
+    }
+    if(canonical) hands.push_back(hand);
+
+    uint64_t lowest = mask & -mask;
+    uint64_t ripple = mask + lowest;
+    mask = ripple | (((mask ^ ripple) >> 2) / lowest);
+  }
+  return hands;
+}
+
+void generate_pick_table(const sheepshead::interface::Rules& rules, const Policy& policy,
+                         const PickEquityConfig& config, const std::vector<CardMask>& hands,
+                         PickTableBuilder* builder)
+{
+  unsigned long seed = config.seed;
+  if(seed == 0) {
+    seed = std::chrono::system_clock::now().time_since_epoch().count();
+  }
+
+  int number_of_players = rules.number_of_players();
+  size_t number_of_jobs = hands.size() * number_of_players;
+  std::atomic<size_t> next_job(0);
+
+  // Different hands fill different entries, even counting relabelings, so
+  // threads can set them without locking.
+  auto worker = [&]() {
+    PickEquityConfig job_config = config;
+    job_config.number_of_threads = 1;
+    for(size_t job = next_job++; job < number_of_jobs; job = next_job++) {
+      int seat = job % number_of_players;
+      CardMask hand = hands[job / number_of_players];
+      job_config.seed = seed + job;
+      auto result = estimate_pick_equity(rules, seat, hand, policy, job_config);
+      builder->set(seat, hand, result.difference.mean);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int i = 0; i < config.number_of_threads; i++) threads.emplace_back(worker);
+  for(auto& thread : threads) thread.join();
+}
+
+PickTablePolicy::PickTablePolicy(const PickTable* table, int pick_threshold)
+  : HeuristicPolicy(pick_threshold), m_table(table)
+{}
+
+Play PickTablePolicy::choose_picking_play(const sheepshead::interface::Hand& hand,
+                                          const std::vector<Play>& available_plays,
+                                          std::default_random_engine& generator) const
+{
+  if(available_plays[0].play_type() != Play::PlayType::PICK ||
+     hand.rules().number_of_players() != m_table->number_of_players() ||
+     hand.rules().trump_is_clubs() != m_table->trump_is_clubs()) {
+    return HeuristicPolicy::choose_picking_play(hand, available_plays, generator);
+  }
+
+  auto player = hand.current_player();
+  auto seat = hand.seat(player);
+  CardMask dealt_cards = 0;
+  for(auto card = seat.held_cards_begin(); card != seat.held_cards_end(); ++card) {
+    dealt_cards |= card_bit(card_index(*card));
+  }
+
+  double difference = 0;
+  if(!m_table->lookup(seat_index(hand, player), dealt_cards, &difference)) {
+    return HeuristicPolicy::choose_picking_play(hand, available_plays, generator);
+  }
+  auto wanted = difference > 0 ? PickDecision::PICK : PickDecision::PASS;
+  for(auto& play : available_plays) {
+    if(*play.pick_decision() == wanted) return play;
+  }
+  return available_plays[0];
+}
+
+} // namespace learning
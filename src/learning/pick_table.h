@@ -0,0 +1,139 @@
+#ifndef DEEPSHEEP_LEARNING_PICKTABLE_H_
+#define DEEPSHEEP_LEARNING_PICKTABLE_H_
+
+#include "learning/card_mask.h"
+#include "learning/pick_equity.h"
+#include "learning/policy.h"
+#include "sheepshead/interface/rules.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace learning {
+
+/// The value of picking for every hand a seat can be dealt, read from a file.
+
+/** For one number of players and trump suit, the table holds the expected
+ *  reward of picking minus that of passing, for each seat and each set of
+ *  cards the seat could be dealt, as estimate_pick_equity() finds it. Seats
+ *  are counted as in the picking round, so seat 0 decides first.
+ *
+ *  Entries are one byte, in units of 1 / VALUE_SCALE of a reward, indexed
+ *  by mask_rank() of the dealt cards, so a lookup is a rank and a load.
+ *  With six cards for five players that's under a megabyte a seat, and with
+ *  seven for four players a little over three. Three players' ten-card
+ *  hands are too many to tabulate. The file is memory mapped, so opening it
+ *  costs nothing and processes using the same file share its pages.
+ */
+class PickTable
+{
+public:
+  //! Stored differences are multiplied by this and rounded.
+  static const int VALUE_SCALE = 8;
+  //! The stored value of hands that weren't evaluated.
+  static const int8_t MISSING = -128;
+  //! The most entries a seat may have.
+  static const uint64_t MAX_ENTRIES = 1 << 22;
+
+  //! Construct an empty table that finds nothing.
+  PickTable();
+
+  //! Map a table file. Check is_open() for success.
+  explicit PickTable(const std::string& path);
+
+  ~PickTable();
+
+  PickTable(const PickTable&) = delete;
+  PickTable& operator=(const PickTable&) = delete;
+
+  bool is_open() const { return m_mapping != nullptr; }
+  int number_of_players() const { return m_number_of_players; }
+  bool trump_is_clubs() const { return m_trump_is_clubs; }
+  int cards_per_player() const { return m_cards_per_player; }
+
+  //! Find the expected reward of picking minus passing for a seat dealt cards.
+  //! Returns false if the hand wasn't evaluated.
+  bool lookup(int seat, CardMask dealt_cards, double* difference) const;
+
+private:
+  void* m_mapping;
+  size_t m_mapping_size;
+  int m_number_of_players;
+  bool m_trump_is_clubs;
+  int m_cards_per_player;
+  uint64_t m_entries;
+  const int8_t* m_values;
+
+}; // class PickTable
+
+/// Collects pick values and writes them as a PickTable file.
+class PickTableBuilder
+{
+public:
+  //! The rules must deal few enough cards that a seat has at most
+  //! PickTable::MAX_ENTRIES hands.
+  explicit PickTableBuilder(const sheepshead::interface::Rules& rules);
+
+  //! Set the value of a seat's hand, and of every relabeling of its fail suits.
+  void set(int seat, CardMask dealt_cards, double difference);
+
+  bool contains(int seat, CardMask dealt_cards) const;
+
+  //! The number of seat and hand entries set, relabelings included.
+  size_t size() const;
+
+  //! Write the file. Returns false on failure.
+  bool write(const std::string& path) const;
+
+private:
+  int m_number_of_players;
+  bool m_trump_is_clubs;
+  int m_cards_per_player;
+  uint64_t m_entries;
+  std::vector<int8_t> m_values;
+
+}; // class PickTableBuilder
+
+/// Every hand of number_of_cards cards that is canonical under the fail-suit relabelings.
+
+//! Hands are canonical when no relabeling gives a smaller mask. The result
+//! is in increasing order of mask.
+std::vector<CardMask> canonical_hands(int number_of_cards, bool trump_is_clubs);
+
+/// Estimate pick values for hands and add them to a builder.
+
+//! Each seat and hand is estimated with estimate_pick_equity() using config,
+//! except that the hands are spread over config.number_of_threads threads
+//! and each estimate runs on one. Each seat and hand gets its own seed,
+//! derived from config.seed.
+void generate_pick_table(const sheepshead::interface::Rules& rules, const Policy& policy,
+                         const PickEquityConfig& config, const std::vector<CardMask>& hands,
+                         PickTableBuilder* builder);
+
+/// Decide whether to pick by looking the hand up in a PickTable, and the rest heuristically.
+
+/** Picks when the table says picking is worth more than passing. Hands
+ *  missing from the table, or a table for other rules, fall back to
+ *  HeuristicPolicy's hand strength.
+ */
+class PickTablePolicy : public HeuristicPolicy
+{
+public:
+  //! The table is not owned.
+  explicit PickTablePolicy(const PickTable* table, int pick_threshold = 8);
+
+protected:
+  sheepshead::interface::Play
+  choose_picking_play(const sheepshead::interface::Hand& hand,
+                      const std::vector<sheepshead::interface::Play>& available_plays,
+                      std::default_random_engine& generator) const override;
+
+private:
+  const PickTable* m_table;
+
+}; // class PickTablePolicy
+
+} // namespace learning
+#endif
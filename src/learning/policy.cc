@@ -0,0 +1,267 @@
+#include "policy.h"
+
+#include "learning/double_dummy_solver.h"
+#include "learning/trick_position.h"
+
+#include <cassert>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::LonerDecision;
+using sheepshead::interface::PickDecision;
+using sheepshead::interface::Play;
+using sheepshead::interface::PlayerId;
+
+namespace learning {
+
+namespace {
+
+// Whether the player in seat knows other to be a teammate (1), an opponent
+// (-1), or can't tell yet (0).
+int known_relation(const TrickPosition& position, int seat, int other)
+{
+  if(position.is_leasters()) return -1;
+  bool same_team = position.on_picking_team(seat) == position.on_picking_team(other);
+  if(position.partner_revealed() || position.partner() < 0 || seat == position.partner()) {
+    return same_team ? 1 : -1;
+  }
+  // The partner is hidden, and seat is the picker or a defender.
+  if(other == position.picker()) return -1;
+  return 0;
+}
+
+Play play_for_card(const std::vector<Play>& available_plays, int card)
+{
+  for(auto& play : available_plays) {
+    if(card_index(*play.trick_card_decision()) == card) return play;
+  }
+  assert(false);
+  return available_plays[0];
+}
+
+// The card to lead: the picking team pulls trump with its strongest, and
+// the defenders lead their cheapest fail card.
+int choose_lead(const TrickPosition& position, CardMask legal)
+{
+  bool picking_team = position.on_picking_team(position.to_play());
+  CardMask trump = legal & position.suit_mask(TrickPosition::TRUMP_SUIT);
+  CardMask fail = legal & ~trump;
+
+  int best_card = NO_CARD;
+  int best_score = 0;
+  for(CardMask cards = legal; cards; cards &= cards - 1) {
+    int card = mask_first(cards);
+    bool is_trump = position.effective_suit(card) == TrickPosition::TRUMP_SUIT;
+    int score = 0;
+    if(picking_team && trump) {
+      score = is_trump ? position.strength(card) : -100;
+    } else if(fail) {
+      score = is_trump ? -100 : -4 * card_point_value(card) - position.strength(card);
+    } else {
+      score = -4 * card_point_value(card) - position.strength(card);
+    }
+    if(best_card == NO_CARD || score > best_score) {
+      best_card = card;
+      best_score = score;
+    }
+  }
+  return best_card;
+}
+
+int choose_follow(const TrickPosition& position, CardMask legal)
+{
+  int seat = position.to_play();
+  int led_suit = position.effective_suit(position.trick_card(0));
+  int winning_offset = position.trick_winning_offset();
+  int winning_card = position.trick_card(winning_offset);
+  int winning_seat = (position.leader() + winning_offset) % position.number_of_players();
+  int winning_score = position.trick_score(winning_card, led_suit);
+  int relation = known_relation(position, seat, winning_seat);
+
+  int best_card = NO_CARD;
+  int best_score = 0;
+  for(CardMask cards = legal; cards; cards &= cards - 1) {
+    int card = mask_first(cards);
+    int score = position.trick_score(card, led_suit);
+    int points = card_point_value(card);
+    bool wins = score > winning_score;
+    int value = 0;
+    if(position.is_leasters()) {
+      // Stay out of tricks, giving away points when someone else takes them.
+      value = wins ? -1000 - score : 4 * points + score;
+    } else if(relation > 0) {
+      // Schmear onto a teammate's trick without wasting trump.
+      value = wins ? -(score > 0 ? score : 0) : 4 * points - (score > 0 ? score : 0);
+    } else if(wins) {
+      // Take the trick as cheaply as possible.
+      value = 1000 - score + points;
+    } else {
+      value = -100 - 4 * points - (score > 0 ? score : 0);
+    }
+    if(best_card == NO_CARD || value > best_score) {
+      best_card = card;
+      best_score = value;
+    }
+  }
+  return best_card;
+}
+
+} // namespace
+
+Policy::~Policy() {}
+
+Play Policy::choose_play(const Hand& hand, std::default_random_engine& generator) const
+{
+  auto available_plays = hand.available_plays(hand.current_player());
+  assert(!available_plays.empty());
+  if(available_plays.size() == 1) return available_plays[0];
+  if(available_plays[0].play_type() == Play::PlayType::TRICK_CARD) {
+    return play_for_card(available_plays, choose_card(TrickPosition(hand), generator));
+  }
+  return choose_picking_play(hand, available_plays, generator);
+}
+
+Play Policy::choose_picking_play(const Hand&, const std::vector<Play>& available_plays,
+                                 std::default_random_engine&) const
+{
+  return available_plays[0];
+}
+
+void Policy::play_to_end(Hand* hand, std::default_random_engine& generator) const
+{
+  while(!hand->is_finished()) {
+    if(hand->is_arbitrable()) {
+      hand->arbiter().arbitrate();
+      continue;
+    }
+    auto play = choose_play(*hand, generator);
+    bool made = hand->playmaker(hand->current_player()).make_play(play);
+    assert(made);
+    (void)made;
+  }
+}
+
+int Policy::play_out(Hand* hand, int seat, std::default_random_engine& generator) const
+{
+  while(!hand->is_finished() && !hand->history().picking_round().is_finished()) {
+    if(hand->is_arbitrable()) {
+      hand->arbiter().arbitrate();
+      continue;
+    }
+    auto play = choose_play(*hand, generator);
+    bool made = hand->playmaker(hand->current_player()).make_play(play);
+    assert(made);
+    (void)made;
+  }
+  // A doubler hand ends without tricks.
+  if(hand->is_finished()) return hand->reward(player_at_seat(*hand, seat));
+
+  TrickPosition position(*hand);
+  while(!position.is_finished()) position.make_move(choose_card(position, generator));
+  return position.reward(seat);
+}
+
+int RandomPolicy::choose_card(const TrickPosition& position,
+                              std::default_random_engine& generator) const
+{
+  CardMask legal = position.legal_moves();
+  std::uniform_int_distribution<int> distribution(0, mask_size(legal) - 1);
+  return mask_nth(legal, distribution(generator));
+}
+
+Play RandomPolicy::choose_picking_play(const Hand&, const std::vector<Play>& available_plays,
+                                       std::default_random_engine& generator) const
+{
+  std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+  return available_plays[distribution(generator)];
+}
+
+HeuristicPolicy::HeuristicPolicy(int pick_threshold)
+  : m_pick_threshold(pick_threshold)
+{}
+
+int HeuristicPolicy::hand_strength(const Hand& hand, const PlayerId& player)
+{
+  int strength = 0;
+  auto seat = hand.seat(player);
+  for(auto card = seat.held_cards_begin(); card != seat.held_cards_end(); ++card) {
+    if(card->true_rank() == sheepshead::interface::Card::Rank::QUEEN) {
+      strength += 3;
+    } else if(card->true_rank() == sheepshead::interface::Card::Rank::JACK) {
+      strength += 2;
+    } else if(card->is_trump()) {
+      strength += 1;
+    } else if(card->true_rank() == sheepshead::interface::Card::Rank::ACE) {
+      strength += 1;
+    }
+  }
+  return strength;
+}
+
+int HeuristicPolicy::choose_card(const TrickPosition& position,
+                                 std::default_random_engine&) const
+{
+  CardMask legal = position.legal_moves();
+  if(position.trick_size() == 0) return choose_lead(position, legal);
+  return choose_follow(position, legal);
+}
+
+Play HeuristicPolicy::choose_picking_play(const Hand& hand, const std::vector<Play>& available_plays,
+                                          std::default_random_engine&) const
+{
+  switch(available_plays[0].play_type()) {
+    case Play::PlayType::PICK : {
+      auto wanted = hand_strength(hand, hand.current_player()) >= m_pick_threshold ?
+                    PickDecision::PICK : PickDecision::PASS;
+      for(auto& play : available_plays) {
+        if(*play.pick_decision() == wanted) return play;
+      }
+      break;
+    }
+    case Play::PlayType::LONER : {
+      for(auto& play : available_plays) {
+        if(*play.loner_decision() == LonerDecision::PARTNER) return play;
+      }
+      break;
+    }
+    case Play::PlayType::DISCARD : {
+      // Bury the most points, keeping trump.
+      size_t best = 0;
+      int best_score = 0;
+      for(size_t i = 0; i < available_plays.size(); i++) {
+        int score = 0;
+        for(auto& card : *available_plays[i].discard_decision()) {
+          score += card.is_trump() ? -100 : card.point_value();
+        }
+        if(i == 0 || score > best_score) {
+          best = i;
+          best_score = score;
+        }
+      }
+      return available_plays[best];
+    }
+    default :
+      break;
+  }
+  return available_plays[0];
+}
+
+SolverPolicy::SolverPolicy(int pick_threshold)
+  : HeuristicPolicy(pick_threshold)
+{}
+
+int SolverPolicy::choose_card(const TrickPosition& position,
+                              std::default_random_engine& generator) const
+{
+  CardMask legal = position.legal_moves();
+  if(mask_size(legal) == 1) return mask_first(legal);
+  if(position.is_leasters()) return HeuristicPolicy::choose_card(position, generator);
+
+  // Each thread keeps a table across calls: keys include the whole deal, so
+  // entries from earlier in a hand stay valid and speed up the later solves.
+  static thread_local TranspositionTable table(8);
+  table.new_search();
+  DoubleDummySolver solver(&table);
+  return solver.solve(position).best_card;
+}
+
+} // namespace learning
@@ -0,0 +1,124 @@
+#ifndef DEEPSHEEP_LEARNING_POLICY_H_
+#define DEEPSHEEP_LEARNING_POLICY_H_
+
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/playmaker.h"
+
+#include <random>
+#include <vector>
+
+namespace learning {
+
+/// A way of choosing plays for whichever player is to act in a Hand.
+
+/** Trick cards are chosen from a TrickPosition, which is far cheaper to play
+ *  on than a Hand, so many deals can be played out quickly. A policy should
+ *  only use what the player to move could see there, unless it says
+ *  otherwise. Policies are shared between threads, so choosing must not
+ *  change the policy. Randomness comes from the generator the caller passes
+ *  in.
+ */
+class Policy
+{
+public:
+  virtual ~Policy();
+
+  /// Choose one of the available plays for the current player of a playable Hand.
+
+  //! Trick card decisions are made with choose_card().
+  virtual sheepshead::interface::Play
+  choose_play(const sheepshead::interface::Hand& hand,
+              std::default_random_engine& generator) const;
+
+  //! Choose a legal card for the player to move in an unfinished position.
+  virtual int choose_card(const TrickPosition& position,
+                          std::default_random_engine& generator) const = 0;
+
+  //! Arbitrate and play a Hand to the end, every player using this policy.
+  void play_to_end(sheepshead::interface::Hand* hand,
+                   std::default_random_engine& generator) const;
+
+  /// Finish a Hand with every player using this policy and return a seat's reward.
+
+  //! The same as play_to_end() followed by Hand::reward(), but the tricks are
+  //! played on a TrickPosition and the Hand is left when its picking round
+  //! is over.
+  int play_out(sheepshead::interface::Hand* hand, int seat,
+               std::default_random_engine& generator) const;
+
+protected:
+  //! Choose a picking round play. The first available play by default.
+  virtual sheepshead::interface::Play
+  choose_picking_play(const sheepshead::interface::Hand& hand,
+                      const std::vector<sheepshead::interface::Play>& available_plays,
+                      std::default_random_engine& generator) const;
+
+}; // class Policy
+
+/// Choose uniformly among the available plays.
+class RandomPolicy : public Policy
+{
+public:
+  int choose_card(const TrickPosition& position,
+                  std::default_random_engine& generator) const override;
+
+protected:
+  sheepshead::interface::Play
+  choose_picking_play(const sheepshead::interface::Hand& hand,
+                      const std::vector<sheepshead::interface::Play>& available_plays,
+                      std::default_random_engine& generator) const override;
+
+}; // class RandomPolicy
+
+/// Simple rules of thumb a casual player might follow.
+
+/** Picks with enough strong trump, calls the first permitted partner card,
+ *  discards the most valuable fail cards, and in tricks schmears onto a
+ *  trick a known teammate is winning, takes tricks as cheaply as it can, and
+ *  otherwise throws off its least valuable card. It uses only what the
+ *  player to act can see.
+ */
+class HeuristicPolicy : public Policy
+{
+public:
+  //! pick_threshold is the hand strength needed to pick, where queens count
+  //! 3, jacks 2, other trump 1, and fail aces 1.
+  explicit HeuristicPolicy(int pick_threshold = 8);
+
+  int choose_card(const TrickPosition& position,
+                  std::default_random_engine& generator) const override;
+
+  //! The strength of a player's held cards, as compared to pick_threshold.
+  static int hand_strength(const sheepshead::interface::Hand& hand,
+                           const sheepshead::interface::PlayerId& player);
+
+protected:
+  sheepshead::interface::Play
+  choose_picking_play(const sheepshead::interface::Hand& hand,
+                      const std::vector<sheepshead::interface::Play>& available_plays,
+                      std::default_random_engine& generator) const override;
+
+private:
+  int m_pick_threshold;
+
+}; // class HeuristicPolicy
+
+/// Play trick cards with the double-dummy solver and decide the rest heuristically.
+
+/** The solver sees every hand, so this policy plays as if it could too. It
+ *  is an optimistic stand-in for strong play, useful for comparing decisions
+ *  made before the tricks. Leasters are played heuristically.
+ */
+class SolverPolicy : public HeuristicPolicy
+{
+public:
+  explicit SolverPolicy(int pick_threshold = 8);
+
+  int choose_card(const TrickPosition& position,
+                  std::default_random_engine& generator) const override;
+
+}; // class SolverPolicy
+
+} // namespace learning
+#endif
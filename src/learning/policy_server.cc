@@ -0,0 +1,569 @@
+#include "policy_server.h"
+
+#include "sheepshead/proto/game.pb.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace learning {
+
+namespace {
+
+template<typename T>
+void append(std::string* payload, const T& value)
+{
+  payload->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+T extract(const std::string& payload, size_t* offset)
+{
+  T value;
+  memcpy(&value, payload.data() + *offset, sizeof(T));
+  *offset += sizeof(T);
+  return value;
+}
+
+std::string status_payload(PolicyStatus status)
+{
+  return std::string(1, static_cast<char>(status));
+}
+
+bool same_action(const ActionId& a, const ActionId& b)
+{
+  return a.play_type == b.play_type && a.value == b.value;
+}
+
+bool is_card(int card)
+{
+  return card >= 0 && card < NUMBER_OF_CARDS;
+}
+
+bool is_seat(int seat, int number_of_players)
+{
+  return seat >= 0 && seat < number_of_players;
+}
+
+// Whether an observation sent by a client is one observe() could have made,
+// as far as encoding it depends on.
+bool is_valid_observation(const Observation& observation)
+{
+  int players = observation.number_of_players;
+  if(players < 3 || players > 5 || observation.trump_is_clubs > 1) return false;
+  if(observation.turn > static_cast<uint8_t>(Hand::TurnType::ARBITRABLE)) return false;
+  if(!is_seat(observation.seat, players)) return false;
+  if(observation.picker != -1 && !is_seat(observation.picker, players)) return false;
+  if(observation.partner_card != NO_CARD && !is_card(observation.partner_card)) return false;
+  int laid = 0;
+  for(; laid < 5 && observation.trick_cards[laid] != NO_CARD; laid++) {
+    if(!is_card(observation.trick_cards[laid])) return false;
+  }
+  for(int place = laid; place < 5; place++) {
+    if(observation.trick_cards[place] != NO_CARD) return false;
+  }
+  if(laid >= players) return false;
+  if(laid > 0 ? !is_seat(observation.leader, players) :
+                observation.leader != -1 && !is_seat(observation.leader, players)) {
+    return false;
+  }
+  return true;
+}
+
+// Whether an action sent by a client is one encode_action() could have made
+// for a decision of play_type.
+bool is_valid_action(const ActionId& action, Play::PlayType play_type)
+{
+  if(action.play_type != static_cast<uint8_t>(play_type)) return false;
+  switch(play_type) {
+    case Play::PlayType::PICK:
+    case Play::PlayType::LONER:
+      return action.value <= 1;
+    case Play::PlayType::PARTNER:
+    case Play::PlayType::TRICK_CARD:
+      return action.value < static_cast<uint32_t>(NUMBER_OF_CARDS);
+    case Play::PlayType::UNKNOWN:
+      return action.value < 8u * NUMBER_OF_CARDS;
+    case Play::PlayType::DISCARD:
+      return action.value != 0;
+  }
+  return false;
+}
+
+// Whether a serialized Hand sent by a client parses and, once dealt, holds
+// every card once among the right number of seats, so the Hand interface
+// can walk it.
+bool is_valid_hand(const std::string& serialized)
+{
+  sheepshead::model::Hand message;
+  // Parsing partially keeps protobuf from logging every bad request.
+  if(!message.ParsePartialFromString(serialized) || !message.IsInitialized()) return false;
+  int players = message.rule_variation().num_players();
+  if(players < 3 || players > 5) return false;
+  if(message.seats_size() != players && message.seats_size() != 0) return false;
+
+  CardMask seen = 0;
+  int count = 0;
+  auto add = [&seen, &count](const sheepshead::model::Card& card) {
+    int index = 8 * static_cast<int>(card.suit()) + static_cast<int>(card.rank());
+    if(seen & card_bit(index)) return false;
+    seen |= card_bit(index);
+    count++;
+    return true;
+  };
+  for(auto& seat : message.seats()) {
+    for(auto& card : seat.held_cards()) if(!add(card)) return false;
+  }
+  const auto& picking_round = message.picking_round();
+  if(picking_round.has_leader_position() &&
+     !is_seat(picking_round.leader_position(), players)) {
+    return false;
+  }
+  if(picking_round.picking_decisions_size() > players) return false;
+  for(auto& card : picking_round.blinds()) if(!add(card)) return false;
+  for(auto& card : picking_round.discarded_cards()) if(!add(card)) return false;
+  if(message.tricks_size() > NUMBER_OF_CARDS / players) return false;
+  for(auto& trick : message.tricks()) {
+    if(trick.has_leader_position() && !is_seat(trick.leader_position(), players)) return false;
+    if(trick.laid_cards_size() > players) return false;
+    for(auto& card : trick.laid_cards()) if(!add(card)) return false;
+  }
+  // Hands are dealt by the arbiter, so a new one has no cards yet.
+  return count == NUMBER_OF_CARDS || (count == 0 && message.tricks_size() == 0);
+}
+
+// Fill a decision from a Hand, for its current player. Returns false if
+// nobody is to act.
+bool decision_from_hand(const Hand& hand, PolicyDecision* decision)
+{
+  if(!hand.is_playable()) return false;
+  auto player = hand.current_player();
+  auto available_plays = hand.available_plays(player);
+  if(available_plays.empty()) return false;
+  decision->hand = &hand;
+  decision->observation = observe(hand, player);
+  decision->play_type = available_plays[0].play_type();
+  for(auto& play : available_plays) decision->actions.push_back(encode_action(play));
+  return true;
+}
+
+bool send_all(int socket, const char* data, size_t size)
+{
+  while(size > 0) {
+    ssize_t sent = send(socket, data, size, MSG_NOSIGNAL);
+    if(sent <= 0) return false;
+    data += sent;
+    size -= sent;
+  }
+  return true;
+}
+
+bool receive_all(int socket, char* data, size_t size)
+{
+  while(size > 0) {
+    ssize_t received = recv(socket, data, size, 0);
+    if(received <= 0) return false;
+    data += received;
+    size -= received;
+  }
+  return true;
+}
+
+} // namespace
+
+bool read_frame(int socket, std::string* payload, uint32_t max_bytes)
+{
+  unsigned char header[4];
+  if(!receive_all(socket, reinterpret_cast<char*>(header), sizeof(header))) return false;
+  uint32_t size = header[0] | header[1] << 8 | header[2] << 16 |
+                  static_cast<uint32_t>(header[3]) << 24;
+  if(size > max_bytes) return false;
+  payload->resize(size);
+  return size == 0 || receive_all(socket, &(*payload)[0], size);
+}
+
+bool write_frame(int socket, const std::string& payload)
+{
+  uint32_t size = payload.size();
+  std::string frame(4, '\0');
+  for(int i = 0; i < 4; i++) frame[i] = static_cast<char>(size >> (8 * i));
+  frame += payload;
+  return send_all(socket, frame.data(), frame.size());
+}
+
+PolicyDecision::PolicyDecision()
+  : hand(nullptr), observation(), play_type(Play::PlayType::TRICK_CARD)
+{}
+
+DecisionModel::~DecisionModel()
+{}
+
+InferenceStats DecisionModel::batch_stats() const
+{
+  return InferenceStats();
+}
+
+ValueModel::ValueModel(InferenceQueue::BatchEvaluator evaluator,
+                       const InferenceQueueConfig& config)
+  : m_queue(observation_input_size(), LinearQFunction::ACTION_SLOTS, evaluator, config)
+{}
+
+int ValueModel::choose(const PolicyDecision& decision)
+{
+  std::vector<float> inputs(m_queue.input_size());
+  float slot_values[LinearQFunction::ACTION_SLOTS];
+  encode_observation(decision.observation, decision.play_type, inputs.data());
+  m_queue.evaluate(inputs.data(), slot_values);
+
+  int best_index = 0;
+  float best_value = 0;
+  for(size_t i = 0; i < decision.actions.size(); i++) {
+    int slots[4];
+    int number_of_slots = LinearQFunction::action_slots(decision.actions[i], slots);
+    float value = 0;
+    for(int j = 0; j < number_of_slots; j++) value += slot_values[slots[j]];
+    if(i == 0 || value > best_value) {
+      best_index = i;
+      best_value = value;
+    }
+  }
+  return best_index;
+}
+
+InferenceStats ValueModel::batch_stats() const
+{
+  return m_queue.stats();
+}
+
+HashedModel::HashedModel(const HashedQFunction* q_function)
+  : m_q_function(q_function)
+{}
+
+int HashedModel::choose(const PolicyDecision& decision)
+{
+  // The actions are the available plays, in order.
+  const Hand& hand = *decision.hand;
+  auto available_plays = hand.available_plays(hand.current_player());
+  uint64_t state_key = m_q_function->state_key(hand);
+  int best_index = 0;
+  float best_value = 0;
+  for(size_t i = 0; i < available_plays.size(); i++) {
+    float value = m_q_function->evaluate(m_q_function->key(state_key, available_plays[i]));
+    if(i == 0 || value > best_value) {
+      best_index = i;
+      best_value = value;
+    }
+  }
+  return best_index;
+}
+
+SearchModel::SearchModel(const MctsConfig& config)
+  : m_search(config)
+{}
+
+int SearchModel::choose(const PolicyDecision& decision)
+{
+  static thread_local std::default_random_engine generator(std::random_device{}());
+  const Hand& hand = *decision.hand;
+  Play play = decision.play_type == Play::PlayType::TRICK_CARD ?
+              m_search.choose_play(hand) : m_policy.choose_play(hand, generator);
+  ActionId action = encode_action(play);
+  for(size_t i = 0; i < decision.actions.size(); i++) {
+    if(same_action(decision.actions[i], action)) return i;
+  }
+  return 0;
+}
+
+PolicyServerStats::PolicyServerStats()
+  : requests(0), p50_microseconds(0), p90_microseconds(0), p99_microseconds(0),
+    max_microseconds(0), batches(0), mean_fill(0)
+{}
+
+const int PolicyServer::LATENCY_WINDOW;
+const uint32_t PolicyServer::MAX_REQUEST_BYTES;
+
+PolicyServer::PolicyServer(const std::string& socket_path, DecisionModel* model)
+  : m_socket_path(socket_path), m_model(model), m_listener(-1), m_stopping(false),
+    m_requests(0)
+{
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if(socket_path.size() >= sizeof(address.sun_path)) return;
+  strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+  int listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if(listener < 0) return;
+  unlink(socket_path.c_str());
+  if(bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+     listen(listener, 128) != 0) {
+    close(listener);
+    return;
+  }
+  m_listener = listener;
+}
+
+PolicyServer::~PolicyServer()
+{
+  stop();
+  if(m_listener >= 0) {
+    close(m_listener);
+    unlink(m_socket_path.c_str());
+  }
+}
+
+void PolicyServer::serve()
+{
+  while(!m_stopping.load()) {
+    pollfd listening = {m_listener, POLLIN, 0};
+    // Wake now and then to notice stop().
+    if(poll(&listening, 1, 100) > 0) {
+      int connection = accept4(m_listener, nullptr, nullptr, SOCK_CLOEXEC);
+      if(connection >= 0) {
+        std::lock_guard<std::mutex> lock(m_connections_mutex);
+        m_connections.push_back(connection);
+        m_threads.emplace_back(&PolicyServer::serve_connection, this, connection);
+      }
+    }
+
+    // Join the threads of closed connections.
+    std::vector<std::thread> closed;
+    {
+      std::lock_guard<std::mutex> lock(m_connections_mutex);
+      for(size_t i = 0; i < m_threads.size();) {
+        if(std::find(m_finished.begin(), m_finished.end(), m_threads[i].get_id()) !=
+           m_finished.end()) {
+          closed.push_back(std::move(m_threads[i]));
+          m_threads.erase(m_threads.begin() + i);
+        } else {
+          i++;
+        }
+      }
+      m_finished.clear();
+    }
+    for(auto& thread : closed) thread.join();
+  }
+
+  std::vector<std::thread> threads;
+  {
+    std::lock_guard<std::mutex> lock(m_connections_mutex);
+    for(int connection : m_connections) shutdown(connection, SHUT_RDWR);
+    threads.swap(m_threads);
+  }
+  for(auto& thread : threads) thread.join();
+  m_finished.clear();
+}
+
+void PolicyServer::stop()
+{
+  m_stopping.store(true);
+}
+
+void PolicyServer::serve_connection(int connection)
+{
+  std::string request;
+  while(read_frame(connection, &request, MAX_REQUEST_BYTES)) {
+    auto start = std::chrono::steady_clock::now();
+    std::string response = answer(request);
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    // Count the request before answering it, so stats asked for after the
+    // answer arrives include it.
+    if(request.empty() || request[0] != static_cast<char>(PolicyRequestKind::STATS)) {
+      record_latency(elapsed.count());
+    }
+    if(!write_frame(connection, response)) break;
+  }
+
+  std::lock_guard<std::mutex> lock(m_connections_mutex);
+  m_connections.erase(std::find(m_connections.begin(), m_connections.end(), connection));
+  m_finished.push_back(std::this_thread::get_id());
+  close(connection);
+}
+
+std::string PolicyServer::answer(const std::string& request)
+{
+  if(request.empty()) return status_payload(PolicyStatus::MALFORMED);
+  auto kind = static_cast<PolicyRequestKind>(request[0]);
+
+  if(kind == PolicyRequestKind::STATS) {
+    auto current = stats();
+    std::string response = status_payload(PolicyStatus::OK);
+    append<uint64_t>(&response, current.requests);
+    append<double>(&response, current.p50_microseconds);
+    append<double>(&response, current.p90_microseconds);
+    append<double>(&response, current.p99_microseconds);
+    append<double>(&response, current.max_microseconds);
+    append<uint64_t>(&response, current.batches);
+    append<double>(&response, current.mean_fill);
+    return response;
+  }
+
+  PolicyDecision decision;
+  std::unique_ptr<Hand> hand;
+  if(kind == PolicyRequestKind::HAND) {
+    std::string serialized = request.substr(1);
+    if(!is_valid_hand(serialized)) return status_payload(PolicyStatus::MALFORMED);
+    hand.reset(new Hand(serialized));
+    if(!decision_from_hand(*hand, &decision)) return status_payload(PolicyStatus::NO_DECISION);
+  } else if(kind == PolicyRequestKind::OBSERVATION) {
+    const size_t fixed_size = 1 + sizeof(Observation) + 2;
+    if(request.size() < fixed_size) return status_payload(PolicyStatus::MALFORMED);
+    size_t offset = 1;
+    decision.observation = extract<Observation>(request, &offset);
+    if(!is_valid_observation(decision.observation)) return status_payload(PolicyStatus::MALFORMED);
+    uint8_t play_type = extract<uint8_t>(request, &offset);
+    uint8_t number_of_actions = extract<uint8_t>(request, &offset);
+    if(play_type > static_cast<uint8_t>(Play::PlayType::TRICK_CARD) ||
+       request.size() != fixed_size + number_of_actions * sizeof(ActionId)) {
+      return status_payload(PolicyStatus::MALFORMED);
+    }
+    decision.play_type = static_cast<Play::PlayType>(play_type);
+    for(int i = 0; i < number_of_actions; i++) {
+      decision.actions.push_back(extract<ActionId>(request, &offset));
+      if(!is_valid_action(decision.actions.back(), decision.play_type)) {
+        return status_payload(PolicyStatus::MALFORMED);
+      }
+    }
+    if(decision.actions.empty()) return status_payload(PolicyStatus::NO_DECISION);
+    if(m_model->needs_hand()) return status_payload(PolicyStatus::UNSUPPORTED);
+  } else {
+    return status_payload(PolicyStatus::MALFORMED);
+  }
+
+  int chosen = m_model->choose(decision);
+  std::string response = status_payload(PolicyStatus::OK);
+  append(&response, decision.actions[chosen]);
+  return response;
+}
+
+void PolicyServer::record_latency(double microseconds)
+{
+  std::lock_guard<std::mutex> lock(m_latency_mutex);
+  if(m_latencies.size() < static_cast<size_t>(LATENCY_WINDOW)) {
+    m_latencies.push_back(microseconds);
+  } else {
+    m_latencies[m_requests % LATENCY_WINDOW] = microseconds;
+  }
+  m_requests++;
+}
+
+PolicyServerStats PolicyServer::stats() const
+{
+  PolicyServerStats result;
+  std::vector<float> latencies;
+  {
+    std::lock_guard<std::mutex> lock(m_latency_mutex);
+    result.requests = m_requests;
+    latencies = m_latencies;
+  }
+  if(!latencies.empty()) {
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double fraction) {
+      return latencies[static_cast<size_t>(fraction * (latencies.size() - 1))];
+    };
+    result.p50_microseconds = percentile(0.5);
+    result.p90_microseconds = percentile(0.9);
+    result.p99_microseconds = percentile(0.99);
+    result.max_microseconds = latencies.back();
+  }
+  auto batching = m_model->batch_stats();
+  result.batches = batching.batches;
+  result.mean_fill = batching.mean_fill;
+  return result;
+}
+
+PolicyClient::PolicyClient(const std::string& socket_path)
+  : m_socket(-1)
+{
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if(socket_path.size() >= sizeof(address.sun_path)) return;
+  strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+  int client = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if(client < 0) return;
+  if(connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+    close(client);
+    return;
+  }
+  m_socket = client;
+}
+
+PolicyClient::~PolicyClient()
+{
+  if(m_socket >= 0) close(m_socket);
+}
+
+PolicyStatus PolicyClient::exchange(const std::string& request, std::string* response)
+{
+  if(m_socket < 0 || !write_frame(m_socket, request) ||
+     !read_frame(m_socket, response, PolicyServer::MAX_REQUEST_BYTES) || response->empty()) {
+    return PolicyStatus::DISCONNECTED;
+  }
+  return static_cast<PolicyStatus>((*response)[0]);
+}
+
+PolicyStatus PolicyClient::decide(const Hand& hand, ActionId* action)
+{
+  std::string request(1, static_cast<char>(PolicyRequestKind::HAND));
+  std::string serialized;
+  hand.serialize(&serialized);
+  request += serialized;
+
+  std::string response;
+  PolicyStatus status = exchange(request, &response);
+  if(status != PolicyStatus::OK) return status;
+  if(response.size() != 1 + sizeof(ActionId)) return PolicyStatus::MALFORMED;
+  size_t offset = 1;
+  *action = extract<ActionId>(response, &offset);
+  return status;
+}
+
+PolicyStatus PolicyClient::decide(const Observation& observation, Play::PlayType play_type,
+                                  const std::vector<ActionId>& actions, ActionId* action)
+{
+  assert(actions.size() < 256);
+  std::string request(1, static_cast<char>(PolicyRequestKind::OBSERVATION));
+  append(&request, observation);
+  append<uint8_t>(&request, static_cast<uint8_t>(play_type));
+  append<uint8_t>(&request, actions.size());
+  for(auto& option : actions) append(&request, option);
+
+  std::string response;
+  PolicyStatus status = exchange(request, &response);
+  if(status != PolicyStatus::OK) return status;
+  if(response.size() != 1 + sizeof(ActionId)) return PolicyStatus::MALFORMED;
+  size_t offset = 1;
+  *action = extract<ActionId>(response, &offset);
+  return status;
+}
+
+PolicyStatus PolicyClient::stats(PolicyServerStats* stats)
+{
+  std::string request(1, static_cast<char>(PolicyRequestKind::STATS));
+  std::string response;
+  PolicyStatus status = exchange(request, &response);
+  if(status != PolicyStatus::OK) return status;
+  if(response.size() != 1 + 7 * 8) return PolicyStatus::MALFORMED;
+  size_t offset = 1;
+  stats->requests = extract<uint64_t>(response, &offset);
+  stats->p50_microseconds = extract<double>(response, &offset);
+  stats->p90_microseconds = extract<double>(response, &offset);
+  stats->p99_microseconds = extract<double>(response, &offset);
+  stats->max_microseconds = extract<double>(response, &offset);
+  stats->batches = extract<uint64_t>(response, &offset);
+  stats->mean_fill = extract<double>(response, &offset);
+  return status;
+}
+
+} // namespace learning
@@ -0,0 +1,254 @@
+#ifndef DEEPSHEEP_LEARNING_POLICYSERVER_H_
+#define DEEPSHEEP_LEARNING_POLICYSERVER_H_
+
+#include "learning/experience_record.h"
+#include "learning/hashed_q_function.h"
+#include "learning/inference_queue.h"
+#include "learning/mcts.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/playmaker.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace learning {
+
+/// What a request to a PolicyServer asks for.
+enum class PolicyRequestKind : uint8_t
+{
+  HAND = 1,
+  OBSERVATION = 2,
+  STATS = 3
+};
+
+/// How a PolicyServer answered a request.
+enum class PolicyStatus : uint8_t
+{
+  OK = 0,
+  //! The request couldn't be read, or holds a field no hand could give.
+  MALFORMED = 1,
+  //! The Hand isn't waiting on a player's decision, or there are no actions.
+  NO_DECISION = 2,
+  //! The model needs the whole Hand, and was sent an observation.
+  UNSUPPORTED = 3,
+  //! The connection failed. Only returned by PolicyClient.
+  DISCONNECTED = 4
+};
+
+/// A decision to be made: what the player can see and the actions open to them.
+struct PolicyDecision
+{
+  PolicyDecision();
+
+  //! The Hand the decision is in, or null when only the observation was sent.
+  const sheepshead::interface::Hand* hand;
+  Observation observation;
+  sheepshead::interface::Play::PlayType play_type;
+  //! For a Hand, its available plays in order.
+  std::vector<ActionId> actions;
+};
+
+/// A way of choosing among the actions of a PolicyDecision.
+
+/** choose() is called from every connection at once, so models must be
+ *  safe on any number of threads.
+ */
+class DecisionModel
+{
+public:
+  virtual ~DecisionModel();
+
+  //! Whether decisions must come with their Hand.
+  virtual bool needs_hand() const = 0;
+
+  //! Return the index of the chosen action.
+  virtual int choose(const PolicyDecision& decision) = 0;
+
+  //! What the model has batched, if it batches.
+  virtual InferenceStats batch_stats() const;
+
+}; // class DecisionModel
+
+/// Choose the action with the most value from action slot values, batched.
+
+/** The observation is encoded with encode_observation() and evaluated,
+ *  together with other connections' requests, through an InferenceQueue
+ *  into LinearQFunction::ACTION_SLOTS values. An action's value is the sum
+ *  of its slots, as for LinearQFunction. Use linear_evaluator() without a
+ *  play type, or mlp_evaluator() with a network of observation_input_size()
+ *  inputs and ACTION_SLOTS outputs.
+ */
+class ValueModel : public DecisionModel
+{
+public:
+  ValueModel(InferenceQueue::BatchEvaluator evaluator,
+             const InferenceQueueConfig& config = InferenceQueueConfig());
+
+  bool needs_hand() const override { return false; }
+  int choose(const PolicyDecision& decision) override;
+  InferenceStats batch_stats() const override;
+
+private:
+  InferenceQueue m_queue;
+
+}; // class ValueModel
+
+/// Choose the play a HashedQFunction values most. Needs the Hand.
+class HashedModel : public DecisionModel
+{
+public:
+  //! The function is not owned.
+  explicit HashedModel(const HashedQFunction* q_function);
+
+  bool needs_hand() const override { return true; }
+  int choose(const PolicyDecision& decision) override;
+
+private:
+  const HashedQFunction* m_q_function;
+
+}; // class HashedModel
+
+/// Choose trick cards by Mcts and the rest heuristically. Needs the Hand.
+class SearchModel : public DecisionModel
+{
+public:
+  explicit SearchModel(const MctsConfig& config);
+
+  bool needs_hand() const override { return true; }
+  int choose(const PolicyDecision& decision) override;
+
+private:
+  Mcts m_search;
+  HeuristicPolicy m_policy;
+
+}; // class SearchModel
+
+/// Request latencies and batching, as a PolicyServer reports them.
+struct PolicyServerStats
+{
+  PolicyServerStats();
+
+  long long requests;
+  //! From a request being read to its answer being written, over recent requests.
+  double p50_microseconds;
+  double p90_microseconds;
+  double p99_microseconds;
+  double max_microseconds;
+  long long batches;
+  //! The mean batch size as a fraction of the model's max_batch_size.
+  double mean_fill;
+};
+
+/// Answer decision requests from processes on the same host over a Unix socket.
+
+/** Each connection is served by its own thread, one request at a time,
+ *  and answers come back in the order asked. Every message either way is
+ *  a frame, a little-endian uint32 length followed by that many bytes of
+ *  payload. A request payload starts with a PolicyRequestKind byte:
+ *
+ *    HAND         the Hand, serialized by Hand::serialize(), for its
+ *                 current player to act in
+ *    OBSERVATION  Observation (24 bytes, as the struct), uint8 play type,
+ *                 uint8 number of actions, ActionId[number of actions]
+ *    STATS        nothing more
+ *
+ *  and a response payload with a PolicyStatus byte, followed when OK by
+ *  the chosen ActionId (8 bytes), or for STATS by uint64 requests, float64
+ *  p50, p90, p99 and max microseconds, uint64 batches and float64 mean fill.
+ *
+ *  Concurrent requests are batched by the model, so a model over an
+ *  InferenceQueue answers many connections with one evaluation.
+ */
+class PolicyServer
+{
+public:
+  //! The most latencies kept for percentiles.
+  static const int LATENCY_WINDOW = 1 << 16;
+  //! The largest request payload accepted.
+  static const uint32_t MAX_REQUEST_BYTES = 1 << 20;
+
+  //! Listen on socket_path, replacing any socket there. The model is not
+  //! owned. Check is_open() for success.
+  PolicyServer(const std::string& socket_path, DecisionModel* model);
+  ~PolicyServer();
+
+  PolicyServer(const PolicyServer&) = delete;
+  PolicyServer& operator=(const PolicyServer&) = delete;
+
+  bool is_open() const { return m_listener >= 0; }
+
+  //! Accept and serve connections until stop().
+  void serve();
+  //! Make serve() return, closing every connection. Safe from any thread.
+  void stop();
+
+  PolicyServerStats stats() const;
+
+  //! Answer one request payload. Exposed for testing without sockets.
+  std::string answer(const std::string& request);
+
+private:
+  void serve_connection(int connection);
+  void record_latency(double microseconds);
+
+  std::string m_socket_path;
+  DecisionModel* m_model;
+  int m_listener;
+  std::atomic<bool> m_stopping;
+
+  std::mutex m_connections_mutex;
+  std::vector<int> m_connections;
+  std::vector<std::thread> m_threads;
+  //! Connection threads that are done, to be joined.
+  std::vector<std::thread::id> m_finished;
+
+  mutable std::mutex m_latency_mutex;
+  std::vector<float> m_latencies;
+  long long m_requests;
+
+}; // class PolicyServer
+
+/// A connection to a PolicyServer, for one thread at a time.
+class PolicyClient
+{
+public:
+  //! Connect to the server's socket. Check is_open() for success.
+  explicit PolicyClient(const std::string& socket_path);
+  ~PolicyClient();
+
+  PolicyClient(const PolicyClient&) = delete;
+  PolicyClient& operator=(const PolicyClient&) = delete;
+
+  bool is_open() const { return m_socket >= 0; }
+
+  //! Ask for the current player's action in a Hand.
+  PolicyStatus decide(const sheepshead::interface::Hand& hand, ActionId* action);
+
+  //! Ask for one of actions, for a player who sees observation.
+  PolicyStatus decide(const Observation& observation,
+                      sheepshead::interface::Play::PlayType play_type,
+                      const std::vector<ActionId>& actions, ActionId* action);
+
+  PolicyStatus stats(PolicyServerStats* stats);
+
+private:
+  PolicyStatus exchange(const std::string& request, std::string* response);
+
+  int m_socket;
+
+}; // class PolicyClient
+
+/// Read a frame's payload from a socket. Returns false on EOF, error, or a
+/// payload over max_bytes.
+bool read_frame(int socket, std::string* payload, uint32_t max_bytes);
+
+/// Write a payload to a socket as a frame.
+bool write_frame(int socket, const std::string& payload);
+
+} // namespace learning
+#endif
@@ -0,0 +1,70 @@
+#include "prioritized_replay.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace learning {
+
+PrioritizedReplayConfig::PrioritizedReplayConfig()
+  : capacity(1 << 20), alpha(0.6), beta(0.4), epsilon(0.01)
+{}
+
+PrioritizedReplay::PrioritizedReplay(const PrioritizedReplayConfig& config)
+  : m_config(config), m_records(config.capacity), m_priorities(config.capacity),
+    m_size(0), m_next(0), m_max_priority(1)
+{
+  assert(config.capacity > 0);
+}
+
+size_t PrioritizedReplay::add(const ExperienceRecord& record)
+{
+  size_t index = m_next;
+  m_records[index] = record;
+  m_priorities.set(index, m_max_priority);
+  m_next = (m_next + 1) % m_config.capacity;
+  m_size = std::min(m_size + 1, m_config.capacity);
+  return index;
+}
+
+int PrioritizedReplay::sample(int batch_size, std::default_random_engine& generator,
+                              size_t* indices, ExperienceRecord* records, float* weights) const
+{
+  double total = m_priorities.total();
+  if(m_size == 0 || total <= 0 || batch_size <= 0) return 0;
+
+  // One target in each stratum, so the targets come out in increasing order.
+  std::vector<double> targets(batch_size);
+  std::uniform_real_distribution<double> distribution(0, 1);
+  double stratum = total / batch_size;
+  for(int j = 0; j < batch_size; j++) {
+    targets[j] = std::min((j + distribution(generator)) * stratum, std::nextafter(total, 0.0));
+  }
+  m_priorities.find_sorted(targets.data(), batch_size, indices);
+
+  double max_weight = 0;
+  for(int j = 0; j < batch_size; j++) {
+    records[j] = m_records[indices[j]];
+    double weight = std::pow(m_size * probability(indices[j]), -m_config.beta);
+    weights[j] = weight;
+    max_weight = std::max(max_weight, weight);
+  }
+  for(int j = 0; j < batch_size; j++) weights[j] /= max_weight;
+  return batch_size;
+}
+
+void PrioritizedReplay::update_error(size_t index, double error)
+{
+  assert(index < m_size);
+  double priority = std::pow(std::fabs(error) + m_config.epsilon, m_config.alpha);
+  m_priorities.set(index, priority);
+  m_max_priority = std::max(m_max_priority, priority);
+}
+
+double PrioritizedReplay::probability(size_t index) const
+{
+  double total = m_priorities.total();
+  return total > 0 ? m_priorities.get(index) / total : 0;
+}
+
+} // namespace learning
@@ -0,0 +1,83 @@
+#ifndef DEEPSHEEP_LEARNING_PRIORITIZEDREPLAY_H_
+#define DEEPSHEEP_LEARNING_PRIORITIZEDREPLAY_H_
+
+#include "learning/experience_record.h"
+#include "learning/sum_tree.h"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace learning {
+
+/// Options for a PrioritizedReplay.
+struct PrioritizedReplayConfig
+{
+  PrioritizedReplayConfig();
+
+  //! The most records kept. The oldest is replaced when full.
+  size_t capacity;
+  //! How strongly priorities skew sampling: 0 is uniform, 1 fully proportional.
+  double alpha;
+  //! How much importance weights correct for the skew: 0 not at all, 1 fully.
+  double beta;
+  //! Added to every error, so no record's priority is zero.
+  double epsilon;
+};
+
+/// A replay memory sampling records in proportion to their learning error.
+
+/** A record's priority is (|error| + epsilon)^alpha and it is sampled with
+ *  probability in proportion to it. New records get the highest priority
+ *  seen so far, so each is likely to be learned from soon after it is
+ *  added. Rare, informative plays such as picking and calling a partner
+ *  keep getting sampled while their errors stay large, rather than being
+ *  drowned out by the many trick plays.
+ *
+ *  Sampling this way is biased, and each sample comes with an importance
+ *  weight (N * P(i))^-beta scaled so the largest in the batch is 1, to
+ *  multiply its update by.
+ *
+ *  The memory is meant for one thread at a time, the learner's.
+ */
+class PrioritizedReplay
+{
+public:
+  explicit PrioritizedReplay(const PrioritizedReplayConfig& config);
+
+  //! Add a record with the highest priority so far. Returns its index.
+  size_t add(const ExperienceRecord& record);
+
+  //! Sample batch_size records, writing their indices, records and importance weights.
+
+  //! The total priority is split into batch_size equal strata and one
+  //! record is drawn from each, so a batch covers the distribution evenly.
+  //! Returns the number sampled, 0 if the memory is empty.
+  int sample(int batch_size, std::default_random_engine& generator, size_t* indices,
+             ExperienceRecord* records, float* weights) const;
+
+  //! Set a record's priority from its latest learning error.
+  void update_error(size_t index, double error);
+
+  const ExperienceRecord& record(size_t index) const { return m_records[index]; }
+  //! The probability that one draw picks a record.
+  double probability(size_t index) const;
+
+  size_t size() const { return m_size; }
+  size_t capacity() const { return m_config.capacity; }
+
+  //! Change beta, typically annealing it towards 1 over training.
+  void set_beta(double beta) { m_config.beta = beta; }
+
+private:
+  PrioritizedReplayConfig m_config;
+  std::vector<ExperienceRecord> m_records;
+  SumTree m_priorities;
+  size_t m_size;
+  size_t m_next;
+  double m_max_priority;
+
+}; // class PrioritizedReplay
+
+} // namespace learning
+#endif
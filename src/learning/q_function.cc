@@ -5,12 +5,31 @@
 namespace learning {
 
 QFunction::QFunction()
-  : m_q_values(14, 0)
-{}
+  : m_q_values(14)
+{
+  for(auto& value : m_q_values) value.store(0, std::memory_order_relaxed);
+}
+
+QFunction::QFunction(const QFunction& other)
+  : m_q_values(other.m_q_values.size())
+{
+  *this = other;
+}
+
+QFunction& QFunction::operator=(const QFunction& other)
+{
+  for(size_t i = 0; i < m_q_values.size(); i++) {
+    m_q_values[i].store(other.m_q_values[i].load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+  }
+  return *this;
+}
 
 int QFunction::project(const sheepshead::interface::Hand& state,
                        const sheepshead::interface::Play& play) const
 {
+  if(play.play_type() != sheepshead::interface::Play::PlayType::PICK) return -1;
+
   auto current_player = state.current_player();
   auto seat = state.seat(current_player);
   int trump_count = std::count_if(seat.held_cards_begin(), seat.held_cards_end(),
@@ -28,7 +47,8 @@ float QFunction::evaluate(const sheepshead::interface::Hand& state,
                           const sheepshead::interface::Play& play) const
 {
   int state_action_id = project(state, play);
-  return m_q_values[state_action_id];
+  if(state_action_id < 0) return 0;
+  return m_q_values[state_action_id].load(std::memory_order_relaxed);
 }
 
 std::string QFunction::debug_string() const
@@ -36,12 +56,12 @@ std::string QFunction::debug_string() const
   std::string out_string = "QFunction internal values:\n";
   out_string += "PASS values:\n";
   for(int i=0; i<7;  i++) {
-    out_string += std::to_string(m_q_values[i]);
+    out_string += std::to_string(m_q_values[i].load(std::memory_order_relaxed));
     out_string += " ";
   }
   out_string += "\nPICK values:\n";
   for(int i=0; i<7;  i++) {
-    out_string += std::to_string(m_q_values[i+7]);
+    out_string += std::to_string(m_q_values[i+7].load(std::memory_order_relaxed));
     out_string += " ";
   }
 
@@ -51,9 +71,19 @@ std::string QFunction::debug_string() const
 void QFunction::learn(const Experience& experience)
 {
   int state_action_id = project(experience.start_state(), experience.action());
+  if(state_action_id < 0) return;
   auto current_player = experience.start_state().current_player();
   int reward = experience.end_state().reward(current_player);
-  m_q_values[state_action_id] += .05*(reward - m_q_values[state_action_id]);
+  update(state_action_id, reward);
+}
+
+void QFunction::update(int state_action_id, float reward)
+{
+  // A plain load and store rather than a compare-exchange loop: an update
+  // lost to another thread's costs less than contending for the line.
+  auto& value = m_q_values[state_action_id];
+  float old_value = value.load(std::memory_order_relaxed);
+  value.store(old_value + .05f*(reward - old_value), std::memory_order_relaxed);
 }
 
 Experience::Experience(const sheepshead::interface::Hand& start_state,
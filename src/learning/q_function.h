@@ -4,10 +4,15 @@
 #include "sheepshead/interface/hand.h"
 #include "sheepshead/interface/playmaker.h"
 
+#include <atomic>
 #include <vector>
 
 namespace learning {
 
+/// A pick decision and the Hand it led to, by reference.
+
+//! The Hands aren't owned and must outlive the Experience. ExperienceRecord
+//! holds a transition by value, for keeping.
 class Experience
 {
 public:
@@ -23,20 +28,34 @@ private:
   const sheepshead::interface::Hand& m_end_state;
 };
 
+/// A table of action values, indexed by project().
+
+/** Values are relaxed atomics, so any number of threads may evaluate and
+ *  learn at once without locks, Hogwild style: concurrent updates to one
+ *  value can overwrite each other, but no read ever sees a torn value. A
+ *  copy is a snapshot of every value at about the moment it was taken.
+ */
 class QFunction
 {
 public:
   QFunction();
+  QFunction(const QFunction& other);
+  QFunction& operator=(const QFunction& other);
 
+  //! The value of a pick decision. Other plays aren't tabulated and are
+  //! worth 0; HashedQFunction covers every kind of play.
   float evaluate(const sheepshead::interface::Hand& state,
                  const sheepshead::interface::Play& action) const;
   
   void learn(const Experience& experience);
+  //! Move the value of a projected state and action towards a reward.
+  void update(int state_action_id, float reward);
   std::string debug_string() const;
+  //! The index of a pick decision in the table, or -1 for any other play.
   int project(const sheepshead::interface::Hand& state, const sheepshead::interface::Play& play) const;
 
 private:
-  std::vector<float> m_q_values;
+  std::vector<std::atomic<float>> m_q_values;
 };
 
 } // namespace learning
@@ -0,0 +1,129 @@
+#include "q_table.h"
+
+#include "learning/quantization.h"
+
+#include <cassert>
+
+namespace learning {
+
+QTable::QTable(size_t megabytes)
+  : m_mask(0), m_size(0), m_evictions(0)
+{
+  size_t number_of_entries = PROBE_LIMIT;
+  while(2 * number_of_entries * sizeof(Entry) <= megabytes << 20) {
+    number_of_entries *= 2;
+  }
+  m_entries.resize(number_of_entries);
+  m_mask = number_of_entries - 1;
+  clear();
+}
+
+const QTable::Entry* QTable::locate(uint64_t key) const
+{
+  key = stored_key(key);
+  // Keys are hashes, so their low bits pick the home slot directly. Slots
+  // are only ever filled in probe order and never emptied, so an empty slot
+  // ends the search.
+  for(int i = 0; i < PROBE_LIMIT; i++) {
+    const Entry& entry = m_entries[(key + i) & m_mask];
+    if(entry.key == key) return &entry;
+    if(entry.key == 0) return nullptr;
+  }
+  return nullptr;
+}
+
+bool QTable::find(uint64_t key, float* value) const
+{
+  const Entry* entry = locate(key);
+  if(!entry) return false;
+  *value = entry->value;
+  return true;
+}
+
+uint32_t QTable::updates(uint64_t key) const
+{
+  const Entry* entry = locate(key);
+  return entry ? entry->updates : 0;
+}
+
+bool QTable::slot(size_t index, uint64_t* key, float* value) const
+{
+  const Entry& entry = m_entries[index];
+  if(entry.key == 0) return false;
+  *key = entry.key;
+  *value = entry.value;
+  return true;
+}
+
+void QTable::update(uint64_t key, float target, float learning_rate)
+{
+  key = stored_key(key);
+  Entry* replace = nullptr;
+  for(int i = 0; i < PROBE_LIMIT; i++) {
+    Entry* entry = &m_entries[(key + i) & m_mask];
+    if(entry->key == key) {
+      replace = entry;
+      break;
+    }
+    if(entry->key == 0) {
+      m_size++;
+      replace = entry;
+      break;
+    }
+    if(!replace || entry->updates < replace->updates) replace = entry;
+  }
+
+  if(replace->key != key) {
+    if(replace->key != 0) m_evictions++;
+    replace->key = key;
+    replace->value = 0;
+    replace->updates = 0;
+  }
+  replace->value += learning_rate * (target - replace->value);
+  if(replace->updates < UINT32_MAX) replace->updates++;
+}
+
+void QTable::clear()
+{
+  for(auto& entry : m_entries) {
+    entry.key = 0;
+    entry.value = 0;
+    entry.updates = 0;
+  }
+  m_size = 0;
+  m_evictions = 0;
+}
+
+CompactQTable::CompactQTable(const QTable& table)
+  : m_entries(table.capacity(), 0), m_mask(table.capacity() - 1)
+{
+  for(size_t i = 0; i < table.capacity(); i++) {
+    uint64_t key = 0;
+    float value = 0;
+    if(table.slot(i, &key, &value)) m_entries[i] = tag(key) | float_to_half(value);
+  }
+}
+
+uint64_t CompactQTable::tag(uint64_t key)
+{
+  // Never zero, which marks an empty slot.
+  uint64_t top = (key ? key : 1) & ~static_cast<uint64_t>(0xffff);
+  return top ? top : 0x10000;
+}
+
+bool CompactQTable::find(uint64_t key, float* value) const
+{
+  uint64_t key_tag = tag(key);
+  key = key ? key : 1;
+  for(int i = 0; i < QTable::PROBE_LIMIT; i++) {
+    uint64_t entry = m_entries[(key + i) & m_mask];
+    if((entry & ~static_cast<uint64_t>(0xffff)) == key_tag) {
+      *value = half_to_float(entry & 0xffff);
+      return true;
+    }
+    if(entry == 0) return false;
+  }
+  return false;
+}
+
+} // namespace learning
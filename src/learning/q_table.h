@@ -0,0 +1,99 @@
+#ifndef DEEPSHEEP_LEARNING_QTABLE_H_
+#define DEEPSHEEP_LEARNING_QTABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace learning {
+
+/// A fixed-size open-addressing map from 64-bit keys to learned values.
+
+/** Entries live in one flat array, and a key may sit in any of the
+ *  PROBE_LIMIT slots from its home slot on, so a lookup touches one or two
+ *  cache lines and nothing is allocated once the table is built. When every
+ *  slot in reach of a new key is taken, the entry there that has been
+ *  updated least is evicted, so well-learned values survive longest.
+ *
+ *  Key 0 marks an empty slot; a zero key is stored as another key.
+ *  The table is meant for one thread at a time.
+ */
+class QTable
+{
+public:
+  static const int PROBE_LIMIT = 8;
+
+  //! Construct a table using about megabytes of memory, rounded down to a
+  //! power of two number of entries.
+  explicit QTable(size_t megabytes);
+
+  //! Find the value stored for a key. Returns false if there is none.
+  bool find(uint64_t key, float* value) const;
+
+  //! Move the value for a key a step of learning_rate towards target,
+  //! inserting it with value 0 first if it is missing.
+  void update(uint64_t key, float target, float learning_rate);
+
+  //! How many times a key's value has been updated, or 0 if it is missing.
+  uint32_t updates(uint64_t key) const;
+
+  //! Read the entry in a slot, below capacity(). Returns false if it is empty.
+  bool slot(size_t index, uint64_t* key, float* value) const;
+
+  //! Remove every entry.
+  void clear();
+
+  size_t size() const { return m_size; }
+  size_t capacity() const { return m_entries.size(); }
+  size_t bytes() const { return m_entries.size() * sizeof(Entry); }
+  //! The number of entries evicted to make room since the last clear().
+  unsigned long long evictions() const { return m_evictions; }
+
+private:
+  struct Entry
+  {
+    uint64_t key;
+    float value;
+    uint32_t updates;
+  };
+
+  static uint64_t stored_key(uint64_t key) { return key ? key : 1; }
+  const Entry* locate(uint64_t key) const;
+
+  std::vector<Entry> m_entries;
+  size_t m_mask;
+  size_t m_size;
+  unsigned long long m_evictions;
+
+}; // class QTable
+
+/// A read-only copy of a QTable in half the memory, for evaluation.
+
+/** Each entry is packed into eight bytes, the top 48 bits of its key and
+ *  its value as FP16, and keeps the slot it had in the QTable, so probing
+ *  works the same way with twice the entries to a cache line. Keys are
+ *  only told apart by their top bits, so two keys that share them and land
+ *  within PROBE_LIMIT slots of each other are confused, about once in 2^48
+ *  such pairs.
+ */
+class CompactQTable
+{
+public:
+  explicit CompactQTable(const QTable& table);
+
+  //! Find the value stored for a key. Returns false if there is none.
+  bool find(uint64_t key, float* value) const;
+
+  size_t capacity() const { return m_entries.size(); }
+  size_t bytes() const { return m_entries.size() * sizeof(uint64_t); }
+
+private:
+  static uint64_t tag(uint64_t key);
+
+  std::vector<uint64_t> m_entries;
+  size_t m_mask;
+
+}; // class CompactQTable
+
+} // namespace learning
+#endif
@@ -0,0 +1,129 @@
+#include "q_trainer.h"
+
+#include "learning/policy.h"
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+using sheepshead::interface::Hand;
+
+namespace learning {
+
+namespace {
+
+// The first player's pick decision, and the seat that made it.
+struct FirstDecision
+{
+  int state_action_id;
+  int seat;
+};
+
+// Deal a hand and have its first player pick or pass, greedily unless exploring.
+FirstDecision decide_first(const QFunction& q_function, Hand* hand, float exploration,
+                           std::default_random_engine& generator)
+{
+  hand->arbiter().arbitrate();
+  auto player = hand->current_player();
+  auto available_plays = hand->available_plays(player);
+
+  int best = q_function.evaluate(*hand, available_plays[0]) <
+             q_function.evaluate(*hand, available_plays[1]) ? 1 : 0;
+  int chosen = best;
+  if(exploration > 0) {
+    std::uniform_real_distribution<float> distribution(0, 1);
+    if(distribution(generator) < exploration) chosen = 1 - best;
+  }
+
+  FirstDecision decision;
+  decision.state_action_id = q_function.project(*hand, available_plays[chosen]);
+  decision.seat = seat_index(*hand, player);
+  hand->playmaker(player).make_play(available_plays[chosen]);
+  return decision;
+}
+
+} // namespace
+
+QTrainerConfig::QTrainerConfig()
+  : number_of_hands(500000), number_of_threads(std::thread::hardware_concurrency()),
+    snapshot_interval(100000), exploration(0.1), seed(0),
+    deal_scheme(DealScheme::INDEPENDENT)
+{
+  if(number_of_threads < 1) number_of_threads = 1;
+}
+
+QTrainerProgress::QTrainerProgress()
+  : hands(0), seconds(0), hands_per_second(0)
+{}
+
+QTrainerProgress train_q_function(QFunction* q_function, const QTrainerConfig& config,
+                                  const QSnapshotCallback& on_snapshot)
+{
+  unsigned long seed = config.seed;
+  if(seed == 0) {
+    seed = std::chrono::system_clock::now().time_since_epoch().count();
+  }
+
+  DealStream deals(sheepshead::interface::MutableRules().get_rules(), seed, config.deal_scheme);
+
+  auto start = std::chrono::steady_clock::now();
+  auto progress_at = [&](long long hands) {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    QTrainerProgress progress;
+    progress.hands = hands;
+    progress.seconds = elapsed.count();
+    if(progress.seconds > 0) progress.hands_per_second = hands / progress.seconds;
+    return progress;
+  };
+
+  std::atomic<long long> next_hand(0);
+  std::atomic<long long> finished_hands(0);
+  std::mutex snapshot_mutex;
+
+  auto worker = [&]() {
+    RandomPolicy policy;
+    for(long long n = next_hand++; n < config.number_of_hands; n = next_hand++) {
+      std::default_random_engine generator(deals.play_seed(n));
+      auto hand = deals.hand(n);
+      auto decision = decide_first(*q_function, &hand, config.exploration, generator);
+      int reward = policy.play_out(&hand, decision.seat, generator);
+      q_function->update(decision.state_action_id, reward);
+
+      long long finished = ++finished_hands;
+      if(on_snapshot && config.snapshot_interval > 0 &&
+         finished % config.snapshot_interval == 0) {
+        std::lock_guard<std::mutex> lock(snapshot_mutex);
+        QFunction snapshot(*q_function);
+        on_snapshot(snapshot, progress_at(finished));
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int i = 0; i < config.number_of_threads; i++) threads.emplace_back(worker);
+  for(auto& thread : threads) thread.join();
+
+  return progress_at(finished_hands);
+}
+
+double greedy_pick_reward(const QFunction& q_function, int number_of_hands, unsigned long seed,
+                          DealScheme deal_scheme)
+{
+  DealStream deals(sheepshead::interface::MutableRules().get_rules(), seed, deal_scheme);
+  RandomPolicy policy;
+  long long total_reward = 0;
+  for(int n = 0; n < number_of_hands; n++) {
+    std::default_random_engine generator(deals.play_seed(n));
+    auto hand = deals.hand(n);
+    auto decision = decide_first(q_function, &hand, 0, generator);
+    total_reward += policy.play_out(&hand, decision.seat, generator);
+  }
+  return number_of_hands > 0 ? static_cast<double>(total_reward) / number_of_hands : 0;
+}
+
+} // namespace learning
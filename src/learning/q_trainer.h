@@ -0,0 +1,69 @@
+#ifndef DEEPSHEEP_LEARNING_QTRAINER_H_
+#define DEEPSHEEP_LEARNING_QTRAINER_H_
+
+#include "learning/deal_stream.h"
+#include "learning/q_function.h"
+
+#include <functional>
+
+namespace learning {
+
+/// Options for training a QFunction on many threads.
+struct QTrainerConfig
+{
+  QTrainerConfig();
+
+  //! The number of hands to learn from, over all threads.
+  long long number_of_hands;
+  int number_of_threads;
+  //! Report a snapshot after every this many hands. Zero for none.
+  long long snapshot_interval;
+  //! The probability of trying the action that looks worse.
+  float exploration;
+  //! Seed for dealing and for play. Zero means seed from the clock.
+  unsigned long seed;
+  //! How the hands are dealt.
+  DealScheme deal_scheme;
+};
+
+/// How far training has got.
+struct QTrainerProgress
+{
+  QTrainerProgress();
+
+  long long hands;
+  double seconds;
+  double hands_per_second;
+};
+
+typedef std::function<void(const QFunction& snapshot, const QTrainerProgress& progress)>
+    QSnapshotCallback;
+
+/// Train a QFunction's pick decisions with every thread updating it at once.
+
+/** Each hand is dealt from a DealStream with config.deal_scheme, the first
+ *  player picks or passes epsilon-greedily by the current values, the rest
+ *  of the hand is played out at random on a TrickPosition, and the first
+ *  player's reward is learned. Threads take hands from a shared counter
+ *  and update q_function without locks, as QFunction allows, so
+ *  throughput grows with the threads.
+ *
+ *  Hand n is dealt and played from seeds derived from config.seed and n
+ *  alone, so every thread count sees the same hands; only the order the
+ *  updates land in differs. After each snapshot_interval hands the thread
+ *  finishing it copies q_function and passes the copy to on_snapshot, one
+ *  call at a time. Returns the progress at the end.
+ */
+QTrainerProgress train_q_function(QFunction* q_function, const QTrainerConfig& config,
+                                  const QSnapshotCallback& on_snapshot = QSnapshotCallback());
+
+/// The first player's mean reward picking greedily by q_function, with the rest played at random.
+
+//! For comparing snapshots: the same seed and scheme play the same hands with
+//! the same random numbers. With ANTITHETIC or ROTATED deals, number_of_hands
+//! should be a whole number of groups.
+double greedy_pick_reward(const QFunction& q_function, int number_of_hands, unsigned long seed,
+                          DealScheme deal_scheme = DealScheme::INDEPENDENT);
+
+} // namespace learning
+#endif
@@ -0,0 +1,122 @@
+#include "quantization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace learning {
+
+const char* precision_name(Precision precision)
+{
+  switch(precision) {
+    case Precision::FLOAT32: return "float32";
+    case Precision::FP16: return "fp16";
+    case Precision::INT8: return "int8";
+  }
+  return "unknown";
+}
+
+int precision_bytes(Precision precision)
+{
+  switch(precision) {
+    case Precision::FLOAT32: return 4;
+    case Precision::FP16: return 2;
+    case Precision::INT8: return 1;
+  }
+  return 0;
+}
+
+uint16_t float_to_half(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  uint32_t sign = (bits >> 16) & 0x8000;
+  int float_exponent = (bits >> 23) & 0xff;
+  int exponent = float_exponent - 127 + 15;
+  uint32_t mantissa = bits & 0x7fffff;
+
+  if(float_exponent == 0xff) return sign | 0x7c00 | (mantissa ? 0x200 : 0);
+  if(exponent >= 31) return sign | 0x7c00;
+  if(exponent <= 0) {
+    // Subnormal, or too small for even that.
+    if(exponent < -10) return sign;
+    mantissa |= 0x800000;
+    int shift = 14 - exponent;
+    uint32_t half = mantissa >> shift;
+    uint32_t remainder = mantissa & ((1u << shift) - 1);
+    uint32_t halfway = 1u << (shift - 1);
+    if(remainder > halfway || (remainder == halfway && (half & 1))) half++;
+    return sign | half;
+  }
+
+  // A carry out of the mantissa correctly bumps the exponent, up to infinity.
+  uint32_t half = (exponent << 10) | (mantissa >> 13);
+  uint32_t remainder = mantissa & 0x1fff;
+  if(remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) half++;
+  return sign | half;
+}
+
+float half_to_float(uint16_t half)
+{
+  uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+  uint32_t exponent = (half >> 10) & 0x1f;
+  uint32_t mantissa = half & 0x3ff;
+
+  uint32_t bits = 0;
+  if(exponent == 0) {
+    if(mantissa == 0) {
+      bits = sign;
+    } else {
+      // Normalize a subnormal.
+      int float_exponent = 127 - 15 + 1;
+      while(!(mantissa & 0x400)) {
+        mantissa <<= 1;
+        float_exponent--;
+      }
+      bits = sign | (float_exponent << 23) | ((mantissa & 0x3ff) << 13);
+    }
+  } else if(exponent == 31) {
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  } else {
+    bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+  }
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+float quantize_int8(const float* values, int number_of_values, int8_t* quantized)
+{
+  float largest = 0;
+  for(int i = 0; i < number_of_values; i++) largest = std::max(largest, std::fabs(values[i]));
+  if(largest == 0) {
+    std::fill(quantized, quantized + number_of_values, 0);
+    return 0;
+  }
+  float scale = largest / 127;
+  for(int i = 0; i < number_of_values; i++) {
+    float q = std::round(values[i] / scale);
+    quantized[i] = static_cast<int8_t>(std::max(-127.0f, std::min(127.0f, q)));
+  }
+  return scale;
+}
+
+QuantizationError::QuantizationError()
+  : count(0), sum_absolute(0), max_absolute(0), decisions(0), same_choices(0)
+{}
+
+void QuantizationError::add(float reference, float approximation)
+{
+  double error = std::fabs(static_cast<double>(reference) - approximation);
+  count++;
+  sum_absolute += error;
+  max_absolute = std::max(max_absolute, error);
+}
+
+void QuantizationError::add_decision(bool same_choice)
+{
+  decisions++;
+  if(same_choice) same_choices++;
+}
+
+} // namespace learning
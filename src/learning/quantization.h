@@ -0,0 +1,57 @@
+#ifndef DEEPSHEEP_LEARNING_QUANTIZATION_H_
+#define DEEPSHEEP_LEARNING_QUANTIZATION_H_
+
+#include <cstdint>
+
+namespace learning {
+
+/// How learned weights are stored for evaluation.
+
+/** Evaluation mostly streams weights from memory, so storing them smaller
+ *  makes it faster once they no longer fit in cache. FP16 keeps about
+ *  three significant digits of each weight. INT8 is symmetric, scaled per
+ *  row so the row's largest magnitude maps to 127, and keeps two.
+ */
+enum class Precision
+{
+  FLOAT32 = 0,
+  FP16 = 1,
+  INT8 = 2
+};
+
+const char* precision_name(Precision precision);
+
+//! Bytes a weight takes at a precision.
+int precision_bytes(Precision precision);
+
+//! Convert to IEEE half precision, rounding to nearest even.
+uint16_t float_to_half(float value);
+float half_to_float(uint16_t half);
+
+/// Quantize values to int8 symmetrically and return the scale.
+
+//! quantized[i] * scale is the nearest value to values[i] on the grid. The
+//! scale is 0 when every value is 0.
+float quantize_int8(const float* values, int number_of_values, int8_t* quantized);
+
+/// How far quantized values stray from the values they approximate.
+struct QuantizationError
+{
+  QuantizationError();
+
+  void add(float reference, float approximation);
+  //! Count a decision, and whether the best action was the same under both.
+  void add_decision(bool same_choice);
+
+  double mean_absolute() const { return count ? sum_absolute / count : 0; }
+  double agreement() const { return decisions ? static_cast<double>(same_choices) / decisions : 1; }
+
+  long long count;
+  double sum_absolute;
+  double max_absolute;
+  long long decisions;
+  long long same_choices;
+};
+
+} // namespace learning
+#endif
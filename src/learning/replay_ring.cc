@@ -0,0 +1,156 @@
+#include "replay_ring.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace learning {
+
+namespace {
+
+// Samplers give up on a batch after this many torn or empty reads in a row.
+const int MAX_FAILED_READS = 16;
+
+} // namespace
+
+ReplayStats::ReplayStats()
+  : pushes(0), drops(0), overwritten_unsampled(0), samples(0), mean_staleness(0)
+{}
+
+ReplayRing::ReplayRing(size_t capacity, OverwritePolicy policy)
+  : m_records(nullptr), m_mask(0), m_policy(policy), m_next_ticket(0), m_drops(0),
+    m_overwritten_unsampled(0), m_samples(0), m_staleness(0)
+{
+  size_t number_of_slots = 1;
+  while(number_of_slots < capacity) number_of_slots *= 2;
+
+  // Over-allocate so the records can start on a cache line boundary.
+  m_storage.reset(new char[number_of_slots * sizeof(Record) + alignof(Record)]);
+  uintptr_t address = reinterpret_cast<uintptr_t>(m_storage.get());
+  address = (address + alignof(Record) - 1) & ~static_cast<uintptr_t>(alignof(Record) - 1);
+  m_records = reinterpret_cast<Record*>(address);
+  for(size_t i = 0; i < number_of_slots; i++) new (&m_records[i]) Record();
+  m_slots.reset(new Slot[number_of_slots]);
+  m_mask = number_of_slots - 1;
+  clear();
+}
+
+bool ReplayRing::push(const ExperienceRecord& record)
+{
+  uint64_t ticket = m_next_ticket.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = m_slots[ticket & m_mask];
+  uint64_t writing = 2 * ticket + 1;
+
+  uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+  bool unsampled = false;
+  do {
+    // Busy with another push, or already holding a later ticket.
+    if((sequence & 1) || sequence > writing) {
+      m_drops.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    unsampled = sequence != 0 && slot.samples.load(std::memory_order_relaxed) == 0;
+    if(unsampled && m_policy == OverwritePolicy::DROP_WHEN_UNSAMPLED) {
+      m_drops.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  } while(!slot.sequence.compare_exchange_weak(sequence, writing, std::memory_order_acq_rel,
+                                                std::memory_order_acquire));
+  if(unsampled) m_overwritten_unsampled.fetch_add(1, std::memory_order_relaxed);
+
+  // Keep the words from being seen before the odd sequence, so a sampler
+  // that reads any of them then sees the slot is being written.
+  std::atomic_thread_fence(std::memory_order_release);
+  uint64_t words[WORDS_PER_RECORD];
+  memcpy(words, &record, sizeof(words));
+  Record& stored = m_records[ticket & m_mask];
+  for(int i = 0; i < WORDS_PER_RECORD; i++) {
+    stored.words[i].store(words[i], std::memory_order_relaxed);
+  }
+  slot.samples.store(0, std::memory_order_relaxed);
+  slot.sequence.store(writing + 1, std::memory_order_release);
+  return true;
+}
+
+uint64_t ReplayRing::try_read(size_t index, ExperienceRecord* record) const
+{
+  const Slot& slot = m_slots[index];
+  uint64_t before = slot.sequence.load(std::memory_order_acquire);
+  if(before == 0 || (before & 1)) return 0;
+
+  uint64_t words[WORDS_PER_RECORD];
+  const Record& stored = m_records[index];
+  for(int i = 0; i < WORDS_PER_RECORD; i++) {
+    words[i] = stored.words[i].load(std::memory_order_relaxed);
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if(slot.sequence.load(std::memory_order_relaxed) != before) return 0;
+
+  memcpy(record, words, sizeof(words));
+  return before / 2;
+}
+
+int ReplayRing::sample(ExperienceRecord* batch, int batch_size,
+                       std::default_random_engine& generator)
+{
+  size_t filled = size();
+  if(filled == 0) return 0;
+  std::uniform_int_distribution<size_t> distribution(0, filled - 1);
+
+  int sampled = 0;
+  int failed_reads = 0;
+  unsigned long long staleness = 0;
+  uint64_t head = m_next_ticket.load(std::memory_order_relaxed);
+  while(sampled < batch_size && failed_reads < MAX_FAILED_READS) {
+    size_t index = distribution(generator);
+    uint64_t ticket_plus_one = try_read(index, &batch[sampled]);
+    if(ticket_plus_one == 0) {
+      failed_reads++;
+      continue;
+    }
+    failed_reads = 0;
+    m_slots[index].samples.fetch_add(1, std::memory_order_relaxed);
+    if(head >= ticket_plus_one) staleness += head - ticket_plus_one;
+    sampled++;
+  }
+
+  m_samples.fetch_add(sampled, std::memory_order_relaxed);
+  m_staleness.fetch_add(staleness, std::memory_order_relaxed);
+  return sampled;
+}
+
+size_t ReplayRing::size() const
+{
+  uint64_t tickets = m_next_ticket.load(std::memory_order_relaxed);
+  return std::min<uint64_t>(tickets, capacity());
+}
+
+ReplayStats ReplayRing::stats() const
+{
+  ReplayStats stats;
+  stats.pushes = m_next_ticket.load(std::memory_order_relaxed);
+  stats.drops = m_drops.load(std::memory_order_relaxed);
+  stats.overwritten_unsampled = m_overwritten_unsampled.load(std::memory_order_relaxed);
+  stats.samples = m_samples.load(std::memory_order_relaxed);
+  if(stats.samples > 0) {
+    stats.mean_staleness = static_cast<double>(m_staleness.load(std::memory_order_relaxed)) /
+                           stats.samples;
+  }
+  return stats;
+}
+
+void ReplayRing::clear()
+{
+  for(size_t i = 0; i <= m_mask; i++) {
+    m_slots[i].sequence.store(0, std::memory_order_relaxed);
+    m_slots[i].samples.store(0, std::memory_order_relaxed);
+    for(auto& word : m_records[i].words) word.store(0, std::memory_order_relaxed);
+  }
+  m_next_ticket.store(0, std::memory_order_relaxed);
+  m_drops.store(0, std::memory_order_relaxed);
+  m_overwritten_unsampled.store(0, std::memory_order_relaxed);
+  m_samples.store(0, std::memory_order_relaxed);
+  m_staleness.store(0, std::memory_order_relaxed);
+}
+
+} // namespace learning
@@ -0,0 +1,109 @@
+#ifndef DEEPSHEEP_LEARNING_REPLAYRING_H_
+#define DEEPSHEEP_LEARNING_REPLAYRING_H_
+
+#include "learning/experience_record.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+namespace learning {
+
+/// What a ReplayRing does with a push that would replace a record no learner has sampled.
+enum class OverwritePolicy
+{
+  OVERWRITE_OLDEST,   //!< Replace it anyway: the ring always holds the newest records.
+  DROP_WHEN_UNSAMPLED //!< Drop the push, so every kept record is learned from once.
+};
+
+/// Counts of what happened to a ReplayRing.
+struct ReplayStats
+{
+  ReplayStats();
+
+  unsigned long long pushes;
+  //! Pushes that were not stored.
+  unsigned long long drops;
+  //! Records replaced before any learner sampled them.
+  unsigned long long overwritten_unsampled;
+  unsigned long long samples;
+  //! The mean number of pushes made after a sampled record was pushed.
+  double mean_staleness;
+};
+
+/// A bounded replay memory that actors push into and learners sample from, without locks.
+
+/** Pushes claim increasing tickets from one counter, and ticket t goes to
+ *  slot t modulo the capacity, so the ring holds about the last capacity
+ *  records. Each slot carries a sequence number, odd while a push writes
+ *  the slot and even when the record is whole, as a seqlock: samplers
+ *  copy the record and keep it only if the sequence didn't change. Record
+ *  words are relaxed atomics, so there are no data races and nothing ever
+ *  waits. A push finding its slot busy with another push, or holding a
+ *  newer record, is dropped.
+ *
+ *  Any number of threads may push and sample at once.
+ */
+class ReplayRing
+{
+public:
+  //! Construct a ring for at least capacity records, rounded up to a power of two.
+  explicit ReplayRing(size_t capacity,
+                      OverwritePolicy policy = OverwritePolicy::OVERWRITE_OLDEST);
+
+  //! Store a record. Returns false if it was dropped.
+  bool push(const ExperienceRecord& record);
+
+  //! Copy up to batch_size records, sampled uniformly with replacement, into batch.
+
+  //! Returns the number copied, fewer than batch_size only when the ring is
+  //! empty or nearly so, or pushes keep overwriting the records picked.
+  int sample(ExperienceRecord* batch, int batch_size,
+             std::default_random_engine& generator);
+
+  size_t capacity() const { return m_mask + 1; }
+  //! The number of slots pushed to so far, at most capacity().
+  size_t size() const;
+  OverwritePolicy policy() const { return m_policy; }
+
+  ReplayStats stats() const;
+
+  //! Remove every record and reset the counters. Not safe while other threads use the ring.
+  void clear();
+
+private:
+  static const int WORDS_PER_RECORD = sizeof(ExperienceRecord) / sizeof(uint64_t);
+
+  struct alignas(64) Record
+  {
+    std::atomic<uint64_t> words[WORDS_PER_RECORD];
+  };
+
+  struct Slot
+  {
+    //! 0 when empty, 2t + 1 while ticket t is written, 2t + 2 once it is.
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint32_t> samples;
+  };
+
+  //! Copy a slot's record if it is whole. Returns its ticket plus one, or 0.
+  uint64_t try_read(size_t index, ExperienceRecord* record) const;
+
+  std::unique_ptr<char[]> m_storage;
+  Record* m_records;
+  std::unique_ptr<Slot[]> m_slots;
+  size_t m_mask;
+  OverwritePolicy m_policy;
+
+  alignas(64) std::atomic<uint64_t> m_next_ticket;
+  alignas(64) std::atomic<unsigned long long> m_drops;
+  std::atomic<unsigned long long> m_overwritten_unsampled;
+  std::atomic<unsigned long long> m_samples;
+  std::atomic<unsigned long long> m_staleness;
+
+}; // class ReplayRing
+
+} // namespace learning
+#endif
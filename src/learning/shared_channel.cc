@@ -0,0 +1,487 @@
+#include "shared_channel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace learning {
+
+namespace {
+
+const char EXPERIENCE_MAGIC[8] = {'D', 'S', 'E', 'X', 'P', 'Q', '0', '1'};
+const char SNAPSHOT_MAGIC[8] = {'D', 'S', 'S', 'N', 'A', 'P', '0', '1'};
+const size_t CACHE_LINE = 64;
+// Waits are cut into slices so a closed channel is noticed even if a wake
+// is missed.
+const int WAIT_SLICE_MILLISECONDS = 100;
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && ATOMIC_INT_LOCK_FREE == 2,
+              "futex words must be plain lock-free 32-bit integers");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2,
+              "atomics in shared memory must be lock-free to work across processes");
+
+size_t round_up(size_t size, size_t alignment)
+{
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+std::string segment_name(const std::string& name)
+{
+  return name.empty() || name[0] != '/' ? "/" + name : name;
+}
+
+// Create a zeroed segment of size bytes and map it, or return null.
+void* create_segment(const std::string& name, size_t size)
+{
+  shm_unlink(name.c_str());
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if(fd < 0) return nullptr;
+  if(ftruncate(fd, size) != 0) {
+    close(fd);
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+  void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(mapping == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+  return mapping;
+}
+
+// Map an existing segment, or return null.
+void* open_segment(const std::string& name, size_t* size)
+{
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if(fd < 0) return nullptr;
+  struct stat segment_stat;
+  if(fstat(fd, &segment_stat) != 0 || segment_stat.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  *size = segment_stat.st_size;
+  void* mapping = mmap(nullptr, *size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  return mapping == MAP_FAILED ? nullptr : mapping;
+}
+
+// The segments are shared between processes, so the futexes can't be private.
+void futex_wait(std::atomic<uint32_t>* word, uint32_t expected, int milliseconds)
+{
+  struct timespec timeout;
+  timeout.tv_sec = milliseconds / 1000;
+  timeout.tv_nsec = (milliseconds % 1000) * 1000000L;
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &timeout,
+          nullptr, 0);
+}
+
+void futex_wake_all(std::atomic<uint32_t>* word)
+{
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX, nullptr,
+          nullptr, 0);
+}
+
+} // namespace
+
+struct ExperienceChannel::Header
+{
+  char magic[8];
+  uint64_t capacity;
+
+  // Producers and the consumer each get a line to themselves.
+  alignas(64) std::atomic<uint64_t> write_position;
+  alignas(64) std::atomic<uint64_t> read_position;
+
+  alignas(64) std::atomic<uint32_t> published;
+  std::atomic<uint32_t> consumer_waiting;
+  std::atomic<uint32_t> freed;
+  std::atomic<uint32_t> producers_waiting;
+  std::atomic<uint32_t> closed;
+  std::atomic<unsigned long long> pushed;
+  std::atomic<unsigned long long> full_waits;
+};
+
+namespace {
+
+// The header, then a sequence and a length for each slot, then the records.
+size_t experience_segment_size(size_t header_size, size_t capacity, size_t* sequences_offset,
+                               size_t* lengths_offset, size_t* records_offset)
+{
+  *sequences_offset = round_up(header_size, CACHE_LINE);
+  *lengths_offset = *sequences_offset + capacity * sizeof(uint64_t);
+  *records_offset = round_up(*lengths_offset + capacity * sizeof(uint32_t), CACHE_LINE);
+  return *records_offset + capacity * sizeof(ExperienceRecord);
+}
+
+} // namespace
+
+ExperienceChannel::ExperienceChannel(const std::string& name, size_t capacity)
+  : m_name(segment_name(name)), m_owner(true), m_mapping(nullptr), m_mapping_size(0),
+    m_header(nullptr), m_sequences(nullptr), m_lengths(nullptr), m_records(nullptr)
+{
+  // One slot would be published and free for the next lap at once, so
+  // there are always at least two.
+  size_t rounded_capacity = 2;
+  while(rounded_capacity < capacity) rounded_capacity *= 2;
+  size_t sequences_offset, lengths_offset, records_offset;
+  size_t size = experience_segment_size(sizeof(Header), rounded_capacity, &sequences_offset,
+                                        &lengths_offset, &records_offset);
+  void* mapping = create_segment(m_name, size);
+  if(!mapping) return;
+
+  Header* header = new(mapping) Header();
+  header->capacity = rounded_capacity;
+  header->write_position.store(0);
+  header->read_position.store(0);
+  header->published.store(0);
+  header->consumer_waiting.store(0);
+  header->freed.store(0);
+  header->producers_waiting.store(0);
+  header->closed.store(0);
+  header->pushed.store(0);
+  header->full_waits.store(0);
+  auto sequences = reinterpret_cast<std::atomic<uint64_t>*>(
+      static_cast<char*>(mapping) + sequences_offset);
+  for(size_t i = 0; i < rounded_capacity; i++) new(&sequences[i]) std::atomic<uint64_t>(i);
+  // Openers check the magic, so it goes in last.
+  std::atomic_thread_fence(std::memory_order_release);
+  memcpy(header->magic, EXPERIENCE_MAGIC, sizeof(EXPERIENCE_MAGIC));
+  attach(mapping, size);
+}
+
+ExperienceChannel::ExperienceChannel(const std::string& name)
+  : m_name(segment_name(name)), m_owner(false), m_mapping(nullptr), m_mapping_size(0),
+    m_header(nullptr), m_sequences(nullptr), m_lengths(nullptr), m_records(nullptr)
+{
+  size_t size = 0;
+  void* mapping = open_segment(m_name, &size);
+  if(!mapping) return;
+
+  const Header* header = static_cast<const Header*>(mapping);
+  size_t sequences_offset, lengths_offset, records_offset;
+  if(size < sizeof(Header) ||
+     memcmp(header->magic, EXPERIENCE_MAGIC, sizeof(EXPERIENCE_MAGIC)) != 0 ||
+     header->capacity < 2 || (header->capacity & (header->capacity - 1)) != 0 ||
+     experience_segment_size(sizeof(Header), header->capacity, &sequences_offset,
+                             &lengths_offset, &records_offset) != size) {
+    munmap(mapping, size);
+    return;
+  }
+  attach(mapping, size);
+}
+
+void ExperienceChannel::attach(void* mapping, size_t size)
+{
+  m_mapping = mapping;
+  m_mapping_size = size;
+  m_header = static_cast<Header*>(mapping);
+  size_t sequences_offset, lengths_offset, records_offset;
+  experience_segment_size(sizeof(Header), m_header->capacity, &sequences_offset,
+                          &lengths_offset, &records_offset);
+  char* base = static_cast<char*>(mapping);
+  m_sequences = reinterpret_cast<std::atomic<uint64_t>*>(base + sequences_offset);
+  m_lengths = reinterpret_cast<uint32_t*>(base + lengths_offset);
+  m_records = reinterpret_cast<ExperienceRecord*>(base + records_offset);
+}
+
+ExperienceChannel::~ExperienceChannel()
+{
+  if(m_mapping) munmap(m_mapping, m_mapping_size);
+  if(m_owner && m_mapping) shm_unlink(m_name.c_str());
+}
+
+size_t ExperienceChannel::capacity() const
+{
+  return m_header->capacity;
+}
+
+size_t ExperienceChannel::size() const
+{
+  uint64_t read = m_header->read_position.load(std::memory_order_relaxed);
+  uint64_t written = m_header->write_position.load(std::memory_order_relaxed);
+  return written > read ? written - read : 0;
+}
+
+bool ExperienceChannel::try_push(const ExperienceRecord* records, int number_of_records)
+{
+  assert(number_of_records > 0 && static_cast<size_t>(number_of_records) <= capacity());
+  uint64_t mask = m_header->capacity - 1;
+
+  // The consumer frees slots in order, so if the last slot wanted is free
+  // for this lap, so are the ones before it.
+  uint64_t position = m_header->write_position.load(std::memory_order_relaxed);
+  for(;;) {
+    uint64_t last = position + number_of_records - 1;
+    uint64_t sequence = m_sequences[last & mask].load(std::memory_order_acquire);
+    int64_t difference = static_cast<int64_t>(sequence - last);
+    if(difference == 0) {
+      if(m_header->write_position.compare_exchange_weak(position, position + number_of_records,
+                                                        std::memory_order_relaxed)) {
+        break;
+      }
+    } else if(difference < 0) {
+      return false;
+    } else {
+      position = m_header->write_position.load(std::memory_order_relaxed);
+    }
+  }
+
+  for(int i = 0; i < number_of_records; i++) m_records[(position + i) & mask] = records[i];
+  m_lengths[position & mask] = number_of_records;
+  for(int i = 0; i < number_of_records; i++) {
+    m_sequences[(position + i) & mask].store(position + i + 1, std::memory_order_release);
+  }
+
+  m_header->pushed.fetch_add(number_of_records, std::memory_order_relaxed);
+  m_header->published.fetch_add(1, std::memory_order_release);
+  if(m_header->consumer_waiting.load()) futex_wake_all(&m_header->published);
+  return true;
+}
+
+bool ExperienceChannel::push(const ExperienceRecord* records, int number_of_records)
+{
+  for(;;) {
+    if(is_closed()) return false;
+    if(try_push(records, number_of_records)) return true;
+
+    // Say we're waiting before trying once more, so a pop in between
+    // either leaves room for the retry or wakes us.
+    uint32_t observed = m_header->freed.load(std::memory_order_acquire);
+    m_header->producers_waiting.fetch_add(1);
+    bool pushed = try_push(records, number_of_records);
+    if(!pushed && !is_closed()) {
+      m_header->full_waits.fetch_add(1, std::memory_order_relaxed);
+      futex_wait(&m_header->freed, observed, WAIT_SLICE_MILLISECONDS);
+    }
+    m_header->producers_waiting.fetch_sub(1);
+    if(pushed) return true;
+  }
+}
+
+int ExperienceChannel::take(ExperienceRecord* records, int max_records)
+{
+  uint64_t mask = m_header->capacity - 1;
+  uint64_t position = m_header->read_position.load(std::memory_order_relaxed);
+  int taken = 0;
+  for(;;) {
+    if(m_sequences[position & mask].load(std::memory_order_acquire) != position + 1) break;
+    int length = m_lengths[position & mask];
+    if(taken == 0 && length > max_records) return -1;
+    if(taken + length > max_records) break;
+
+    // The rest of a push may still be being published.
+    for(int i = 0; i < length; i++) {
+      uint64_t slot_position = position + i;
+      while(m_sequences[slot_position & mask].load(std::memory_order_acquire) !=
+            slot_position + 1) {
+        std::this_thread::yield();
+      }
+      records[taken + i] = m_records[slot_position & mask];
+    }
+    for(int i = 0; i < length; i++) {
+      uint64_t slot_position = position + i;
+      m_sequences[slot_position & mask].store(slot_position + m_header->capacity,
+                                              std::memory_order_release);
+    }
+    position += length;
+    taken += length;
+  }
+  if(taken == 0) return 0;
+
+  m_header->read_position.store(position, std::memory_order_relaxed);
+  m_header->freed.fetch_add(1, std::memory_order_release);
+  if(m_header->producers_waiting.load()) futex_wake_all(&m_header->freed);
+  return taken;
+}
+
+int ExperienceChannel::pop(ExperienceRecord* records, int max_records, int timeout_milliseconds)
+{
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(timeout_milliseconds);
+  for(;;) {
+    int taken = take(records, max_records);
+    if(taken != 0 || is_closed()) return taken;
+
+    uint32_t observed = m_header->published.load(std::memory_order_acquire);
+    m_header->consumer_waiting.store(1);
+    taken = take(records, max_records);
+    if(taken != 0) {
+      m_header->consumer_waiting.store(0);
+      return taken;
+    }
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - std::chrono::steady_clock::now()).count();
+    if(remaining <= 0 || is_closed()) {
+      m_header->consumer_waiting.store(0);
+      return 0;
+    }
+    futex_wait(&m_header->published, observed,
+               std::min<long long>(remaining, WAIT_SLICE_MILLISECONDS));
+    m_header->consumer_waiting.store(0);
+  }
+}
+
+void ExperienceChannel::close()
+{
+  m_header->closed.store(1);
+  m_header->published.fetch_add(1);
+  m_header->freed.fetch_add(1);
+  futex_wake_all(&m_header->published);
+  futex_wake_all(&m_header->freed);
+}
+
+bool ExperienceChannel::is_closed() const
+{
+  return m_header->closed.load() != 0;
+}
+
+unsigned long long ExperienceChannel::pushed() const
+{
+  return m_header->pushed.load(std::memory_order_relaxed);
+}
+
+unsigned long long ExperienceChannel::full_waits() const
+{
+  return m_header->full_waits.load(std::memory_order_relaxed);
+}
+
+struct SnapshotChannel::Header
+{
+  char magic[8];
+  uint64_t max_bytes;
+  std::atomic<uint64_t> version;
+  std::atomic<uint32_t> current;
+  //! Odd while the buffer is being written.
+  std::atomic<uint64_t> sequences[2];
+  std::atomic<uint64_t> sizes[2];
+};
+
+namespace {
+
+size_t snapshot_buffer_offset(size_t header_size, int buffer, size_t max_bytes)
+{
+  return round_up(header_size, CACHE_LINE) +
+         buffer * round_up(max_bytes, CACHE_LINE);
+}
+
+} // namespace
+
+SnapshotChannel::SnapshotChannel(const std::string& name, size_t max_bytes)
+  : m_name(segment_name(name)), m_owner(true), m_mapping(nullptr), m_mapping_size(0),
+    m_header(nullptr), m_buffers{nullptr, nullptr}
+{
+  size_t size = snapshot_buffer_offset(sizeof(Header), 2, max_bytes);
+  void* mapping = create_segment(m_name, size);
+  if(!mapping) return;
+
+  Header* header = new(mapping) Header();
+  header->max_bytes = max_bytes;
+  header->version.store(0);
+  header->current.store(0);
+  for(int i = 0; i < 2; i++) {
+    header->sequences[i].store(0);
+    header->sizes[i].store(0);
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+  memcpy(header->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+
+  m_mapping = mapping;
+  m_mapping_size = size;
+  m_header = header;
+  for(int i = 0; i < 2; i++) {
+    m_buffers[i] = static_cast<char*>(mapping) +
+                   snapshot_buffer_offset(sizeof(Header), i, max_bytes);
+  }
+}
+
+SnapshotChannel::SnapshotChannel(const std::string& name)
+  : m_name(segment_name(name)), m_owner(false), m_mapping(nullptr), m_mapping_size(0),
+    m_header(nullptr), m_buffers{nullptr, nullptr}
+{
+  size_t size = 0;
+  void* mapping = open_segment(m_name, &size);
+  if(!mapping) return;
+
+  Header* header = static_cast<Header*>(mapping);
+  if(size < sizeof(Header) ||
+     memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 ||
+     snapshot_buffer_offset(sizeof(Header), 2, header->max_bytes) != size) {
+    munmap(mapping, size);
+    return;
+  }
+  m_mapping = mapping;
+  m_mapping_size = size;
+  m_header = header;
+  for(int i = 0; i < 2; i++) {
+    m_buffers[i] = static_cast<char*>(mapping) +
+                   snapshot_buffer_offset(sizeof(Header), i, header->max_bytes);
+  }
+}
+
+SnapshotChannel::~SnapshotChannel()
+{
+  if(m_mapping) munmap(m_mapping, m_mapping_size);
+  if(m_owner && m_mapping) shm_unlink(m_name.c_str());
+}
+
+size_t SnapshotChannel::max_bytes() const
+{
+  return m_header->max_bytes;
+}
+
+uint64_t SnapshotChannel::version() const
+{
+  return m_header->version.load(std::memory_order_acquire);
+}
+
+void SnapshotChannel::publish(const void* data, size_t bytes)
+{
+  assert(bytes <= m_header->max_bytes);
+  int buffer = 1 - m_header->current.load(std::memory_order_relaxed);
+  uint64_t sequence = m_header->sequences[buffer].load(std::memory_order_relaxed);
+  m_header->sequences[buffer].store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  m_header->sizes[buffer].store(bytes, std::memory_order_relaxed);
+  memcpy(m_buffers[buffer], data, bytes);
+
+  m_header->sequences[buffer].store(sequence + 2, std::memory_order_release);
+  m_header->current.store(buffer, std::memory_order_release);
+  m_header->version.fetch_add(1, std::memory_order_release);
+}
+
+bool SnapshotChannel::read_newer(uint64_t* version, std::vector<char>* data) const
+{
+  for(;;) {
+    uint64_t latest = m_header->version.load(std::memory_order_acquire);
+    if(latest <= *version) return false;
+
+    int buffer = m_header->current.load(std::memory_order_acquire);
+    uint64_t before = m_header->sequences[buffer].load(std::memory_order_acquire);
+    if(before & 1) continue;
+    size_t bytes = m_header->sizes[buffer].load(std::memory_order_relaxed);
+    if(bytes > m_header->max_bytes) continue;
+    data->resize(bytes);
+    memcpy(data->data(), m_buffers[buffer], bytes);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if(m_header->sequences[buffer].load(std::memory_order_relaxed) != before) continue;
+
+    *version = latest;
+    return true;
+  }
+}
+
+} // namespace learning
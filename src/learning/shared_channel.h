@@ -0,0 +1,149 @@
+#ifndef DEEPSHEEP_LEARNING_SHAREDCHANNEL_H_
+#define DEEPSHEEP_LEARNING_SHAREDCHANNEL_H_
+
+#include "learning/experience_record.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace learning {
+
+/// A bounded queue of ExperienceRecords in POSIX shared memory, from many processes to one.
+
+/** The learner creates the channel under a name, and actor processes open
+ *  it by that name, so the processes share nothing but the segment: no
+ *  protobuf state, no allocator, no network. Records are pushed a hand at
+ *  a time, and a push either fits whole or waits, so the learner always
+ *  receives complete hands, contiguous and in order, and actors slow to the
+ *  learner's pace when it falls behind.
+ *
+ *  The queue is a ring of 64-byte slots, each with a sequence number that
+ *  says which lap of the ring it was last written or read on. Producers
+ *  claim consecutive slots with a compare-and-swap on the write position,
+ *  copy their records in and publish them by advancing the slots'
+ *  sequences; the consumer reads whole pushes and hands the slots back the
+ *  same way. Nobody takes a lock. Waiting on a full or empty ring is a
+ *  shared futex wait, woken only when a waiter has said it is there.
+ *
+ *  Any number of processes or threads may push, one at a time may pop. A
+ *  producer that dies between claiming slots and publishing them stalls
+ *  the consumer at those slots.
+ */
+class ExperienceChannel
+{
+public:
+  //! Create a channel holding capacity records, rounded up to a power of two
+  //! no less than 2, replacing any segment of the same name. The creator removes the name
+  //! when it is destroyed. Check is_open() for success.
+  ExperienceChannel(const std::string& name, size_t capacity);
+
+  //! Open a channel another process created. Check is_open() for success.
+  explicit ExperienceChannel(const std::string& name);
+
+  ~ExperienceChannel();
+
+  ExperienceChannel(const ExperienceChannel&) = delete;
+  ExperienceChannel& operator=(const ExperienceChannel&) = delete;
+
+  bool is_open() const { return m_header != nullptr; }
+  size_t capacity() const;
+  //! The number of records pushed and not yet popped.
+  size_t size() const;
+
+  //! Push records as one unit, waiting while there isn't room. Returns false
+  //! if the channel is closed. number_of_records must be at most capacity().
+  bool push(const ExperienceRecord* records, int number_of_records);
+  //! Push without waiting. Returns false if there isn't room.
+  bool try_push(const ExperienceRecord* records, int number_of_records);
+
+  /// Pop whole pushes, up to max_records records in all.
+
+  //! Waits up to timeout_milliseconds for the first push, then takes every
+  //! push already waiting that fits. Returns the number of records popped,
+  //! 0 on timeout or once the channel is closed and empty, and -1 if the
+  //! next push is larger than max_records, which leaves it in the channel.
+  int pop(ExperienceRecord* records, int max_records, int timeout_milliseconds);
+
+  //! Refuse further pushes and wake everyone waiting.
+  void close();
+  bool is_closed() const;
+
+  //! Records pushed over the life of the channel, by every process.
+  unsigned long long pushed() const;
+  //! Times a push found the channel full and had to wait.
+  unsigned long long full_waits() const;
+
+private:
+  struct Header;
+
+  //! Point the members into a mapped segment.
+  void attach(void* mapping, size_t size);
+  //! Take whole published pushes without waiting, or return -1 if the
+  //! first is larger than max_records.
+  int take(ExperienceRecord* records, int max_records);
+
+  std::string m_name;
+  bool m_owner;
+  void* m_mapping;
+  size_t m_mapping_size;
+  Header* m_header;
+  std::atomic<uint64_t>* m_sequences;
+  uint32_t* m_lengths;
+  ExperienceRecord* m_records;
+
+}; // class ExperienceChannel
+
+/// The latest snapshot of a model in POSIX shared memory, from one process to many.
+
+/** The learner publishes a blob of bytes, such as a network's weights, and
+ *  actors copy out the newest one whenever they like. There are two
+ *  buffers: a publish writes the one readers aren't directed to and then
+ *  switches them over, and each buffer has a sequence number that is odd
+ *  while it is written, so a reader that overlapped a write can tell and
+ *  tries again. Publishing never waits for readers.
+ */
+class SnapshotChannel
+{
+public:
+  //! Create a channel for snapshots of up to max_bytes, replacing any
+  //! segment of the same name. Check is_open() for success.
+  SnapshotChannel(const std::string& name, size_t max_bytes);
+
+  //! Open a channel another process created. Check is_open() for success.
+  explicit SnapshotChannel(const std::string& name);
+
+  ~SnapshotChannel();
+
+  SnapshotChannel(const SnapshotChannel&) = delete;
+  SnapshotChannel& operator=(const SnapshotChannel&) = delete;
+
+  bool is_open() const { return m_header != nullptr; }
+  size_t max_bytes() const;
+
+  //! Publish a snapshot. For one process at a time.
+  void publish(const void* data, size_t bytes);
+
+  //! The number of snapshots published so far.
+  uint64_t version() const;
+
+  //! Copy the latest snapshot if it is newer than *version, and update
+  //! *version. Returns false if there is nothing newer.
+  bool read_newer(uint64_t* version, std::vector<char>* data) const;
+
+private:
+  struct Header;
+
+  std::string m_name;
+  bool m_owner;
+  void* m_mapping;
+  size_t m_mapping_size;
+  Header* m_header;
+  char* m_buffers[2];
+
+}; // class SnapshotChannel
+
+} // namespace learning
+#endif
@@ -0,0 +1,177 @@
+#include "shared_transposition_table.h"
+
+#include <cassert>
+#include <new>
+
+namespace learning {
+
+namespace {
+
+// Data layout: value in bits 0-15, bound 16-23, best move 24-31, depth
+// 32-39, generation 40-47.
+uint64_t pack(int value, Bound bound, int best_move, int depth, unsigned generation)
+{
+  return static_cast<uint64_t>(static_cast<uint16_t>(value)) |
+         static_cast<uint64_t>(bound) << 16 |
+         static_cast<uint64_t>(static_cast<uint8_t>(best_move)) << 24 |
+         static_cast<uint64_t>(depth & 0xff) << 32 |
+         static_cast<uint64_t>(generation & 0xff) << 40;
+}
+
+TranspositionEntry unpack(uint64_t key, uint64_t data)
+{
+  TranspositionEntry entry;
+  entry.key = key;
+  entry.value = static_cast<int16_t>(data & 0xffff);
+  entry.bound = static_cast<Bound>((data >> 16) & 0xff);
+  entry.best_move = static_cast<int8_t>((data >> 24) & 0xff);
+  entry.depth = static_cast<uint8_t>((data >> 32) & 0xff);
+  entry.generation = static_cast<uint8_t>((data >> 40) & 0xff);
+  return entry;
+}
+
+Bound data_bound(uint64_t data) { return static_cast<Bound>((data >> 16) & 0xff); }
+int data_depth(uint64_t data) { return (data >> 32) & 0xff; }
+unsigned data_generation(uint64_t data) { return (data >> 40) & 0xff; }
+
+std::atomic<unsigned> next_thread_stripe(0);
+
+} // namespace
+
+TranspositionTableStats::TranspositionTableStats()
+  : probes(0), hits(0), stores(0), collisions(0)
+{}
+
+SharedTranspositionTable::SharedTranspositionTable(size_t megabytes)
+  : m_buckets(nullptr), m_bucket_mask(0), m_generation(0)
+{
+  size_t number_of_buckets = 1;
+  while(2 * number_of_buckets * sizeof(Bucket) <= megabytes << 20) {
+    number_of_buckets *= 2;
+  }
+
+  // Over-allocate so the buckets can start on a cache line boundary.
+  m_storage.reset(new char[number_of_buckets * sizeof(Bucket) + alignof(Bucket)]);
+  uintptr_t address = reinterpret_cast<uintptr_t>(m_storage.get());
+  address = (address + alignof(Bucket) - 1) & ~static_cast<uintptr_t>(alignof(Bucket) - 1);
+  m_buckets = reinterpret_cast<Bucket*>(address);
+  for(size_t i = 0; i < number_of_buckets; i++) new (&m_buckets[i]) Bucket();
+  m_bucket_mask = number_of_buckets - 1;
+  clear();
+  reset_stats();
+}
+
+SharedTranspositionTable::CounterStripe& SharedTranspositionTable::counters() const
+{
+  thread_local unsigned stripe = next_thread_stripe.fetch_add(1) % COUNTER_STRIPES;
+  return m_counters[stripe];
+}
+
+bool SharedTranspositionTable::probe(uint64_t key, TranspositionEntry* entry) const
+{
+  CounterStripe& stripe = counters();
+  stripe.probes.fetch_add(1, std::memory_order_relaxed);
+
+  const Bucket& candidates = bucket(key);
+  for(int i = 0; i < ENTRIES_PER_BUCKET; i++) {
+    uint64_t data = candidates.slots[i].data.load(std::memory_order_relaxed);
+    uint64_t checked_key = candidates.slots[i].checked_key.load(std::memory_order_relaxed);
+    if((checked_key ^ data) == key && data_bound(data) != Bound::NONE) {
+      *entry = unpack(key, data);
+      stripe.hits.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+void SharedTranspositionTable::store(uint64_t key, int value, Bound bound,
+                                     int depth, int best_move)
+{
+  assert(depth >= 0 && depth < 256);
+  assert(value >= INT16_MIN && value <= INT16_MAX);
+
+  unsigned generation = m_generation.load(std::memory_order_relaxed) & 0xff;
+  Bucket& candidates = bucket(key);
+
+  Slot* replace = &candidates.slots[0];
+  uint64_t replace_data = replace->data.load(std::memory_order_relaxed);
+  bool same_key = false;
+  for(int i = 0; i < ENTRIES_PER_BUCKET; i++) {
+    Slot* slot = &candidates.slots[i];
+    uint64_t data = slot->data.load(std::memory_order_relaxed);
+    uint64_t checked_key = slot->checked_key.load(std::memory_order_relaxed);
+    if((checked_key ^ data) == key || data_bound(data) == Bound::NONE) {
+      replace = slot;
+      replace_data = data;
+      same_key = (checked_key ^ data) == key && data_bound(data) != Bound::NONE;
+      break;
+    }
+    // Prefer entries from old searches, then the shallowest
+    bool slot_is_stale = data_generation(data) != generation;
+    bool replace_is_stale = data_generation(replace_data) != generation;
+    if(slot_is_stale != replace_is_stale) {
+      if(slot_is_stale) {
+        replace = slot;
+        replace_data = data;
+      }
+    } else if(data_depth(data) < data_depth(replace_data)) {
+      replace = slot;
+      replace_data = data;
+    }
+  }
+
+  bool replace_is_current = data_bound(replace_data) != Bound::NONE &&
+                            data_generation(replace_data) == generation;
+  if(same_key && replace_is_current && data_depth(replace_data) > depth) return;
+
+  CounterStripe& stripe = counters();
+  stripe.stores.fetch_add(1, std::memory_order_relaxed);
+  if(!same_key && replace_is_current) {
+    stripe.collisions.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t data = pack(value, bound, best_move, depth, generation);
+  replace->checked_key.store(key ^ data, std::memory_order_relaxed);
+  replace->data.store(data, std::memory_order_relaxed);
+}
+
+void SharedTranspositionTable::new_search()
+{
+  m_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SharedTranspositionTable::clear()
+{
+  for(size_t i = 0; i <= m_bucket_mask; i++) {
+    for(int j = 0; j < ENTRIES_PER_BUCKET; j++) {
+      m_buckets[i].slots[j].checked_key.store(0, std::memory_order_relaxed);
+      m_buckets[i].slots[j].data.store(0, std::memory_order_relaxed);
+    }
+  }
+  m_generation.store(0, std::memory_order_relaxed);
+}
+
+TranspositionTableStats SharedTranspositionTable::stats() const
+{
+  TranspositionTableStats stats;
+  for(const auto& stripe : m_counters) {
+    stats.probes += stripe.probes.load(std::memory_order_relaxed);
+    stats.hits += stripe.hits.load(std::memory_order_relaxed);
+    stats.stores += stripe.stores.load(std::memory_order_relaxed);
+    stats.collisions += stripe.collisions.load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+void SharedTranspositionTable::reset_stats()
+{
+  for(auto& stripe : m_counters) {
+    stripe.probes.store(0, std::memory_order_relaxed);
+    stripe.hits.store(0, std::memory_order_relaxed);
+    stripe.stores.store(0, std::memory_order_relaxed);
+    stripe.collisions.store(0, std::memory_order_relaxed);
+  }
+}
+
+} // namespace learning
@@ -0,0 +1,95 @@
+#ifndef DEEPSHEEP_LEARNING_SHAREDTRANSPOSITIONTABLE_H_
+#define DEEPSHEEP_LEARNING_SHAREDTRANSPOSITIONTABLE_H_
+
+#include "learning/transposition_table.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace learning {
+
+/// Counts of what happened to a SharedTranspositionTable.
+struct TranspositionTableStats
+{
+  TranspositionTableStats();
+
+  unsigned long long probes;
+  //! Probes that found an entry for their key.
+  unsigned long long hits;
+  unsigned long long stores;
+  //! Stores that replaced an entry for a different position from the same search.
+  unsigned long long collisions;
+};
+
+/// A TranspositionTable any number of threads can probe and store at once.
+
+/** There are no locks. Each entry is two 64-bit words, the packed data and
+ *  the key XORed with the data, written and read with relaxed atomics. If
+ *  two threads write an entry at the same time, or a read sees half of a
+ *  write, the words no longer XOR to the key and the probe simply misses.
+ *
+ *  Buckets, replacement and the probe and store calls are the same as
+ *  TranspositionTable, so the two can be used interchangeably.
+ */
+class SharedTranspositionTable
+{
+public:
+  static const int ENTRIES_PER_BUCKET = 4;
+
+  //! Construct a table using about megabytes of memory, rounded down to a
+  //! power of two number of buckets.
+  explicit SharedTranspositionTable(size_t megabytes);
+
+  bool probe(uint64_t key, TranspositionEntry* entry) const;
+  void store(uint64_t key, int value, Bound bound, int depth, int best_move);
+  void new_search();
+
+  //! Remove every entry. Not safe while other threads use the table.
+  void clear();
+
+  size_t capacity() const { return (m_bucket_mask + 1) * ENTRIES_PER_BUCKET; }
+
+  //! The counters summed over every thread.
+  TranspositionTableStats stats() const;
+  void reset_stats();
+
+private:
+  struct Slot
+  {
+    std::atomic<uint64_t> checked_key;
+    std::atomic<uint64_t> data;
+  };
+
+  struct alignas(64) Bucket
+  {
+    Slot slots[ENTRIES_PER_BUCKET];
+  };
+
+  // Counters are striped over cache lines by thread, so counting doesn't
+  // make threads fight over one line. They are padded rather than aligned so
+  // the table itself can be allocated with plain new.
+  static const int COUNTER_STRIPES = 16;
+  struct CounterStripe
+  {
+    std::atomic<unsigned long long> probes;
+    std::atomic<unsigned long long> hits;
+    std::atomic<unsigned long long> stores;
+    std::atomic<unsigned long long> collisions;
+    char padding[64 - 4 * sizeof(std::atomic<unsigned long long>)];
+  };
+
+  Bucket& bucket(uint64_t key) const { return m_buckets[key & m_bucket_mask]; }
+  CounterStripe& counters() const;
+
+  std::unique_ptr<char[]> m_storage;
+  Bucket* m_buckets;
+  size_t m_bucket_mask;
+  std::atomic<unsigned> m_generation;
+  mutable CounterStripe m_counters[COUNTER_STRIPES];
+
+}; // class SharedTranspositionTable
+
+} // namespace learning
+#endif
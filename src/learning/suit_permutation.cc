@@ -0,0 +1,72 @@
+#include "suit_permutation.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace learning {
+
+SuitPermutation::SuitPermutation()
+{
+  for(int suit = 0; suit < 4; suit++) m_suits[suit] = suit;
+}
+
+SuitPermutation SuitPermutation::fail_permutation(bool trump_is_clubs, int n)
+{
+  assert(n >= 0 && n < NUMBER_OF_FAIL_PERMUTATIONS);
+  int trump_suit = static_cast<int>(trump_is_clubs ? sheepshead::interface::Card::Suit::CLUBS
+                                                   : sheepshead::interface::Card::Suit::DIAMONDS);
+  int fail_suits[3];
+  int number_of_fail_suits = 0;
+  for(int suit = 0; suit < 4; suit++) {
+    if(suit != trump_suit) fail_suits[number_of_fail_suits++] = suit;
+  }
+
+  int targets[3] = {fail_suits[0], fail_suits[1], fail_suits[2]};
+  for(int i = 0; i < n; i++) std::next_permutation(targets, targets + 3);
+
+  SuitPermutation permutation;
+  for(int i = 0; i < 3; i++) permutation.m_suits[fail_suits[i]] = targets[i];
+  return permutation;
+}
+
+SuitPermutation SuitPermutation::inverse() const
+{
+  SuitPermutation inverted;
+  for(int suit = 0; suit < 4; suit++) inverted.m_suits[m_suits[suit]] = suit;
+  return inverted;
+}
+
+SuitPermutation SuitPermutation::after(const SuitPermutation& first) const
+{
+  SuitPermutation composed;
+  for(int suit = 0; suit < 4; suit++) composed.m_suits[suit] = m_suits[first.m_suits[suit]];
+  return composed;
+}
+
+bool SuitPermutation::is_identity() const
+{
+  return *this == SuitPermutation();
+}
+
+bool SuitPermutation::operator==(const SuitPermutation& rhs) const
+{
+  return std::equal(m_suits, m_suits + 4, rhs.m_suits);
+}
+
+SuitPermutation canonical_permutation(const CardMask* masks, int number_of_masks,
+                                      bool trump_is_clubs)
+{
+  SuitPermutation best;
+  for(int n = 1; n < SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+    auto permutation = SuitPermutation::fail_permutation(trump_is_clubs, n);
+    for(int i = 0; i < number_of_masks; i++) {
+      CardMask candidate = permutation.mask(masks[i]);
+      CardMask incumbent = best.mask(masks[i]);
+      if(candidate < incumbent) best = permutation;
+      if(candidate != incumbent) break;
+    }
+  }
+  return best;
+}
+
+} // namespace learning
@@ -0,0 +1,83 @@
+#ifndef DEEPSHEEP_LEARNING_SUITPERMUTATION_H_
+#define DEEPSHEEP_LEARNING_SUITPERMUTATION_H_
+
+#include "learning/card_mask.h"
+
+#include <cstdint>
+
+namespace learning {
+
+/// A relabeling of the fail suits that leaves every trump card in place.
+
+/** The three suits other than the trump suit hold the same ranks once their
+ *  queens and jacks, which are trump, are set aside, so swapping them
+ *  changes nothing about how cards play or score. A SuitPermutation maps
+ *  each fail suit to a fail suit and moves the ace, ten, king, nine, eight
+ *  and seven with it. Queens, jacks and the trump suit never move.
+ */
+class SuitPermutation
+{
+public:
+  static const int NUMBER_OF_FAIL_PERMUTATIONS = 6;
+
+  //! Construct the identity.
+  SuitPermutation();
+
+  //! The nth permutation of the fail suits, for n from 0 to 5. 0 is the identity.
+  static SuitPermutation fail_permutation(bool trump_is_clubs, int n);
+
+  //! Where a printed suit goes.
+  int suit(int suit) const { return m_suits[suit]; }
+
+  //! Where a card goes. NO_CARD stays NO_CARD.
+  int card(int card) const
+  {
+    if(card == NO_CARD) return NO_CARD;
+    int rank = card % 8;
+    if(rank == QUEEN_RANK || rank == JACK_RANK) return card;
+    return 8 * m_suits[card / 8] + rank;
+  }
+
+  //! Where a set of cards goes.
+  CardMask mask(CardMask cards) const
+  {
+    // Each suit is a byte of the mask, so fail cards move a byte at a time.
+    CardMask moved = cards & ~(FAIL_RANKS * 0x01010101u);
+    for(int suit = 0; suit < 4; suit++) {
+      moved |= ((cards >> (8 * suit)) & FAIL_RANKS) << (8 * m_suits[suit]);
+    }
+    return moved;
+  }
+
+  //! The permutation that undoes this one.
+  SuitPermutation inverse() const;
+
+  //! This permutation applied after first.
+  SuitPermutation after(const SuitPermutation& first) const;
+
+  bool is_identity() const;
+  bool operator==(const SuitPermutation& rhs) const;
+  bool operator!=(const SuitPermutation& rhs) const { return !(*this == rhs); }
+
+private:
+  static const int QUEEN_RANK = 3;
+  static const int JACK_RANK = 4;
+  //! The ranks within a suit's byte that aren't trump: all but queen and jack.
+  static const CardMask FAIL_RANKS = 0xE7;
+
+  int8_t m_suits[4];
+
+}; // class SuitPermutation
+
+/// Choose the fail-suit permutation that makes a list of card sets canonical.
+
+//! Every permutation is applied to the sets, and the one giving the smallest
+//! list, compared set by set, is returned. Lists that describe states
+//! isomorphic up to the fail suits all come out the same, so the sets should
+//! describe everything that distinguishes a state: each seat's cards, the
+//! cards in the current trick in order, a called partner card, and so on.
+SuitPermutation canonical_permutation(const CardMask* masks, int number_of_masks,
+                                      bool trump_is_clubs);
+
+} // namespace learning
+#endif
@@ -0,0 +1,89 @@
+#include "sum_tree.h"
+
+#include <cassert>
+#include <cstdint>
+
+namespace learning {
+
+SumTree::SumTree(size_t size)
+  : m_size(size), m_nodes(nullptr), m_number_of_nodes(0)
+{
+  // The root gets a line to itself, so every level after it starts on one.
+  size_t width = 1;
+  size_t number_of_nodes = FANOUT;
+  m_level_offsets.push_back(0);
+  while(width < size) {
+    width *= FANOUT;
+    m_level_offsets.push_back(number_of_nodes);
+    number_of_nodes += width;
+  }
+
+  const size_t line = FANOUT * sizeof(double);
+  m_storage.reset(new char[number_of_nodes * sizeof(double) + line]);
+  uintptr_t address = reinterpret_cast<uintptr_t>(m_storage.get());
+  address = (address + line - 1) & ~static_cast<uintptr_t>(line - 1);
+  m_nodes = reinterpret_cast<double*>(address);
+  m_number_of_nodes = number_of_nodes;
+  clear();
+}
+
+void SumTree::set(size_t leaf, double weight)
+{
+  assert(leaf < m_size);
+  assert(weight >= 0);
+  size_t node = leaf;
+  m_nodes[m_level_offsets.back() + node] = weight;
+  for(size_t level = m_level_offsets.size() - 1; level > 0; level--) {
+    node /= FANOUT;
+    const double* children = &m_nodes[m_level_offsets[level] + node * FANOUT];
+    double sum = 0;
+    for(int i = 0; i < FANOUT; i++) sum += children[i];
+    m_nodes[m_level_offsets[level - 1] + node] = sum;
+  }
+}
+
+size_t SumTree::find(double target) const
+{
+  size_t leaf = 0;
+  find_sorted(&target, 1, &leaf);
+  return leaf;
+}
+
+void SumTree::find_sorted(const double* targets, int n, size_t* leaves) const
+{
+  // Walk every target down a level before going on to the next, so each
+  // level is read in one sweep. leaves holds each target's node on the
+  // current level, and remaining what is left of the target within it.
+  std::vector<double> remaining(targets, targets + n);
+  for(int j = 0; j < n; j++) leaves[j] = 0;
+
+  for(size_t level = 1; level < m_level_offsets.size(); level++) {
+    const double* weights = &m_nodes[m_level_offsets[level]];
+    for(int j = 0; j < n; j++) {
+      size_t first = leaves[j] * FANOUT;
+      size_t chosen = first + FANOUT;
+      size_t last_weighted = first;
+      for(int i = 0; i < FANOUT; i++) {
+        size_t child = first + i;
+        double weight = weights[child];
+        if(weight <= 0) continue;
+        last_weighted = child;
+        if(remaining[j] < weight) {
+          chosen = child;
+          break;
+        }
+        remaining[j] -= weight;
+      }
+      // Rounding can leave a target just past the last child with weight.
+      if(chosen == first + FANOUT) chosen = last_weighted;
+      leaves[j] = chosen;
+    }
+  }
+}
+
+void SumTree::clear()
+{
+  for(size_t i = 0; i < m_number_of_nodes; i++) m_nodes[i] = 0;
+}
+
+} // namespace learning
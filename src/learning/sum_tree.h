@@ -0,0 +1,58 @@
+#ifndef DEEPSHEEP_LEARNING_SUMTREE_H_
+#define DEEPSHEEP_LEARNING_SUMTREE_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace learning {
+
+/// Non-negative weights over a fixed number of leaves, for sampling in proportion to them.
+
+/** Each inner node holds the sum of FANOUT children, and the FANOUT
+ *  children of a node are adjacent and fill one cache line, so an update or
+ *  a search touches one line per level. Levels are stored root first. A
+ *  parent is recomputed from its children rather than adjusted by the
+ *  change, so rounding doesn't build up however many updates are made.
+ */
+class SumTree
+{
+public:
+  static const int FANOUT = 8;
+
+  //! Construct a tree with at least size leaves, all zero.
+  explicit SumTree(size_t size);
+
+  //! The number of leaves that can be weighted.
+  size_t size() const { return m_size; }
+
+  double total() const { return m_nodes[0]; }
+  double get(size_t leaf) const { return m_nodes[m_level_offsets.back() + leaf]; }
+
+  //! Set the weight of a leaf, in O(log n).
+  void set(size_t leaf, double weight);
+
+  //! The leaf where the running sum of weights, in leaf order, passes target.
+
+  //! target should be in [0, total()). Leaves with zero weight are never returned.
+  size_t find(double target) const;
+
+  //! find() for n targets in increasing order, descending the levels once for all of them.
+  void find_sorted(const double* targets, int n, size_t* leaves) const;
+
+  //! Set every leaf to zero.
+  void clear();
+
+private:
+  size_t m_size;
+  std::unique_ptr<char[]> m_storage;
+  double* m_nodes;
+  size_t m_number_of_nodes;
+  //! Where each level starts in m_nodes, root first. Every level starts on
+  //! a cache line.
+  std::vector<size_t> m_level_offsets;
+
+}; // class SumTree
+
+} // namespace learning
+#endif
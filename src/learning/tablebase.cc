@@ -0,0 +1,332 @@
+#include "tablebase.h"
+
+#include "learning/double_dummy_solver.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace learning {
+
+namespace {
+
+const char MAGIC[8] = {'D', 'S', 'T', 'B', 'A', 'S', 'E', '2'};
+
+struct TablebaseHeader
+{
+  char magic[8];
+  uint32_t number_of_players;
+  uint32_t trump_is_clubs;
+  uint32_t max_tricks;
+  uint32_t reserved;
+  uint64_t counts[Tablebase::MAX_TRICKS + 1];
+};
+
+// The number of ways to deal total cards with counts[seat] to each seat.
+uint64_t multinomial(int total, const int* counts, int number_of_seats)
+{
+  uint64_t ways = 1;
+  for(int seat = 0; seat < number_of_seats; seat++) {
+    ways *= binomial(total, counts[seat]);
+    total -= counts[seat];
+  }
+  return ways;
+}
+
+int tricks_remaining(const TrickPosition& position)
+{
+  return position.number_of_tricks() - position.number_of_finished_tricks();
+}
+
+// Visit every line of play from a position, adding each trick-start position.
+void add_late_positions(TrickPosition* position, DoubleDummySolver* solver,
+                        TablebaseBuilder* builder)
+{
+  if(position->is_finished()) return;
+  if(position->trick_size() == 0 && !builder->contains(*position) &&
+     Tablebase::indexable(*position, builder->max_tricks())) {
+    int banked = position->picking_team_points();
+    builder->add(*position, solver->search(position, -1, 121) - banked);
+  }
+  for(CardMask moves = position->legal_moves(); moves; moves &= moves - 1) {
+    position->make_move(mask_first(moves));
+    add_late_positions(position, solver, builder);
+    position->unmake_move();
+  }
+}
+
+// The index of a position with its held cards relabeled by a permutation.
+uint64_t permuted_index(const TrickPosition& position, const SuitPermutation& permutation)
+{
+  int number_of_players = position.number_of_players();
+  int tricks = tricks_remaining(position);
+  int seat_of_card[NUMBER_OF_CARDS];
+  CardMask held = 0;
+  int team_mask = 0;
+  for(int relative = 0; relative < number_of_players; relative++) {
+    int seat = (position.leader() + relative) % number_of_players;
+    CardMask seat_cards = permutation.mask(position.held_cards(seat));
+    assert(mask_size(seat_cards) == tricks);
+    held |= seat_cards;
+    for(CardMask cards = seat_cards; cards; cards &= cards - 1) {
+      seat_of_card[mask_first(cards)] = relative;
+    }
+    if(position.on_picking_team(seat)) team_mask |= 1 << relative;
+  }
+
+  // Rank the set of held cards in the combinatorial number system, and the
+  // way they are dealt among the seats as a multiset permutation.
+  int counts[TrickPosition::MAX_PLAYERS];
+  for(int relative = 0; relative < number_of_players; relative++) counts[relative] = tricks;
+  int left = tricks * number_of_players;
+  uint64_t deal_count = multinomial(left, counts, number_of_players);
+
+  uint64_t set_rank = 0;
+  uint64_t deal_rank = 0;
+  int i = 0;
+  for(CardMask cards = held; cards; cards &= cards - 1) {
+    int card = mask_first(cards);
+    set_rank += binomial(card, ++i);
+
+    int relative = seat_of_card[card];
+    for(int lower = 0; lower < relative; lower++) {
+      if(counts[lower] == 0) continue;
+      counts[lower]--;
+      deal_rank += multinomial(left - 1, counts, number_of_players);
+      counts[lower]++;
+    }
+    counts[relative]--;
+    left--;
+  }
+
+  return (set_rank * deal_count + deal_rank) * (1 << TrickPosition::MAX_PLAYERS) + team_mask;
+}
+
+} // namespace
+
+Tablebase::Tablebase()
+  : m_mapping(nullptr), m_mapping_size(0), m_number_of_players(0),
+    m_trump_is_clubs(false), m_max_tricks(0)
+{
+  for(int tricks = 0; tricks <= MAX_TRICKS; tricks++) {
+    m_keys[tricks] = nullptr;
+    m_values[tricks] = nullptr;
+    m_counts[tricks] = 0;
+  }
+}
+
+Tablebase::Tablebase(const std::string& path)
+  : Tablebase()
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if(fd < 0) return;
+
+  struct stat file_stat;
+  if(fstat(fd, &file_stat) != 0 ||
+     static_cast<size_t>(file_stat.st_size) < sizeof(TablebaseHeader)) {
+    close(fd);
+    return;
+  }
+  size_t size = file_stat.st_size;
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(mapping == MAP_FAILED) return;
+
+  const TablebaseHeader* header = static_cast<const TablebaseHeader*>(mapping);
+  uint64_t total = 0;
+  for(int tricks = 1; tricks <= MAX_TRICKS; tricks++) total += header->counts[tricks];
+  if(memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+     header->max_tricks > MAX_TRICKS ||
+     sizeof(TablebaseHeader) + total * (sizeof(uint64_t) + 1) != size) {
+    munmap(mapping, size);
+    return;
+  }
+
+  m_mapping = mapping;
+  m_mapping_size = size;
+  m_number_of_players = header->number_of_players;
+  m_trump_is_clubs = header->trump_is_clubs;
+  m_max_tricks = header->max_tricks;
+
+  const char* data = static_cast<const char*>(mapping) + sizeof(TablebaseHeader);
+  const uint64_t* keys = reinterpret_cast<const uint64_t*>(data);
+  const uint8_t* values = reinterpret_cast<const uint8_t*>(keys + total);
+  for(int tricks = 1; tricks <= MAX_TRICKS; tricks++) {
+    m_counts[tricks] = header->counts[tricks];
+    m_keys[tricks] = keys;
+    m_values[tricks] = values;
+    keys += m_counts[tricks];
+    values += m_counts[tricks];
+  }
+}
+
+Tablebase::~Tablebase()
+{
+  if(m_mapping) munmap(m_mapping, m_mapping_size);
+}
+
+size_t Tablebase::size() const
+{
+  size_t total = 0;
+  for(int tricks = 1; tricks <= MAX_TRICKS; tricks++) total += m_counts[tricks];
+  return total;
+}
+
+bool Tablebase::indexable(const TrickPosition& position, int max_tricks)
+{
+  if(position.is_leasters() || position.trick_size() != 0 || position.is_finished()) {
+    return false;
+  }
+  if(tricks_remaining(position) > max_tricks) return false;
+
+  CardMask held = 0;
+  for(int seat = 0; seat < position.number_of_players(); seat++) {
+    held |= position.held_cards(seat);
+  }
+  if(position.partner_card() != NO_CARD && (held & card_bit(position.partner_card()))) {
+    return false;
+  }
+  if(position.unknown_card() != NO_CARD && (held & card_bit(position.unknown_card()))) {
+    return false;
+  }
+  return true;
+}
+
+uint64_t Tablebase::index(const TrickPosition& position)
+{
+  // The held cards are all that's left to play, so relabeling their fail
+  // suits gives the same outcome. Take the smallest index over relabelings.
+  uint64_t smallest = permuted_index(position, SuitPermutation());
+  for(int n = 1; n < SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+    auto permutation = SuitPermutation::fail_permutation(position.trump_is_clubs(), n);
+    smallest = std::min(smallest, permuted_index(position, permutation));
+  }
+  return smallest;
+}
+
+bool Tablebase::probe(const TrickPosition& position, int* points) const
+{
+  if(position.trick_size() != 0 || tricks_remaining(position) > m_max_tricks) return false;
+  if(position.number_of_players() != m_number_of_players ||
+     position.trump_is_clubs() != m_trump_is_clubs ||
+     !indexable(position, m_max_tricks)) {
+    return false;
+  }
+
+  int tricks = tricks_remaining(position);
+  uint64_t key = index(position);
+  const uint64_t* keys_end = m_keys[tricks] + m_counts[tricks];
+  const uint64_t* found = std::lower_bound(m_keys[tricks], keys_end, key);
+  if(found == keys_end || *found != key) return false;
+  *points = m_values[tricks][found - m_keys[tricks]];
+  return true;
+}
+
+TablebaseBuilder::TablebaseBuilder(int number_of_players, bool trump_is_clubs, int max_tricks)
+  : m_number_of_players(number_of_players), m_trump_is_clubs(trump_is_clubs),
+    m_max_tricks(max_tricks)
+{
+  assert(max_tricks >= 1 && max_tricks <= Tablebase::MAX_TRICKS);
+}
+
+bool TablebaseBuilder::accepts(const TrickPosition& position) const
+{
+  return position.number_of_players() == m_number_of_players &&
+         position.trump_is_clubs() == m_trump_is_clubs &&
+         Tablebase::indexable(position, m_max_tricks);
+}
+
+bool TablebaseBuilder::add(const TrickPosition& position, int points)
+{
+  if(!accepts(position)) return false;
+  assert(points >= 0 && points <= 120);
+  m_values[tricks_remaining(position)][Tablebase::index(position)] = points;
+  return true;
+}
+
+bool TablebaseBuilder::contains(const TrickPosition& position) const
+{
+  if(!accepts(position)) return false;
+  return m_values[tricks_remaining(position)].count(Tablebase::index(position)) > 0;
+}
+
+size_t TablebaseBuilder::size() const
+{
+  size_t total = 0;
+  for(auto& values : m_values) total += values.size();
+  return total;
+}
+
+bool TablebaseBuilder::write(const std::string& path) const
+{
+  TablebaseHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.number_of_players = m_number_of_players;
+  header.trump_is_clubs = m_trump_is_clubs;
+  header.max_tricks = m_max_tricks;
+
+  std::vector<std::vector<std::pair<uint64_t, uint8_t>>> sections(Tablebase::MAX_TRICKS + 1);
+  for(int tricks = 1; tricks <= Tablebase::MAX_TRICKS; tricks++) {
+    sections[tricks].assign(m_values[tricks].begin(), m_values[tricks].end());
+    std::sort(sections[tricks].begin(), sections[tricks].end());
+    header.counts[tricks] = sections[tricks].size();
+  }
+
+  std::ofstream out(path, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  for(int tricks = 1; tricks <= Tablebase::MAX_TRICKS; tricks++) {
+    for(auto& entry : sections[tricks]) {
+      out.write(reinterpret_cast<const char*>(&entry.first), sizeof(entry.first));
+    }
+  }
+  for(int tricks = 1; tricks <= Tablebase::MAX_TRICKS; tricks++) {
+    for(auto& entry : sections[tricks]) {
+      out.write(reinterpret_cast<const char*>(&entry.second), sizeof(entry.second));
+    }
+  }
+  return static_cast<bool>(out);
+}
+
+void generate_tablebase(const sheepshead::interface::Rules& rules, int number_of_deals,
+                        unsigned long seed, TablebaseBuilder* builder)
+{
+  std::default_random_engine generator(seed);
+  TranspositionTable table(16);
+  DoubleDummySolver solver(&table);
+
+  for(int deal = 0; deal < number_of_deals; deal++) {
+    auto hand = sheepshead::interface::Hand(rules, seed + deal);
+    while(!hand.history().picking_round().is_finished()) {
+      if(hand.is_arbitrable()) {
+        hand.arbiter().arbitrate();
+        continue;
+      }
+      auto current_player = hand.current_player();
+      auto available_plays = hand.available_plays(current_player);
+      std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+      hand.playmaker(current_player).make_play(available_plays[distribution(generator)]);
+    }
+
+    auto position = TrickPosition(hand);
+    if(position.is_leasters()) continue;
+    while(tricks_remaining(position) > builder->max_tricks() || position.trick_size() != 0) {
+      CardMask moves = position.legal_moves();
+      std::uniform_int_distribution<int> distribution(0, mask_size(moves) - 1);
+      position.make_move(mask_nth(moves, distribution(generator)));
+    }
+
+    table.new_search();
+    add_late_positions(&position, &solver, builder);
+  }
+}
+
+} // namespace learning
@@ -0,0 +1,121 @@
+#ifndef DEEPSHEEP_LEARNING_TABLEBASE_H_
+#define DEEPSHEEP_LEARNING_TABLEBASE_H_
+
+#include "learning/trick_position.h"
+#include "sheepshead/interface/rules.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace learning {
+
+/// Solved outcomes of the last few tricks of hands, read from a file.
+
+/** A tablebase holds, for one number of players and trump suit, the points
+ *  the picking team wins from the cards still in hand with best play, for
+ *  positions at the start of one of the last max_tricks() tricks.
+ *
+ *  Positions are keyed by a canonical index built from the set of cards
+ *  still held, which seat relative to the leader holds each, and which
+ *  relative seats are on the picking team, taking the smallest over the
+ *  relabelings of the fail suits. Positions whose outcome depends
+ *  on more than that can't be indexed: those where the partner card or the
+ *  unknown card is still held, since they change which cards may be played.
+ *
+ *  The file is a header, then the sorted indices for each number of tricks
+ *  remaining, then their values, one byte each. It is memory mapped and
+ *  probed with a binary search, so opening it costs nothing and processes
+ *  using the same file share its pages.
+ */
+class Tablebase
+{
+public:
+  static const int MAX_TRICKS = 3;
+
+  //! Construct an empty tablebase that finds nothing.
+  Tablebase();
+
+  //! Map a tablebase file. Check is_open() for success.
+  explicit Tablebase(const std::string& path);
+
+  ~Tablebase();
+
+  Tablebase(const Tablebase&) = delete;
+  Tablebase& operator=(const Tablebase&) = delete;
+
+  bool is_open() const { return m_mapping != nullptr; }
+  int number_of_players() const { return m_number_of_players; }
+  bool trump_is_clubs() const { return m_trump_is_clubs; }
+  int max_tricks() const { return m_max_tricks; }
+  //! The number of positions stored.
+  size_t size() const;
+
+  //! Whether a position can be stored in a tablebase covering max_tricks tricks.
+  static bool indexable(const TrickPosition& position, int max_tricks);
+
+  //! The canonical index of an indexable position.
+
+  //! Positions that differ only in which absolute seat leads, or by a
+  //! relabeling of the fail suits, get the same index.
+  static uint64_t index(const TrickPosition& position);
+
+  //! Find the points the picking team wins from the cards still in hand.
+  //! Returns false if the position isn't in the tablebase.
+  bool probe(const TrickPosition& position, int* points) const;
+
+private:
+  void* m_mapping;
+  size_t m_mapping_size;
+  int m_number_of_players;
+  bool m_trump_is_clubs;
+  int m_max_tricks;
+  const uint64_t* m_keys[MAX_TRICKS + 1];
+  const uint8_t* m_values[MAX_TRICKS + 1];
+  uint64_t m_counts[MAX_TRICKS + 1];
+
+}; // class Tablebase
+
+/// Collects solved positions and writes them as a Tablebase file.
+class TablebaseBuilder
+{
+public:
+  TablebaseBuilder(int number_of_players, bool trump_is_clubs, int max_tricks);
+
+  //! Add a position's value, the points the picking team wins from the cards
+  //! still in hand. Returns false if the position can't go in this tablebase.
+  bool add(const TrickPosition& position, int points);
+
+  bool contains(const TrickPosition& position) const;
+
+  //! The number of positions added.
+  size_t size() const;
+  int max_tricks() const { return m_max_tricks; }
+
+  //! Write the file. Returns false on failure.
+  bool write(const std::string& path) const;
+
+private:
+  bool accepts(const TrickPosition& position) const;
+
+  int m_number_of_players;
+  bool m_trump_is_clubs;
+  int m_max_tricks;
+  std::unordered_map<uint64_t, uint8_t> m_values[Tablebase::MAX_TRICKS + 1];
+
+}; // class TablebaseBuilder
+
+/// Solve every indexable late position reachable in sampled deals.
+
+//! Each deal has a random picking round and random early tricks, then every
+//! line of play through the last max_tricks tricks is followed and each
+//! position at the start of a trick is solved and added to the builder.
+//! Enumerating every possible late position isn't practical: with five
+//! players there are C(32, 15) sets of fifteen cards left for the last three
+//! tricks, before dividing them among the seats.
+void generate_tablebase(const sheepshead::interface::Rules& rules, int number_of_deals,
+                        unsigned long seed, TablebaseBuilder* builder);
+
+} // namespace learning
+#endif
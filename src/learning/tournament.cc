@@ -0,0 +1,259 @@
+#include "tournament.h"
+
+#include "learning/card_mask.h"
+#include "learning/trick_position.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+using sheepshead::interface::Hand;
+
+namespace learning {
+
+namespace {
+
+// Reward sums and counts for each competitor and role, from one deal or group.
+struct DealTotals
+{
+  std::vector<double> sums;
+  std::vector<long long> counts;
+};
+
+BootstrapEstimate percentile_interval(double mean, long long hands, std::vector<double>* samples)
+{
+  BootstrapEstimate estimate;
+  estimate.mean = mean;
+  estimate.hands = hands;
+  if(samples->empty()) return estimate;
+  std::sort(samples->begin(), samples->end());
+  estimate.lower = (*samples)[static_cast<size_t>(0.025 * (samples->size() - 1))];
+  estimate.upper = (*samples)[static_cast<size_t>(0.975 * (samples->size() - 1))];
+  return estimate;
+}
+
+} // namespace
+
+const char* seat_role_name(SeatRole role)
+{
+  switch(role) {
+    case SeatRole::PICKER: return "picker";
+    case SeatRole::PARTNER: return "partner";
+    case SeatRole::DEFENDER: return "defender";
+    case SeatRole::LEASTERS: return "leasters";
+  }
+  return "unknown";
+}
+
+TournamentConfig::TournamentConfig()
+  : deals(1000), number_of_threads(std::max(1u, std::thread::hardware_concurrency())),
+    bootstrap_samples(1000), seed(0), deal_scheme(DealScheme::INDEPENDENT)
+{}
+
+BootstrapEstimate::BootstrapEstimate()
+  : mean(0), lower(0), upper(0), hands(0)
+{}
+
+void play_seated(const std::vector<const Policy*>& seat_policies, Hand* hand,
+                 std::default_random_engine& generator, std::vector<int>* rewards,
+                 std::vector<SeatRole>* roles)
+{
+  int number_of_players = hand->rules().number_of_players();
+  assert(static_cast<int>(seat_policies.size()) == number_of_players);
+  while(!hand->is_finished() && !hand->history().picking_round().is_finished()) {
+    if(hand->is_arbitrable()) {
+      hand->arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand->current_player();
+    auto play = seat_policies[seat_index(*hand, player)]->choose_play(*hand, generator);
+    bool made = hand->playmaker(player).make_play(play);
+    assert(made);
+    (void)made;
+  }
+
+  if(rewards) rewards->assign(number_of_players, 0);
+  if(roles) roles->assign(number_of_players, SeatRole::LEASTERS);
+  // A doubler hand ends without tricks.
+  if(hand->is_finished()) {
+    for(int seat = 0; rewards && seat < number_of_players; seat++) {
+      (*rewards)[seat] = hand->reward(player_at_seat(*hand, seat));
+    }
+    return;
+  }
+
+  TrickPosition position(*hand);
+  while(!position.is_finished()) {
+    position.make_move(seat_policies[position.to_play()]->choose_card(position, generator));
+  }
+  for(int seat = 0; seat < number_of_players; seat++) {
+    if(rewards) (*rewards)[seat] = position.reward(seat);
+    if(roles && !position.is_leasters()) {
+      (*roles)[seat] = seat == position.picker() ? SeatRole::PICKER :
+                       seat == position.partner() ? SeatRole::PARTNER : SeatRole::DEFENDER;
+    }
+  }
+}
+
+TournamentResult run_tournament(const sheepshead::interface::Rules& rules,
+                                const std::vector<const Policy*>& competitors,
+                                const TournamentConfig& config)
+{
+  assert(!competitors.empty());
+  assert(config.deals > 0 && config.number_of_threads > 0 && config.bootstrap_samples > 0);
+  int number_of_competitors = competitors.size();
+  int number_of_players = rules.number_of_players();
+
+  unsigned long seed = config.seed;
+  if(seed == 0) {
+    seed = std::chrono::system_clock::now().time_since_epoch().count();
+  }
+
+  // Every rotation of the starting seating, under every relabeling.
+  std::vector<std::vector<int>> seatings;
+  for(int relabeling = 0; relabeling < number_of_competitors; relabeling++) {
+    for(int rotation = 0; rotation < number_of_players; rotation++) {
+      std::vector<int> seating(number_of_players);
+      for(int seat = 0; seat < number_of_players; seat++) {
+        seating[seat] = ((seat + rotation) % number_of_players % number_of_competitors +
+                         relabeling) % number_of_competitors;
+      }
+      seatings.push_back(seating);
+    }
+  }
+
+  DealStream deals(rules, seed, config.deal_scheme);
+  int cells = number_of_competitors * NUMBER_OF_SEAT_ROLES;
+  std::vector<DealTotals> totals(config.deals);
+  std::atomic<int> next_deal(0);
+  auto worker = [&]() {
+    std::vector<int> rewards;
+    std::vector<SeatRole> roles;
+    std::vector<const Policy*> seat_policies(number_of_players);
+    for(int deal = next_deal++; deal < config.deals; deal = next_deal++) {
+      Deck deck = deals.deck(deal);
+      // Every seating of the deal draws the same random numbers.
+      unsigned long play_seed = deals.play_seed(deal);
+
+      DealTotals& deal_totals = totals[deal];
+      deal_totals.sums.assign(cells, 0);
+      deal_totals.counts.assign(cells, 0);
+      for(auto& seating : seatings) {
+        for(int seat = 0; seat < number_of_players; seat++) {
+          seat_policies[seat] = competitors[seating[seat]];
+        }
+        auto hand = Hand(rules, deck);
+        std::default_random_engine play_generator(play_seed);
+        play_seated(seat_policies, &hand, play_generator, &rewards, &roles);
+        for(int seat = 0; seat < number_of_players; seat++) {
+          int cell = seating[seat] * NUMBER_OF_SEAT_ROLES + static_cast<int>(roles[seat]);
+          deal_totals.sums[cell] += rewards[seat];
+          deal_totals.counts[cell]++;
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int i = 0; i < config.number_of_threads; i++) threads.emplace_back(worker);
+  for(auto& thread : threads) thread.join();
+
+  // Means of each competitor overall and by role, from sums over some deals.
+  auto means = [&](const std::vector<double>& sums, const std::vector<long long>& counts,
+                   std::vector<double>* overall, std::vector<double>* by_role) {
+    overall->assign(number_of_competitors, 0);
+    by_role->assign(cells, 0);
+    for(int competitor = 0; competitor < number_of_competitors; competitor++) {
+      double sum = 0;
+      long long count = 0;
+      for(int role = 0; role < NUMBER_OF_SEAT_ROLES; role++) {
+        int cell = competitor * NUMBER_OF_SEAT_ROLES + role;
+        if(counts[cell] > 0) (*by_role)[cell] = sums[cell] / counts[cell];
+        sum += sums[cell];
+        count += counts[cell];
+      }
+      if(count > 0) (*overall)[competitor] = sum / count;
+    }
+  };
+
+  // Merge the deals of each group the scheme ties together.
+  int number_of_groups = (config.deals + deals.group_size() - 1) / deals.group_size();
+  std::vector<DealTotals> group_totals(number_of_groups);
+  for(auto& group : group_totals) {
+    group.sums.assign(cells, 0);
+    group.counts.assign(cells, 0);
+  }
+  for(int deal = 0; deal < config.deals; deal++) {
+    DealTotals& group = group_totals[deal / deals.group_size()];
+    for(int cell = 0; cell < cells; cell++) {
+      group.sums[cell] += totals[deal].sums[cell];
+      group.counts[cell] += totals[deal].counts[cell];
+    }
+  }
+
+  std::vector<double> sums(cells, 0);
+  std::vector<long long> counts(cells, 0);
+  for(auto& group : group_totals) {
+    for(int cell = 0; cell < cells; cell++) {
+      sums[cell] += group.sums[cell];
+      counts[cell] += group.counts[cell];
+    }
+  }
+  std::vector<double> overall, by_role;
+  means(sums, counts, &overall, &by_role);
+
+  // Resample whole groups.
+  std::vector<std::vector<double>> overall_samples(number_of_competitors);
+  std::vector<std::vector<double>> role_samples(cells);
+  std::vector<std::vector<double>> versus_samples(number_of_competitors);
+  // The deal stream numbers its seeds from the same base, so resampling
+  // takes one outside its numbering.
+  std::default_random_engine generator(mix_seed(seed, ~0UL));
+  std::uniform_int_distribution<int> pick_group(0, number_of_groups - 1);
+  std::vector<double> sample_overall, sample_by_role;
+  for(int sample = 0; sample < config.bootstrap_samples; sample++) {
+    std::vector<double> sample_sums(cells, 0);
+    std::vector<long long> sample_counts(cells, 0);
+    for(int i = 0; i < number_of_groups; i++) {
+      const DealTotals& group = group_totals[pick_group(generator)];
+      for(int cell = 0; cell < cells; cell++) {
+        sample_sums[cell] += group.sums[cell];
+        sample_counts[cell] += group.counts[cell];
+      }
+    }
+    means(sample_sums, sample_counts, &sample_overall, &sample_by_role);
+    for(int competitor = 0; competitor < number_of_competitors; competitor++) {
+      overall_samples[competitor].push_back(sample_overall[competitor]);
+      versus_samples[competitor].push_back(sample_overall[competitor] - sample_overall[0]);
+      for(int role = 0; role < NUMBER_OF_SEAT_ROLES; role++) {
+        int cell = competitor * NUMBER_OF_SEAT_ROLES + role;
+        if(sample_counts[cell] > 0) role_samples[cell].push_back(sample_by_role[cell]);
+      }
+    }
+  }
+
+  TournamentResult result;
+  result.deals = config.deals;
+  result.hands = static_cast<long long>(config.deals) * seatings.size();
+  result.competitors.resize(number_of_competitors);
+  for(int competitor = 0; competitor < number_of_competitors; competitor++) {
+    CompetitorResult& competitor_result = result.competitors[competitor];
+    long long hands = 0;
+    for(int role = 0; role < NUMBER_OF_SEAT_ROLES; role++) {
+      int cell = competitor * NUMBER_OF_SEAT_ROLES + role;
+      competitor_result.roles[role] = percentile_interval(by_role[cell], counts[cell],
+                                                          &role_samples[cell]);
+      hands += counts[cell];
+    }
+    competitor_result.overall = percentile_interval(overall[competitor], hands,
+                                                    &overall_samples[competitor]);
+    competitor_result.versus_first = percentile_interval(overall[competitor] - overall[0], hands,
+                                                         &versus_samples[competitor]);
+  }
+  return result;
+}
+
+} // namespace learning
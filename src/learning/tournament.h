@@ -0,0 +1,109 @@
+#ifndef DEEPSHEEP_LEARNING_TOURNAMENT_H_
+#define DEEPSHEEP_LEARNING_TOURNAMENT_H_
+
+#include "learning/deal_stream.h"
+#include "learning/policy.h"
+#include "sheepshead/interface/hand.h"
+#include "sheepshead/interface/rules.h"
+
+#include <random>
+#include <vector>
+
+namespace learning {
+
+/// The part a seat played in a finished hand.
+enum class SeatRole
+{
+  PICKER = 0,
+  //! On the picker's team without picking.
+  PARTNER = 1,
+  DEFENDER = 2,
+  //! Any hand nobody picked.
+  LEASTERS = 3
+};
+
+const int NUMBER_OF_SEAT_ROLES = 4;
+
+/// A short name for a role, such as "picker".
+const char* seat_role_name(SeatRole role);
+
+/// Options for a duplicate tournament.
+struct TournamentConfig
+{
+  TournamentConfig();
+
+  //! Deals to play, each in every seating.
+  int deals;
+  //! The number of threads to play deals on.
+  int number_of_threads;
+  //! Resamples of the deals for the confidence intervals.
+  int bootstrap_samples;
+  //! Seed for dealing, the policies and resampling. Zero means seed from the clock.
+  unsigned long seed;
+  //! How the deals are dealt. Groups of deals the scheme ties together are
+  //! resampled together.
+  DealScheme deal_scheme;
+};
+
+/// A mean reward per hand and its 95% bootstrap confidence interval.
+struct BootstrapEstimate
+{
+  BootstrapEstimate();
+
+  double mean;
+  double lower;
+  double upper;
+  //! The number of seat-hands the mean is over.
+  long long hands;
+};
+
+/// How one competitor did in a tournament.
+struct CompetitorResult
+{
+  //! Over every seat it held.
+  BootstrapEstimate overall;
+  //! Over the seats it held in each SeatRole.
+  BootstrapEstimate roles[NUMBER_OF_SEAT_ROLES];
+  //! Its overall mean minus the first competitor's, from the same deals.
+  BootstrapEstimate versus_first;
+};
+
+struct TournamentResult
+{
+  std::vector<CompetitorResult> competitors;
+  int deals;
+  //! Hands played: deals times seatings.
+  long long hands;
+};
+
+/// Play a hand to the end with a policy for each seat.
+
+//! seat_policies has one policy per seat, counting from the dealer. The
+//! picking round is played on the Hand and the tricks on a TrickPosition.
+//! Each seat's reward and role are written to rewards and roles, which
+//! may be null.
+void play_seated(const std::vector<const Policy*>& seat_policies,
+                 sheepshead::interface::Hand* hand, std::default_random_engine& generator,
+                 std::vector<int>* rewards, std::vector<SeatRole>* roles);
+
+/// Compare policies by playing each deal in every seating, duplicate style.
+
+/** Competitor c starts in every seat s with s % competitors == c, and each
+ *  deal is played once for every rotation of that seating around the
+ *  table and every relabeling of the competitors, so every competitor
+ *  holds every seat's cards equally often against the same company. All
+ *  plays of a deal draw the same random numbers. Comparing competitors on
+ *  identical cards takes the luck of the deal out of the difference, which
+ *  otherwise swamps it.
+ *
+ *  Deals come from a DealStream with config.deal_scheme. Confidence
+ *  intervals come from resampling whole groups of deals, which keeps the
+ *  plays of a deal, and the deals the scheme correlates, together.
+ *  Results don't depend on number_of_threads, only on seed.
+ */
+TournamentResult run_tournament(const sheepshead::interface::Rules& rules,
+                                const std::vector<const Policy*>& competitors,
+                                const TournamentConfig& config = TournamentConfig());
+
+} // namespace learning
+#endif
@@ -0,0 +1,92 @@
+#include "transposition_table.h"
+
+#include <cassert>
+
+namespace learning {
+
+static_assert(sizeof(TranspositionEntry) == 16, "TranspositionEntry should be 16 bytes");
+
+TranspositionTable::TranspositionTable(size_t megabytes)
+  : m_buckets(nullptr), m_bucket_mask(0), m_generation(0)
+{
+  size_t number_of_buckets = 1;
+  while(2 * number_of_buckets * sizeof(Bucket) <= megabytes << 20) {
+    number_of_buckets *= 2;
+  }
+
+  // Over-allocate so the buckets can start on a cache line boundary.
+  m_storage.reset(new char[number_of_buckets * sizeof(Bucket) + alignof(Bucket)]);
+  uintptr_t address = reinterpret_cast<uintptr_t>(m_storage.get());
+  address = (address + alignof(Bucket) - 1) & ~static_cast<uintptr_t>(alignof(Bucket) - 1);
+  m_buckets = reinterpret_cast<Bucket*>(address);
+  m_bucket_mask = number_of_buckets - 1;
+  clear();
+}
+
+bool TranspositionTable::probe(uint64_t key, TranspositionEntry* entry) const
+{
+  const Bucket& candidates = bucket(key);
+  for(int i = 0; i < ENTRIES_PER_BUCKET; i++) {
+    if(candidates.entries[i].key == key && candidates.entries[i].bound != Bound::NONE) {
+      *entry = candidates.entries[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+void TranspositionTable::store(uint64_t key, int value, Bound bound,
+                               int depth, int best_move)
+{
+  assert(depth >= 0 && depth < 256);
+  assert(value >= INT16_MIN && value <= INT16_MAX);
+
+  Bucket& candidates = bucket(key);
+  TranspositionEntry* replace = &candidates.entries[0];
+  for(int i = 0; i < ENTRIES_PER_BUCKET; i++) {
+    TranspositionEntry* entry = &candidates.entries[i];
+    if(entry->key == key || entry->bound == Bound::NONE) {
+      replace = entry;
+      break;
+    }
+    // Prefer entries from old searches, then the shallowest
+    bool entry_is_stale = entry->generation != m_generation;
+    bool replace_is_stale = replace->generation != m_generation;
+    if(entry_is_stale != replace_is_stale) {
+      if(entry_is_stale) replace = entry;
+    } else if(entry->depth < replace->depth) {
+      replace = entry;
+    }
+  }
+
+  // Don't overwrite a deeper result for the same position from this search
+  // with a shallower one.
+  if(replace->key == key && replace->bound != Bound::NONE &&
+     replace->generation == m_generation && replace->depth > depth) {
+    return;
+  }
+
+  replace->key = key;
+  replace->value = static_cast<int16_t>(value);
+  replace->bound = bound;
+  replace->best_move = static_cast<int8_t>(best_move);
+  replace->depth = static_cast<uint8_t>(depth);
+  replace->generation = m_generation;
+}
+
+void TranspositionTable::new_search()
+{
+  m_generation++;
+}
+
+void TranspositionTable::clear()
+{
+  for(size_t i = 0; i <= m_bucket_mask; i++) {
+    for(int j = 0; j < ENTRIES_PER_BUCKET; j++) {
+      m_buckets[i].entries[j] = TranspositionEntry();
+    }
+  }
+  m_generation = 0;
+}
+
+} // namespace learning
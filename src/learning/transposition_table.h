@@ -0,0 +1,82 @@
+#ifndef DEEPSHEEP_LEARNING_TRANSPOSITIONTABLE_H_
+#define DEEPSHEEP_LEARNING_TRANSPOSITIONTABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace learning {
+
+/// What a stored search value says about the true value of a position.
+enum class Bound : uint8_t
+{
+  NONE,
+  LOWER,   //!< The true value is at least the stored value.
+  UPPER,   //!< The true value is at most the stored value.
+  EXACT
+};
+
+/// One stored search result.
+struct TranspositionEntry
+{
+  uint64_t key;
+  int16_t value;
+  Bound bound;
+  //! The best move found, or -1.
+  int8_t best_move;
+  //! How much search is behind the value. Deeper entries are kept in preference.
+  uint8_t depth;
+  //! The search generation that stored the entry.
+  uint8_t generation;
+};
+
+/// A fixed-size table of search results keyed by position keys.
+
+/** Entries are grouped in buckets that each fill one 64-byte cache line, so
+ *  a probe touches a single line. When a bucket is full, a store replaces
+ *  an entry left by an earlier search if there is one, and otherwise the
+ *  entry with the least depth, so expensive results survive longest.
+ *
+ *  The table is meant for one thread at a time.
+ */
+class TranspositionTable
+{
+public:
+  static const int ENTRIES_PER_BUCKET = 4;
+
+  //! Construct a table using about megabytes of memory, rounded down to a
+  //! power of two number of buckets.
+  explicit TranspositionTable(size_t megabytes);
+
+  //! Find the entry for a key. Returns false if there is none.
+  bool probe(uint64_t key, TranspositionEntry* entry) const;
+
+  //! Store a search result.
+  void store(uint64_t key, int value, Bound bound, int depth, int best_move);
+
+  //! Start a new search. Entries from earlier searches are kept but may be replaced.
+  void new_search();
+
+  //! Remove every entry.
+  void clear();
+
+  //! The number of entries the table can hold.
+  size_t capacity() const { return (m_bucket_mask + 1) * ENTRIES_PER_BUCKET; }
+
+private:
+  struct alignas(64) Bucket
+  {
+    TranspositionEntry entries[ENTRIES_PER_BUCKET];
+  };
+
+  Bucket& bucket(uint64_t key) const { return m_buckets[key & m_bucket_mask]; }
+
+  std::unique_ptr<char[]> m_storage;
+  Bucket* m_buckets;
+  size_t m_bucket_mask;
+  uint8_t m_generation;
+
+}; // class TranspositionTable
+
+} // namespace learning
+#endif
@@ -0,0 +1,582 @@
+#include "trick_position.h"
+
+#include <algorithm>
+#include <cassert>
+#include <sstream>
+
+namespace learning {
+
+using sheepshead::interface::Card;
+using sheepshead::interface::Hand;
+using sheepshead::interface::PlayerId;
+
+namespace {
+
+// Random numbers for the Zobrist keys, the same in every run.
+struct ZobristTable
+{
+  ZobristTable()
+  {
+    uint64_t state = 0x5eed5eedULL;
+    auto next = [&state]() {
+      // splitmix64
+      uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      return z ^ (z >> 31);
+    };
+    for(auto& seat_keys : held) for(auto& key : seat_keys) key = next();
+    for(auto& offset_keys : trick) for(auto& key : offset_keys) key = next();
+    for(auto& key : leader) key = next();
+    for(auto& team_keys : points) for(auto& key : team_keys) key = next();
+    for(auto& key : took_trick) key = next();
+    partner_revealed = next();
+    for(auto& key : picker) key = next();
+    for(auto& key : special_card) key = next();
+    trump_is_clubs = next();
+  }
+
+  uint64_t held[TrickPosition::MAX_PLAYERS][NUMBER_OF_CARDS];
+  uint64_t trick[TrickPosition::MAX_PLAYERS][NUMBER_OF_CARDS];
+  uint64_t leader[TrickPosition::MAX_PLAYERS];
+  uint64_t points[2][121];
+  uint64_t took_trick[2];
+  uint64_t partner_revealed;
+  uint64_t picker[TrickPosition::MAX_PLAYERS];
+  uint64_t special_card[NUMBER_OF_CARDS];
+  uint64_t trump_is_clubs;
+};
+
+const ZobristTable ZOBRIST;
+
+} // namespace
+
+int seat_index(const Hand& hand, const PlayerId& player)
+{
+  auto player_itr = hand.dealer();
+  for(int seat = 0; seat < hand.rules().number_of_players(); ++seat) {
+    if(*player_itr == player) return seat;
+    ++player_itr;
+  }
+  return -1;
+}
+
+PlayerId player_at_seat(const Hand& hand, int seat)
+{
+  return *std::next(hand.dealer(), seat);
+}
+
+TrickPosition::TrickPosition()
+  : m_number_of_players(0), m_number_of_tricks(0), m_trump_is_clubs(false),
+    m_picker(-1), m_partner(-1), m_partner_card(NO_CARD),
+    m_unknown_card(NO_CARD), m_partner_rules(false), m_partner_revealed(false),
+    m_played(0), m_discarded(0), m_leader(0), m_trick_size(0),
+    m_finished_tricks(0), m_cards_key(0), m_score_key(0), m_ply(0)
+{
+  for(int seat = 0; seat < MAX_PLAYERS; seat++) {
+    m_held[seat] = 0;
+    m_trick_cards[seat] = NO_CARD;
+    m_seat_points[seat] = 0;
+    m_seat_tricks[seat] = 0;
+  }
+  m_team_points[0] = m_team_points[1] = 0;
+  m_team_tricks[0] = m_team_tricks[1] = 0;
+  initialize_card_tables();
+}
+
+TrickPosition::TrickPosition(const Hand& hand)
+  : TrickPosition()
+{
+  auto rules = hand.rules();
+  auto history = hand.history();
+  auto picking_round = history.picking_round();
+  assert(picking_round.is_finished());
+
+  m_number_of_players = rules.number_of_players();
+  m_number_of_tricks = rules.number_of_cards_per_player();
+  m_trump_is_clubs = rules.trump_is_clubs();
+
+  if(!picking_round.picker()->is_null()) {
+    m_picker = seat_index(hand, *picking_round.picker());
+  }
+
+  auto partner_card = picking_round.partner_card();
+  if(!partner_card.is_null()) {
+    m_partner_card = card_index(partner_card);
+    m_partner_rules = rules.partner_by_called_ace();
+  }
+
+  for(auto& card : picking_round.discarded_cards()) {
+    m_discarded |= card_bit(card_index(card));
+  }
+
+  for(int seat = 0; seat < m_number_of_players; seat++) {
+    auto held_seat = hand.seat(player_at_seat(hand, seat));
+    for(auto card_itr = held_seat.held_cards_begin();
+             card_itr != held_seat.held_cards_end();
+             ++card_itr) {
+      int card = card_index(*card_itr);
+      m_held[seat] |= card_bit(card);
+      if(card_itr->is_unknown()) m_unknown_card = card;
+    }
+  }
+
+  // Walk the tricks, banking the finished ones and keeping the unfinished one
+  // as the current trick.
+  m_leader = seat_index(hand, *picking_round.leader());
+  for(auto trick_itr = history.tricks_begin(); trick_itr != history.tricks_end(); ++trick_itr) {
+    int trick_leader = seat_index(hand, *trick_itr->leader());
+    int laid = 0;
+    for(auto card_itr = trick_itr->laid_cards_begin();
+             card_itr != trick_itr->laid_cards_end();
+             ++card_itr) {
+      int card = card_index(*card_itr);
+      int seat = (trick_leader + laid) % m_number_of_players;
+      m_played |= card_bit(card);
+      if(card_itr->is_unknown()) m_unknown_card = card;
+      if(card == m_partner_card) {
+        m_partner = seat;
+        m_partner_revealed = true;
+      }
+      m_trick_cards[laid++] = card;
+    }
+
+    if(trick_itr->is_finished()) {
+      int winner = seat_index(hand, trick_itr->winner());
+      m_seat_points[winner] += trick_itr->point_value(true);
+      m_seat_tricks[winner]++;
+      m_finished_tricks++;
+      m_leader = winner;
+      m_trick_size = 0;
+    } else {
+      m_leader = trick_leader;
+      m_trick_size = laid;
+    }
+  }
+
+  if(m_partner_card != NO_CARD && !m_partner_revealed) {
+    for(int seat = 0; seat < m_number_of_players; seat++) {
+      if(m_held[seat] & card_bit(m_partner_card)) m_partner = seat;
+    }
+  }
+
+  initialize_card_tables();
+  compute_team_totals();
+  compute_keys();
+}
+
+void TrickPosition::initialize_card_tables()
+{
+  // Strengths follow the trump and fail orders used to decide tricks:
+  // queens, then jacks, each by suit, then the trump suit from the ace down.
+  static const int TRUMP_RANK_STRENGTH[8] = {24, 20, 16, 32, 28, 12, 8, 4};
+  static const int QUEEN_JACK_SUIT_ORDER[4] = {1, 2, 4, 3};
+  static const int FAIL_RANK_STRENGTH[8] = {8, 7, 6, 0, 0, 5, 2, 1};
+
+  int trump_suit = static_cast<int>(m_trump_is_clubs ? Card::Suit::CLUBS
+                                                     : Card::Suit::DIAMONDS);
+  for(int suit = 0; suit <= TRUMP_SUIT; suit++) m_suit_masks[suit] = 0;
+
+  for(int card = 0; card < NUMBER_OF_CARDS; card++) {
+    int suit = card / 8;
+    auto rank = card_true_rank(card);
+    bool is_trump = rank == Card::Rank::QUEEN || rank == Card::Rank::JACK ||
+                    suit == trump_suit;
+
+    // The unknown card follows the partner suit and loses to everything in it.
+    if(card == m_unknown_card && m_partner_card != NO_CARD) {
+      m_suit[card] = m_partner_card / 8;
+      m_strength[card] = 0;
+    } else if(is_trump) {
+      m_suit[card] = TRUMP_SUIT;
+      m_strength[card] = TRUMP_RANK_STRENGTH[card % 8];
+      if(rank == Card::Rank::QUEEN || rank == Card::Rank::JACK) {
+        m_strength[card] += QUEEN_JACK_SUIT_ORDER[suit];
+      }
+    } else {
+      m_suit[card] = suit;
+      m_strength[card] = FAIL_RANK_STRENGTH[card % 8];
+    }
+    m_suit_masks[m_suit[card]] |= card_bit(card);
+  }
+
+  for(int suit = 0; suit <= TRUMP_SUIT; suit++) {
+    m_suit_sizes[suit] = 0;
+    for(CardMask cards = m_suit_masks[suit]; cards; cards &= cards - 1) {
+      m_suit_order[suit][m_suit_sizes[suit]++] = mask_first(cards);
+    }
+    std::sort(m_suit_order[suit], m_suit_order[suit] + m_suit_sizes[suit],
+              [this](int8_t lhs, int8_t rhs) { return m_strength[lhs] > m_strength[rhs]; });
+  }
+}
+
+void TrickPosition::compute_team_totals()
+{
+  m_team_points[0] = m_team_points[1] = 0;
+  m_team_tricks[0] = m_team_tricks[1] = 0;
+  for(int seat = 0; seat < m_number_of_players; seat++) {
+    int team = on_picking_team(seat) ? 0 : 1;
+    m_team_points[team] += m_seat_points[seat];
+    m_team_tricks[team] += m_seat_tricks[seat];
+  }
+}
+
+void TrickPosition::compute_keys()
+{
+  m_cards_key = ZOBRIST.leader[m_leader];
+  for(int seat = 0; seat < m_number_of_players; seat++) {
+    for(CardMask cards = m_held[seat]; cards; cards &= cards - 1) {
+      m_cards_key ^= ZOBRIST.held[seat][mask_first(cards)];
+    }
+  }
+  for(int offset = 0; offset < m_trick_size; offset++) {
+    m_cards_key ^= ZOBRIST.trick[offset][m_trick_cards[offset]];
+  }
+  if(m_partner_revealed) m_cards_key ^= ZOBRIST.partner_revealed;
+
+  // Fold in what stays fixed through the trick play, so one table can hold
+  // positions from different hands.
+  if(m_picker >= 0) m_cards_key ^= ZOBRIST.picker[m_picker];
+  if(m_partner_card != NO_CARD) m_cards_key ^= ZOBRIST.special_card[m_partner_card];
+  if(m_unknown_card != NO_CARD) m_cards_key ^= ~ZOBRIST.special_card[m_unknown_card];
+  if(m_trump_is_clubs) m_cards_key ^= ZOBRIST.trump_is_clubs;
+
+  m_score_key = 0;
+  for(int team = 0; team < 2; team++) {
+    m_score_key ^= ZOBRIST.points[team][m_team_points[team]];
+    if(m_team_tricks[team] > 0) m_score_key ^= ZOBRIST.took_trick[team];
+  }
+}
+
+int TrickPosition::discard_points() const
+{
+  return is_leasters() ? 0 : mask_point_value(m_discarded);
+}
+
+CardMask TrickPosition::legal_moves() const
+{
+  CardMask held = m_held[to_play()];
+  if(mask_size(held) <= 1) return held;
+
+  CardMask permitted = held;
+  bool leading = m_trick_size == 0;
+  int led_suit = leading ? -1 : m_suit[m_trick_cards[0]];
+
+  // Follow suit if we can
+  if(!leading) {
+    CardMask following = held & m_suit_masks[led_suit];
+    if(following) permitted = following;
+  }
+
+  if(!m_partner_rules) return permitted;
+
+  int partner_suit = m_suit[m_partner_card];
+  CardMask partner_bit = card_bit(m_partner_card);
+
+  // The picker cannot fail off the last partner suit card before the partner
+  // suit has been led
+  if(to_play() == m_picker && !leading) {
+    bool partner_card_already_played = m_played & partner_bit;
+    bool partner_suit_was_led = led_suit == partner_suit;
+    if(!partner_card_already_played && !partner_suit_was_led &&
+       mask_size(held & m_suit_masks[partner_suit]) < 2) {
+      permitted &= ~m_suit_masks[partner_suit];
+    }
+  }
+
+  // The partner must play the partner card when the partner suit is led, and
+  // can't lead any other partner suit card.
+  if(held & partner_bit) {
+    if(!leading) {
+      if(led_suit == partner_suit) permitted = partner_bit;
+    } else {
+      permitted &= ~(m_suit_masks[partner_suit] & ~partner_bit);
+    }
+  }
+  return permitted;
+}
+
+CardMask TrickPosition::distinct_moves(CardMask moves) const
+{
+  CardMask held = m_held[to_play()];
+  CardMask current_trick = 0;
+  for(int offset = 0; offset < m_trick_size; offset++) {
+    current_trick |= card_bit(m_trick_cards[offset]);
+  }
+  // Cards that can't come between two of the mover's cards in a trick
+  CardMask gone = held | m_discarded | (m_played & ~current_trick);
+  CardMask never_merged = 0;
+  if(m_partner_card != NO_CARD) never_merged |= card_bit(m_partner_card);
+  if(m_unknown_card != NO_CARD) never_merged |= card_bit(m_unknown_card);
+
+  CardMask distinct = 0;
+  for(int suit = 0; suit <= TRUMP_SUIT; suit++) {
+    if(!(moves & m_suit_masks[suit])) continue;
+
+    // Walk down the suit, starting a new class at each outstanding card and
+    // keeping the first move of each point value in a class.
+    unsigned class_point_values = 0;
+    for(int i = 0; i < m_suit_sizes[suit]; i++) {
+      int card = m_suit_order[suit][i];
+      CardMask bit = card_bit(card);
+      if(!(gone & bit) || (never_merged & bit)) {
+        class_point_values = 0;
+        if(moves & bit) distinct |= bit;
+        continue;
+      }
+      if(!(moves & bit)) continue;
+
+      unsigned point_value = 1u << card_point_value(card);
+      if(!(class_point_values & point_value)) {
+        class_point_values |= point_value;
+        distinct |= bit;
+      }
+    }
+  }
+  return distinct;
+}
+
+int TrickPosition::trick_winning_offset() const
+{
+  if(m_trick_size == 0) return 0;
+
+  int led_suit = m_suit[m_trick_cards[0]];
+  int winning_offset = 0;
+  int winning_score = -1;
+  for(int offset = 0; offset < m_trick_size; offset++) {
+    int score = trick_score(m_trick_cards[offset], led_suit);
+    if(score > winning_score) {
+      winning_score = score;
+      winning_offset = offset;
+    }
+  }
+  return winning_offset;
+}
+
+void TrickPosition::make_move(int card)
+{
+  int seat = to_play();
+  assert(m_held[seat] & card_bit(card));
+
+  UndoRecord& undo = m_undo[m_ply++];
+  undo.card = card;
+  undo.leader = m_leader;
+  undo.winner = -1;
+  undo.partner_revealed = m_partner_revealed;
+  undo.cards_key = m_cards_key;
+  undo.score_key = m_score_key;
+
+  m_cards_key ^= ZOBRIST.held[seat][card] ^ ZOBRIST.trick[m_trick_size][card];
+  m_held[seat] &= ~card_bit(card);
+  m_played |= card_bit(card);
+  m_trick_cards[m_trick_size++] = card;
+  if(card == m_partner_card && !m_partner_revealed) {
+    m_partner_revealed = true;
+    m_cards_key ^= ZOBRIST.partner_revealed;
+  }
+
+  if(m_trick_size < m_number_of_players) return;
+
+  int winner = (m_leader + trick_winning_offset()) % m_number_of_players;
+  int points = 0;
+  for(int offset = 0; offset < m_trick_size; offset++) {
+    points += card_point_value(m_trick_cards[offset]);
+    undo.trick_cards[offset] = m_trick_cards[offset];
+    m_cards_key ^= ZOBRIST.trick[offset][m_trick_cards[offset]];
+  }
+  undo.winner = winner;
+  undo.points = points;
+
+  int team = on_picking_team(winner) ? 0 : 1;
+  m_cards_key ^= ZOBRIST.leader[m_leader] ^ ZOBRIST.leader[winner];
+  m_score_key ^= ZOBRIST.points[team][m_team_points[team]] ^
+                 ZOBRIST.points[team][m_team_points[team] + points];
+  if(m_team_tricks[team] == 0) m_score_key ^= ZOBRIST.took_trick[team];
+  m_seat_points[winner] += points;
+  m_seat_tricks[winner]++;
+  m_team_points[team] += points;
+  m_team_tricks[team]++;
+  m_finished_tricks++;
+  m_leader = winner;
+  m_trick_size = 0;
+}
+
+void TrickPosition::unmake_move()
+{
+  assert(m_ply > 0);
+  const UndoRecord& undo = m_undo[--m_ply];
+
+  if(undo.winner >= 0) {
+    int team = on_picking_team(undo.winner) ? 0 : 1;
+    m_seat_points[undo.winner] -= undo.points;
+    m_seat_tricks[undo.winner]--;
+    m_team_points[team] -= undo.points;
+    m_team_tricks[team]--;
+    m_finished_tricks--;
+    m_leader = undo.leader;
+    m_trick_size = m_number_of_players;
+    for(int offset = 0; offset < m_trick_size; offset++) {
+      m_trick_cards[offset] = undo.trick_cards[offset];
+    }
+  }
+
+  m_trick_size--;
+  int seat = to_play();
+  m_held[seat] |= card_bit(undo.card);
+  m_played &= ~card_bit(undo.card);
+  m_partner_revealed = undo.partner_revealed;
+  m_cards_key = undo.cards_key;
+  m_score_key = undo.score_key;
+}
+
+int TrickPosition::reward(int seat) const
+{
+  if(!is_finished()) return 0;
+
+  // Leasters: the fewest points among players who took a trick wins
+  if(is_leasters()) {
+    int leasters_winner = -1;
+    for(int other = 0; other < m_number_of_players; other++) {
+      if(m_seat_tricks[other] == 0) continue;
+      if(leasters_winner < 0 || m_seat_points[other] < m_seat_points[leasters_winner]) {
+        leasters_winner = other;
+      }
+    }
+    return seat == leasters_winner ? m_number_of_players - 1 : -1;
+  }
+
+  return reward_for_band(seat, picking_team_band());
+}
+
+int TrickPosition::points_band(int picking_team_points)
+{
+  if(picking_team_points < 31) return -2;
+  if(picking_team_points < 61) return -1;
+  if(picking_team_points < 91) return 1;
+  return 2;
+}
+
+int TrickPosition::picking_team_band() const
+{
+  assert(is_finished() && !is_leasters());
+  if(m_team_tricks[1] == 0) return 3;
+  if(m_team_tricks[0] == 0) return -3;
+  return points_band(picking_team_points());
+}
+
+int TrickPosition::reward_for_band(int seat, int band) const
+{
+  if(seat == m_picker) {
+    if(m_partner < 0) {
+      return band * (m_number_of_players - 1);
+    } else {
+      return band * (m_number_of_players - 2) * 2 / 3;
+    }
+  } else if(seat == m_partner) {
+    return band * (m_number_of_players - 2) / 3;
+  }
+  return -1 * band;
+}
+
+void TrickPosition::redeal(const std::array<CardMask, MAX_PLAYERS>& held_cards,
+                           CardMask discarded_cards, int unknown_card)
+{
+  for(int seat = 0; seat < m_number_of_players; seat++) {
+    m_held[seat] = held_cards[seat];
+  }
+  m_discarded = discarded_cards;
+  m_unknown_card = unknown_card;
+
+  if(m_partner_card != NO_CARD && !m_partner_revealed) {
+    m_partner = -1;
+    for(int seat = 0; seat < m_number_of_players; seat++) {
+      if(m_held[seat] & card_bit(m_partner_card)) m_partner = seat;
+    }
+  }
+
+  initialize_card_tables();
+  compute_team_totals();
+  compute_keys();
+}
+
+void TrickPosition::permute_fail_suits(const SuitPermutation& permutation)
+{
+  // Take back the moves made, relabel the starting position, and replay the
+  // relabeled moves so the undo records and keys are rebuilt.
+  int moves[NUMBER_OF_CARDS];
+  int number_of_moves = m_ply;
+  for(int ply = 0; ply < number_of_moves; ply++) moves[ply] = m_undo[ply].card;
+  while(m_ply > 0) unmake_move();
+
+  for(int seat = 0; seat < m_number_of_players; seat++) {
+    m_held[seat] = permutation.mask(m_held[seat]);
+  }
+  m_played = permutation.mask(m_played);
+  m_discarded = permutation.mask(m_discarded);
+  for(int offset = 0; offset < m_trick_size; offset++) {
+    m_trick_cards[offset] = permutation.card(m_trick_cards[offset]);
+  }
+  m_partner_card = permutation.card(m_partner_card);
+  m_unknown_card = permutation.card(m_unknown_card);
+
+  initialize_card_tables();
+  compute_keys();
+  for(int ply = 0; ply < number_of_moves; ply++) make_move(permutation.card(moves[ply]));
+}
+
+SuitPermutation TrickPosition::canonical_permutation() const
+{
+  CardMask masks[2 * MAX_PLAYERS + 3];
+  int number_of_masks = 0;
+  for(int seat = 0; seat < m_number_of_players; seat++) masks[number_of_masks++] = m_held[seat];
+  for(int offset = 0; offset < m_trick_size; offset++) {
+    masks[number_of_masks++] = card_bit(m_trick_cards[offset]);
+  }
+  masks[number_of_masks++] = m_partner_card == NO_CARD ? 0 : card_bit(m_partner_card);
+  masks[number_of_masks++] = m_unknown_card == NO_CARD ? 0 : card_bit(m_unknown_card);
+  masks[number_of_masks++] = m_discarded;
+  return learning::canonical_permutation(masks, number_of_masks, m_trump_is_clubs);
+}
+
+SuitPermutation TrickPosition::canonical_permutation(int observer) const
+{
+  bool observer_picked = observer == m_picker;
+  CardMask masks[MAX_PLAYERS + 5];
+  int number_of_masks = 0;
+  masks[number_of_masks++] = m_held[observer];
+  masks[number_of_masks++] = m_played;
+  for(int offset = 0; offset < m_trick_size; offset++) {
+    masks[number_of_masks++] = card_bit(m_trick_cards[offset]);
+  }
+  masks[number_of_masks++] = m_partner_card == NO_CARD ? 0 : card_bit(m_partner_card);
+  masks[number_of_masks++] = observer_picked && m_unknown_card != NO_CARD ?
+                             card_bit(m_unknown_card) : 0;
+  masks[number_of_masks++] = observer_picked ? m_discarded : 0;
+  return learning::canonical_permutation(masks, number_of_masks, m_trump_is_clubs);
+}
+
+SuitPermutation TrickPosition::canonicalize()
+{
+  auto permutation = canonical_permutation();
+  if(!permutation.is_identity()) permute_fail_suits(permutation);
+  return permutation;
+}
+
+std::string TrickPosition::debug_string() const
+{
+  std::stringstream out_stream;
+  out_stream << "Picker " << m_picker << ", partner " << m_partner
+             << ", partner card " << card_debug_string(m_partner_card)
+             << ", unknown card " << card_debug_string(m_unknown_card) << std::endl;
+  for(int seat = 0; seat < m_number_of_players; seat++) {
+    out_stream << "Seat " << seat << " (" << m_seat_points[seat] << " points): "
+               << mask_debug_string(m_held[seat]) << std::endl;
+  }
+  out_stream << "Trick led by " << m_leader << ": ";
+  for(int offset = 0; offset < m_trick_size; offset++) {
+    out_stream << card_debug_string(m_trick_cards[offset]) << " ";
+  }
+  return out_stream.str();
+}
+
+} // namespace learning
@@ -0,0 +1,246 @@
+#ifndef DEEPSHEEP_LEARNING_TRICKPOSITION_H_
+#define DEEPSHEEP_LEARNING_TRICKPOSITION_H_
+
+#include "learning/card_mask.h"
+#include "learning/suit_permutation.h"
+#include "sheepshead/interface/hand.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace learning {
+
+/// Return the seat, 0 through number_of_players - 1, of a player in a Hand.
+
+//! Seats count from the dealer, so they agree with PlayerId positions.
+int seat_index(const sheepshead::interface::Hand& hand,
+               const sheepshead::interface::PlayerId& player);
+
+/// Return the PlayerId sitting in a seat of a Hand.
+sheepshead::interface::PlayerId player_at_seat(const sheepshead::interface::Hand& hand,
+                                               int seat);
+
+/// A compact, perfect-information position in the trick-playing part of a hand.
+
+/** The TrickPosition is built for search. Every seat's cards are visible,
+ *  plays are made and unmade in place with make_move() and unmake_move(), and
+ *  nothing is allocated. Once the picking round is over, the rules of
+ *  Sheepshead applied here are the same as the interface: which cards may be
+ *  played, who wins each trick, and the reward each seat gets at the end.
+ */
+class TrickPosition
+{
+public:
+  static const int MAX_PLAYERS = 5;
+  //! The effective suit of trump cards. Fail suits use the printed suit.
+  static const int TRUMP_SUIT = 4;
+
+  //! Construct an empty position.
+  TrickPosition();
+
+  //! Construct a position from a Hand whose picking round is finished.
+  explicit TrickPosition(const sheepshead::interface::Hand& hand);
+
+  int number_of_players() const { return m_number_of_players; }
+  int number_of_tricks() const { return m_number_of_tricks; }
+  bool trump_is_clubs() const { return m_trump_is_clubs; }
+
+  //! The seat of the picker, or -1 when playing leasters.
+  int picker() const { return m_picker; }
+  //! The seat holding or having played the partner card, or -1 if none.
+  int partner() const { return m_partner; }
+  //! The called partner card, or NO_CARD.
+  int partner_card() const { return m_partner_card; }
+  //! The card the picker designated unknown, or NO_CARD.
+  int unknown_card() const { return m_unknown_card; }
+  bool is_leasters() const { return m_picker < 0; }
+  bool on_picking_team(int seat) const
+  {
+    return seat == m_picker || seat == m_partner;
+  }
+  //! Whether the partner card has been played.
+  bool partner_revealed() const { return m_partner_revealed; }
+
+  //! The suit a card belongs to under these rules, TRUMP_SUIT for trump.
+  int effective_suit(int card) const { return m_suit[card]; }
+  //! The strength of a card within its effective suit. Higher wins.
+  int strength(int card) const { return m_strength[card]; }
+  //! All cards with an effective suit, held or not.
+  CardMask suit_mask(int suit) const { return m_suit_masks[suit]; }
+
+  CardMask held_cards(int seat) const { return m_held[seat]; }
+  //! The cards laid in tricks so far, including the current trick.
+  CardMask played_cards() const { return m_played; }
+  CardMask discarded_cards() const { return m_discarded; }
+
+  int leader() const { return m_leader; }
+  int trick_size() const { return m_trick_size; }
+  int trick_card(int i) const { return m_trick_cards[i]; }
+  int to_play() const { return (m_leader + m_trick_size) % m_number_of_players; }
+  int number_of_finished_tricks() const { return m_finished_tricks; }
+  bool is_finished() const { return m_finished_tricks == m_number_of_tricks; }
+  //! The number of moves made since construction that have not been unmade.
+  int number_of_moves_made() const { return m_ply; }
+
+  int seat_points(int seat) const { return m_seat_points[seat]; }
+  int seat_tricks(int seat) const { return m_seat_tricks[seat]; }
+  //! Points won by the picking team, counting the picker's discards.
+  int picking_team_points() const { return m_team_points[0] + discard_points(); }
+  int defending_team_points() const { return m_team_points[1]; }
+  int picking_team_tricks() const { return m_team_tricks[0]; }
+  int defending_team_tricks() const { return m_team_tricks[1]; }
+  int discard_points() const;
+
+  /// A 64-bit Zobrist key for the position, kept up to date by make and unmake.
+
+  //! The key covers each seat's held cards, the current trick, the leader,
+  //! the points and tricks each team has banked, and whether the partner card
+  //! has been played. The picker, partner card, unknown card and trump suit
+  //! are included too, so keys from different hands don't mix.
+  uint64_t key() const { return m_cards_key ^ m_score_key; }
+  //! The key without the banked points and tricks, for searches that value
+  //! positions by what is still to be won.
+  uint64_t cards_key() const { return m_cards_key; }
+
+  //! The cards the player to move may play.
+  CardMask legal_moves() const;
+
+  /// Remove moves that are equivalent to another move left in the set.
+
+  //! Two cards of the same effective suit in the mover's hand are equivalent
+  //! when no card between them in strength is still outstanding: every card
+  //! in between is held by the mover, discarded, or was played in a finished
+  //! trick. One card is kept for each point value in each equivalence class,
+  //! so the result loses nothing to a search of points. The partner card and
+  //! the unknown card are never merged with others.
+  CardMask distinct_moves(CardMask moves) const;
+
+  //! How a card ranks in a trick led with led_suit. Higher wins; -1 can't win.
+  int trick_score(int card, int led_suit) const
+  {
+    if(m_suit[card] == TRUMP_SUIT) return 64 + m_strength[card];
+    return m_suit[card] == led_suit ? m_strength[card] : -1;
+  }
+  //! The position in the current trick of the card winning it so far.
+  int trick_winning_offset() const;
+
+  //! Lay a card for the player to move, completing the trick if it is the last card.
+  void make_move(int card);
+  //! Take back the last move made.
+  void unmake_move();
+
+  //! The reward for a seat in a finished position, the same as Hand::reward.
+  int reward(int seat) const;
+
+  /// The band of the picking team's result that rewards are scaled from.
+
+  //! -3 when the picking team takes no trick, -2 for under 31 points, -1
+  //! under 61, 1 under 91, 2 for 91 or more, and 3 when the defenders take
+  //! no trick. Only for finished positions with a picker.
+  int picking_team_band() const;
+  //! The band the picking team's points alone fall in, -2 through 2.
+  static int points_band(int picking_team_points);
+  //! The reward for a seat when the picking team finishes in a band.
+  int reward_for_band(int seat, int band) const;
+
+  //! The largest reward magnitude any seat can receive under these rules.
+  int max_reward() const { return 3 * (m_number_of_players - 1); }
+
+  /// Replace the hidden parts of the position, keeping everything played.
+
+  //! Used to build determinizations: the seats' held cards, the picker's
+  //! discards and the unknown card are replaced, and the partner seat is
+  //! recomputed from whoever now holds the partner card.
+  void redeal(const std::array<CardMask, MAX_PLAYERS>& held_cards,
+              CardMask discarded_cards, int unknown_card);
+
+  /// Relabel the fail suits of every card in the position, moves made included.
+
+  //! The result plays and scores exactly as the original did, with each card
+  //! replaced by permutation.card(card), and the moves made can still be
+  //! unmade. The keys are those of the relabeled position.
+  void permute_fail_suits(const SuitPermutation& permutation);
+
+  //! The permutation taking this position to its canonical representative.
+
+  //! Positions that differ only by a relabeling of the fail suits have the
+  //! same representative and so the same keys once canonicalized. The held
+  //! cards, the current trick, the discards, and the partner and unknown
+  //! cards are all respected, so a called suit keeps its identity.
+  SuitPermutation canonical_permutation() const;
+
+  //! The canonical permutation of what one seat can see.
+
+  //! Only the seat's own cards, the cards played, the current trick, the
+  //! partner card, and if the seat picked, its discards and the unknown card
+  //! are taken into account. For keying what a player knows, such as the
+  //! state of a tabular learner.
+  SuitPermutation canonical_permutation(int observer) const;
+
+  //! Permute the position to its canonical representative and return the permutation used.
+
+  //! Map a move chosen in the canonical position back with the inverse.
+  SuitPermutation canonicalize();
+
+  std::string debug_string() const;
+
+private:
+  struct UndoRecord
+  {
+    int8_t card;
+    int8_t leader;
+    int8_t winner;
+    int8_t points;
+    bool partner_revealed;
+    int8_t trick_cards[MAX_PLAYERS];
+    uint64_t cards_key;
+    uint64_t score_key;
+  };
+
+  void initialize_card_tables();
+  void compute_team_totals();
+  void compute_keys();
+
+  int m_number_of_players;
+  int m_number_of_tricks;
+  bool m_trump_is_clubs;
+
+  int m_picker;
+  int m_partner;
+  int m_partner_card;
+  int m_unknown_card;
+  bool m_partner_rules;
+  bool m_partner_revealed;
+
+  int8_t m_suit[NUMBER_OF_CARDS];
+  int8_t m_strength[NUMBER_OF_CARDS];
+  CardMask m_suit_masks[TRUMP_SUIT + 1];
+  //! The cards of each effective suit, strongest first.
+  int8_t m_suit_order[TRUMP_SUIT + 1][NUMBER_OF_CARDS];
+  int m_suit_sizes[TRUMP_SUIT + 1];
+
+  CardMask m_held[MAX_PLAYERS];
+  CardMask m_played;
+  CardMask m_discarded;
+
+  int m_leader;
+  int m_trick_size;
+  int8_t m_trick_cards[MAX_PLAYERS];
+  int m_finished_tricks;
+
+  int m_seat_points[MAX_PLAYERS];
+  int m_seat_tricks[MAX_PLAYERS];
+  int m_team_points[2];
+  int m_team_tricks[2];
+
+  uint64_t m_cards_key;
+  uint64_t m_score_key;
+
+  int m_ply;
+  UndoRecord m_undo[NUMBER_OF_CARDS];
+
+}; // class TrickPosition
+
+} // namespace learning
+#endif
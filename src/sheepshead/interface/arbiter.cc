@@ -76,36 +76,12 @@ void prepare_new_trick(const MutableHandHandle& hand_ptr)
 
 void initialize_hand(const MutableHandHandle& hand_ptr, unsigned seed)
 {
-  // First get the rules so we know how to initialize.
-  auto rules = Rules(hand_ptr);
-  
   // Initialize the deck.
   auto deck = internal::Deck();
   deck.initialize_full_deck();
   deck.shuffle_deck(seed);
-  
-  // Construct the seats and the held cards for each seat 
-  for(int player = 0; player < rules.number_of_players(); player++) {
-    auto new_seat = hand_ptr->add_seats();
 
-    auto dealt_cards = deck.deal(rules.number_of_cards_per_player());
-
-    for(auto& dealt_card : dealt_cards) {
-      auto new_card = new_seat->add_held_cards();
-      *new_card = dealt_card;
-    }
-  }
-  
-  // Create the picking round, and we're playable
-  auto picking_round = hand_ptr->mutable_picking_round();
-  picking_round->set_leader_position(0); // Pretty much arbitrary
-
-  // Deal cards into the blinds
-  auto blind_cards = deck.deal(rules.number_of_cards_in_blinds());
-  for(auto& card : blind_cards) {
-    auto new_card = hand_ptr->mutable_picking_round()->add_blinds();
-    *new_card = card;
-  }
+  internal::deal_hand(hand_ptr, &deck);
 }
 
 } // namespace internal    
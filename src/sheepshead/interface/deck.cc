@@ -35,6 +35,11 @@ void Deck::initialize_full_deck()
   }
 }
 
+void Deck::initialize_stacked_deck(const std::vector<model::Card>& cards)
+{
+  m_deck = cards;
+}
+
 void Deck::clear()
 {
   m_deck.clear();
@@ -59,6 +64,34 @@ std::vector<model::Card> Deck::deal(int number_of_cards)
   return output_cards;
 }
 
+void deal_hand(const MutableHandHandle& hand_ptr, Deck* deck)
+{
+  auto rules = Rules(hand_ptr);
+
+  // Construct the seats and the held cards for each seat
+  for(int player = 0; player < rules.number_of_players(); player++) {
+    auto new_seat = hand_ptr->add_seats();
+
+    auto dealt_cards = deck->deal(rules.number_of_cards_per_player());
+
+    for(auto& dealt_card : dealt_cards) {
+      auto new_card = new_seat->add_held_cards();
+      *new_card = dealt_card;
+    }
+  }
+
+  // Create the picking round, and we're playable
+  auto picking_round = hand_ptr->mutable_picking_round();
+  picking_round->set_leader_position(0); // Pretty much arbitrary
+
+  // Deal cards into the blinds
+  auto blind_cards = deck->deal(rules.number_of_cards_in_blinds());
+  for(auto& card : blind_cards) {
+    auto new_card = hand_ptr->mutable_picking_round()->add_blinds();
+    *new_card = card;
+  }
+}
+
 } // namespace internal
 
 Card::Card()
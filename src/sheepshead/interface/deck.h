@@ -19,6 +19,9 @@ public:
   /// Set the Deck to have all 32 sheepshead cards.
   void initialize_full_deck();
 
+  /// Set the Deck to hold exactly these cards, in this order.
+  void initialize_stacked_deck(const std::vector<model::Card>& cards);
+
   /// Put the Deck in a random order.
   void shuffle_deck(unsigned p_seed = 0);
 
@@ -33,6 +36,9 @@ private:
 
 }; // class Deck
 
+/// Deal a Deck in its current order: each seat's cards in turn, then the blinds.
+void deal_hand(const MutableHandHandle& hand_ptr, Deck* deck);
+
 } // namespace internal
 
 
@@ -38,6 +38,44 @@ Hand::Hand(const Rules& rules, unsigned long random_seed)
   *hand_rules = new_rules;
 }
 
+Hand::Hand(const Rules& rules,
+           const std::vector<std::pair<Card::Suit, Card::Rank>>& deck)
+  : Hand(rules, 1)
+{
+  assert(deck.size() == static_cast<size_t>(rules.number_of_players() *
+                                            rules.number_of_cards_per_player() +
+                                            rules.number_of_cards_in_blinds()));
+
+  std::vector<model::Card> model_cards;
+  for(auto& suit_and_rank : deck) {
+    auto card = model::Card();
+    switch(suit_and_rank.first) {
+      case Card::Suit::DIAMONDS : card.set_suit(model::DIAMONDS); break;
+      case Card::Suit::HEARTS : card.set_suit(model::HEARTS); break;
+      case Card::Suit::CLUBS : card.set_suit(model::CLUBS); break;
+      case Card::Suit::SPADES : card.set_suit(model::SPADES); break;
+      default : assert(false);
+    }
+    switch(suit_and_rank.second) {
+      case Card::Rank::ACE : card.set_rank(model::ACE); break;
+      case Card::Rank::TEN : card.set_rank(model::TEN); break;
+      case Card::Rank::KING : card.set_rank(model::KING); break;
+      case Card::Rank::QUEEN : card.set_rank(model::QUEEN); break;
+      case Card::Rank::JACK : card.set_rank(model::JACK); break;
+      case Card::Rank::NINE : card.set_rank(model::NINE); break;
+      case Card::Rank::EIGHT : card.set_rank(model::EIGHT); break;
+      case Card::Rank::SEVEN : card.set_rank(model::SEVEN); break;
+      default : assert(false);
+    }
+    card.set_unknown(false);
+    model_cards.push_back(card);
+  }
+
+  auto stacked_deck = internal::Deck();
+  stacked_deck.initialize_stacked_deck(model_cards);
+  internal::deal_hand(m_hand_ptr, &stacked_deck);
+}
+
 Hand::Hand(std::istream* input)
 {
   m_hand_ptr = std::make_shared<sheepshead::model::Hand> ();
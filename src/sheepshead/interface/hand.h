@@ -15,6 +15,8 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace sheepshead {
 namespace interface {
@@ -33,6 +35,15 @@ public:
   //! Construct a Hand with a specified rule variation.
   Hand(const Rules& rules, unsigned long random_seed = 0);
 
+  /// Construct a Hand dealt from a stacked deck.
+
+  //! The deck holds every card once, as printed suit and rank. The first
+  //! number_of_cards_per_player cards go to the dealer's seat, the next to
+  //! the following seat and so on, and the rest go to the blinds. The Hand
+  //! is ready for the picking round.
+  Hand(const Rules& rules,
+       const std::vector<std::pair<Card::Suit, Card::Rank>>& deck);
+
   //! Construct a Hand by reading a previously serialized Hand from an istream.
   Hand(std::istream* input);
 
@@ -0,0 +1,655 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: deck.proto
+
+#include "deck.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace sheepshead {
+namespace model {
+PROTOBUF_CONSTEXPR Card::Card(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.suit_)*/0
+  , /*decltype(_impl_.rank_)*/0
+  , /*decltype(_impl_.unknown_)*/false} {}
+struct CardDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CardDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CardDefaultTypeInternal() {}
+  union {
+    Card _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CardDefaultTypeInternal _Card_default_instance_;
+PROTOBUF_CONSTEXPR Deck::Deck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cards_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeckDefaultTypeInternal() {}
+  union {
+    Deck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeckDefaultTypeInternal _Deck_default_instance_;
+}  // namespace model
+}  // namespace sheepshead
+static ::_pb::Metadata file_level_metadata_deck_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_deck_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_deck_2eproto = nullptr;
+
+const uint32_t TableStruct_deck_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Card, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Card, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Card, _impl_.suit_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Card, _impl_.rank_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Card, _impl_.unknown_),
+  0,
+  1,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Deck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Deck, _impl_.cards_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::sheepshead::model::Card)},
+  { 12, -1, -1, sizeof(::sheepshead::model::Deck)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::sheepshead::model::_Card_default_instance_._instance,
+  &::sheepshead::model::_Deck_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_deck_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\ndeck.proto\022\020sheepshead.model\"j\n\004Card\022$"
+  "\n\004suit\030\001 \002(\0162\026.sheepshead.model.Suit\022$\n\004"
+  "rank\030\002 \002(\0162\026.sheepshead.model.Rank\022\026\n\007un"
+  "known\030\003 \001(\010:\005false\"-\n\004Deck\022%\n\005cards\030\001 \003("
+  "\0132\026.sheepshead.model.Card*7\n\004Suit\022\014\n\010DIA"
+  "MONDS\020\000\022\n\n\006HEARTS\020\001\022\n\n\006SPADES\020\002\022\t\n\005CLUBS"
+  "\020\003*W\n\004Rank\022\007\n\003ACE\020\000\022\007\n\003TEN\020\001\022\010\n\004KING\020\002\022\t"
+  "\n\005QUEEN\020\003\022\010\n\004JACK\020\004\022\010\n\004NINE\020\005\022\t\n\005EIGHT\020\006"
+  "\022\t\n\005SEVEN\020\007"
+  ;
+static ::_pbi::once_flag descriptor_table_deck_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_deck_2eproto = {
+    false, false, 331, descriptor_table_protodef_deck_2eproto,
+    "deck.proto",
+    &descriptor_table_deck_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_deck_2eproto::offsets,
+    file_level_metadata_deck_2eproto, file_level_enum_descriptors_deck_2eproto,
+    file_level_service_descriptors_deck_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_deck_2eproto_getter() {
+  return &descriptor_table_deck_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_deck_2eproto(&descriptor_table_deck_2eproto);
+namespace sheepshead {
+namespace model {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Suit_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deck_2eproto);
+  return file_level_enum_descriptors_deck_2eproto[0];
+}
+bool Suit_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Rank_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_deck_2eproto);
+  return file_level_enum_descriptors_deck_2eproto[1];
+}
+bool Rank_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class Card::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Card>()._impl_._has_bits_);
+  static void set_has_suit(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_rank(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_unknown(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Card::Card(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sheepshead.model.Card)
+}
+Card::Card(const Card& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Card* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.suit_){}
+    , decltype(_impl_.rank_){}
+    , decltype(_impl_.unknown_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.suit_, &from._impl_.suit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unknown_) -
+    reinterpret_cast<char*>(&_impl_.suit_)) + sizeof(_impl_.unknown_));
+  // @@protoc_insertion_point(copy_constructor:sheepshead.model.Card)
+}
+
+inline void Card::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.suit_){0}
+    , decltype(_impl_.rank_){0}
+    , decltype(_impl_.unknown_){false}
+  };
+}
+
+Card::~Card() {
+  // @@protoc_insertion_point(destructor:sheepshead.model.Card)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Card::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Card::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Card::Clear() {
+// @@protoc_insertion_point(message_clear_start:sheepshead.model.Card)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.suit_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.unknown_) -
+        reinterpret_cast<char*>(&_impl_.suit_)) + sizeof(_impl_.unknown_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Card::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .sheepshead.model.Suit suit = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sheepshead::model::Suit_IsValid(val))) {
+            _internal_set_suit(static_cast<::sheepshead::model::Suit>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required .sheepshead.model.Rank rank = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sheepshead::model::Rank_IsValid(val))) {
+            _internal_set_rank(static_cast<::sheepshead::model::Rank>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool unknown = 3 [default = false];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_unknown(&has_bits);
+          _impl_.unknown_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Card::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sheepshead.model.Card)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .sheepshead.model.Suit suit = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_suit(), target);
+  }
+
+  // required .sheepshead.model.Rank rank = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_rank(), target);
+  }
+
+  // optional bool unknown = 3 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_unknown(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sheepshead.model.Card)
+  return target;
+}
+
+size_t Card::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:sheepshead.model.Card)
+  size_t total_size = 0;
+
+  if (_internal_has_suit()) {
+    // required .sheepshead.model.Suit suit = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_suit());
+  }
+
+  if (_internal_has_rank()) {
+    // required .sheepshead.model.Rank rank = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_rank());
+  }
+
+  return total_size;
+}
+size_t Card::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sheepshead.model.Card)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .sheepshead.model.Suit suit = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_suit());
+
+    // required .sheepshead.model.Rank rank = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_rank());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bool unknown = 3 [default = false];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Card::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Card::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Card::GetClassData() const { return &_class_data_; }
+
+
+void Card::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Card*>(&to_msg);
+  auto& from = static_cast<const Card&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sheepshead.model.Card)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.suit_ = from._impl_.suit_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.rank_ = from._impl_.rank_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.unknown_ = from._impl_.unknown_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Card::CopyFrom(const Card& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sheepshead.model.Card)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Card::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Card::InternalSwap(Card* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Card, _impl_.unknown_)
+      + sizeof(Card::_impl_.unknown_)
+      - PROTOBUF_FIELD_OFFSET(Card, _impl_.suit_)>(
+          reinterpret_cast<char*>(&_impl_.suit_),
+          reinterpret_cast<char*>(&other->_impl_.suit_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Card::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deck_2eproto_getter, &descriptor_table_deck_2eproto_once,
+      file_level_metadata_deck_2eproto[0]);
+}
+
+// ===================================================================
+
+class Deck::_Internal {
+ public:
+};
+
+Deck::Deck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sheepshead.model.Deck)
+}
+Deck::Deck(const Deck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Deck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cards_){from._impl_.cards_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:sheepshead.model.Deck)
+}
+
+inline void Deck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cards_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Deck::~Deck() {
+  // @@protoc_insertion_point(destructor:sheepshead.model.Deck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Deck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cards_.~RepeatedPtrField();
+}
+
+void Deck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Deck::Clear() {
+// @@protoc_insertion_point(message_clear_start:sheepshead.model.Deck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cards_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Deck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .sheepshead.model.Card cards = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_cards(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Deck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sheepshead.model.Deck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .sheepshead.model.Card cards = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_cards_size()); i < n; i++) {
+    const auto& repfield = this->_internal_cards(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sheepshead.model.Deck)
+  return target;
+}
+
+size_t Deck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sheepshead.model.Deck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sheepshead.model.Card cards = 1;
+  total_size += 1UL * this->_internal_cards_size();
+  for (const auto& msg : this->_impl_.cards_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Deck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Deck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Deck::GetClassData() const { return &_class_data_; }
+
+
+void Deck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Deck*>(&to_msg);
+  auto& from = static_cast<const Deck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sheepshead.model.Deck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.cards_.MergeFrom(from._impl_.cards_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Deck::CopyFrom(const Deck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sheepshead.model.Deck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Deck::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.cards_))
+    return false;
+  return true;
+}
+
+void Deck::InternalSwap(Deck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.cards_.InternalSwap(&other->_impl_.cards_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Deck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_deck_2eproto_getter, &descriptor_table_deck_2eproto_once,
+      file_level_metadata_deck_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace model
+}  // namespace sheepshead
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::sheepshead::model::Card*
+Arena::CreateMaybeMessage< ::sheepshead::model::Card >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sheepshead::model::Card >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sheepshead::model::Deck*
+Arena::CreateMaybeMessage< ::sheepshead::model::Deck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sheepshead::model::Deck >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
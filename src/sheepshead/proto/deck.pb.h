@@ -0,0 +1,646 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: deck.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_deck_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_deck_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_deck_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_deck_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_deck_2eproto;
+namespace sheepshead {
+namespace model {
+class Card;
+struct CardDefaultTypeInternal;
+extern CardDefaultTypeInternal _Card_default_instance_;
+class Deck;
+struct DeckDefaultTypeInternal;
+extern DeckDefaultTypeInternal _Deck_default_instance_;
+}  // namespace model
+}  // namespace sheepshead
+PROTOBUF_NAMESPACE_OPEN
+template<> ::sheepshead::model::Card* Arena::CreateMaybeMessage<::sheepshead::model::Card>(Arena*);
+template<> ::sheepshead::model::Deck* Arena::CreateMaybeMessage<::sheepshead::model::Deck>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace sheepshead {
+namespace model {
+
+enum Suit : int {
+  DIAMONDS = 0,
+  HEARTS = 1,
+  SPADES = 2,
+  CLUBS = 3
+};
+bool Suit_IsValid(int value);
+constexpr Suit Suit_MIN = DIAMONDS;
+constexpr Suit Suit_MAX = CLUBS;
+constexpr int Suit_ARRAYSIZE = Suit_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Suit_descriptor();
+template<typename T>
+inline const std::string& Suit_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Suit>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Suit_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Suit_descriptor(), enum_t_value);
+}
+inline bool Suit_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Suit* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Suit>(
+    Suit_descriptor(), name, value);
+}
+enum Rank : int {
+  ACE = 0,
+  TEN = 1,
+  KING = 2,
+  QUEEN = 3,
+  JACK = 4,
+  NINE = 5,
+  EIGHT = 6,
+  SEVEN = 7
+};
+bool Rank_IsValid(int value);
+constexpr Rank Rank_MIN = ACE;
+constexpr Rank Rank_MAX = SEVEN;
+constexpr int Rank_ARRAYSIZE = Rank_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Rank_descriptor();
+template<typename T>
+inline const std::string& Rank_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Rank>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Rank_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Rank_descriptor(), enum_t_value);
+}
+inline bool Rank_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Rank* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Rank>(
+    Rank_descriptor(), name, value);
+}
+// ===================================================================
+
+class Card final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sheepshead.model.Card) */ {
+ public:
+  inline Card() : Card(nullptr) {}
+  ~Card() override;
+  explicit PROTOBUF_CONSTEXPR Card(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Card(const Card& from);
+  Card(Card&& from) noexcept
+    : Card() {
+    *this = ::std::move(from);
+  }
+
+  inline Card& operator=(const Card& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Card& operator=(Card&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Card& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Card* internal_default_instance() {
+    return reinterpret_cast<const Card*>(
+               &_Card_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Card& a, Card& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Card* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Card* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Card* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Card>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Card& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Card& from) {
+    Card::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Card* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sheepshead.model.Card";
+  }
+  protected:
+  explicit Card(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSuitFieldNumber = 1,
+    kRankFieldNumber = 2,
+    kUnknownFieldNumber = 3,
+  };
+  // required .sheepshead.model.Suit suit = 1;
+  bool has_suit() const;
+  private:
+  bool _internal_has_suit() const;
+  public:
+  void clear_suit();
+  ::sheepshead::model::Suit suit() const;
+  void set_suit(::sheepshead::model::Suit value);
+  private:
+  ::sheepshead::model::Suit _internal_suit() const;
+  void _internal_set_suit(::sheepshead::model::Suit value);
+  public:
+
+  // required .sheepshead.model.Rank rank = 2;
+  bool has_rank() const;
+  private:
+  bool _internal_has_rank() const;
+  public:
+  void clear_rank();
+  ::sheepshead::model::Rank rank() const;
+  void set_rank(::sheepshead::model::Rank value);
+  private:
+  ::sheepshead::model::Rank _internal_rank() const;
+  void _internal_set_rank(::sheepshead::model::Rank value);
+  public:
+
+  // optional bool unknown = 3 [default = false];
+  bool has_unknown() const;
+  private:
+  bool _internal_has_unknown() const;
+  public:
+  void clear_unknown();
+  bool unknown() const;
+  void set_unknown(bool value);
+  private:
+  bool _internal_unknown() const;
+  void _internal_set_unknown(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sheepshead.model.Card)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int suit_;
+    int rank_;
+    bool unknown_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deck_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Deck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sheepshead.model.Deck) */ {
+ public:
+  inline Deck() : Deck(nullptr) {}
+  ~Deck() override;
+  explicit PROTOBUF_CONSTEXPR Deck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Deck(const Deck& from);
+  Deck(Deck&& from) noexcept
+    : Deck() {
+    *this = ::std::move(from);
+  }
+
+  inline Deck& operator=(const Deck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Deck& operator=(Deck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Deck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Deck* internal_default_instance() {
+    return reinterpret_cast<const Deck*>(
+               &_Deck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Deck& a, Deck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Deck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Deck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Deck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Deck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Deck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Deck& from) {
+    Deck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Deck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sheepshead.model.Deck";
+  }
+  protected:
+  explicit Deck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCardsFieldNumber = 1,
+  };
+  // repeated .sheepshead.model.Card cards = 1;
+  int cards_size() const;
+  private:
+  int _internal_cards_size() const;
+  public:
+  void clear_cards();
+  ::sheepshead::model::Card* mutable_cards(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+      mutable_cards();
+  private:
+  const ::sheepshead::model::Card& _internal_cards(int index) const;
+  ::sheepshead::model::Card* _internal_add_cards();
+  public:
+  const ::sheepshead::model::Card& cards(int index) const;
+  ::sheepshead::model::Card* add_cards();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+      cards() const;
+
+  // @@protoc_insertion_point(class_scope:sheepshead.model.Deck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card > cards_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_deck_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Card
+
+// required .sheepshead.model.Suit suit = 1;
+inline bool Card::_internal_has_suit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Card::has_suit() const {
+  return _internal_has_suit();
+}
+inline void Card::clear_suit() {
+  _impl_.suit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::sheepshead::model::Suit Card::_internal_suit() const {
+  return static_cast< ::sheepshead::model::Suit >(_impl_.suit_);
+}
+inline ::sheepshead::model::Suit Card::suit() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Card.suit)
+  return _internal_suit();
+}
+inline void Card::_internal_set_suit(::sheepshead::model::Suit value) {
+  assert(::sheepshead::model::Suit_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.suit_ = value;
+}
+inline void Card::set_suit(::sheepshead::model::Suit value) {
+  _internal_set_suit(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.Card.suit)
+}
+
+// required .sheepshead.model.Rank rank = 2;
+inline bool Card::_internal_has_rank() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Card::has_rank() const {
+  return _internal_has_rank();
+}
+inline void Card::clear_rank() {
+  _impl_.rank_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::sheepshead::model::Rank Card::_internal_rank() const {
+  return static_cast< ::sheepshead::model::Rank >(_impl_.rank_);
+}
+inline ::sheepshead::model::Rank Card::rank() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Card.rank)
+  return _internal_rank();
+}
+inline void Card::_internal_set_rank(::sheepshead::model::Rank value) {
+  assert(::sheepshead::model::Rank_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.rank_ = value;
+}
+inline void Card::set_rank(::sheepshead::model::Rank value) {
+  _internal_set_rank(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.Card.rank)
+}
+
+// optional bool unknown = 3 [default = false];
+inline bool Card::_internal_has_unknown() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Card::has_unknown() const {
+  return _internal_has_unknown();
+}
+inline void Card::clear_unknown() {
+  _impl_.unknown_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Card::_internal_unknown() const {
+  return _impl_.unknown_;
+}
+inline bool Card::unknown() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Card.unknown)
+  return _internal_unknown();
+}
+inline void Card::_internal_set_unknown(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.unknown_ = value;
+}
+inline void Card::set_unknown(bool value) {
+  _internal_set_unknown(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.Card.unknown)
+}
+
+// -------------------------------------------------------------------
+
+// Deck
+
+// repeated .sheepshead.model.Card cards = 1;
+inline int Deck::_internal_cards_size() const {
+  return _impl_.cards_.size();
+}
+inline int Deck::cards_size() const {
+  return _internal_cards_size();
+}
+inline void Deck::clear_cards() {
+  _impl_.cards_.Clear();
+}
+inline ::sheepshead::model::Card* Deck::mutable_cards(int index) {
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.Deck.cards)
+  return _impl_.cards_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+Deck::mutable_cards() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.Deck.cards)
+  return &_impl_.cards_;
+}
+inline const ::sheepshead::model::Card& Deck::_internal_cards(int index) const {
+  return _impl_.cards_.Get(index);
+}
+inline const ::sheepshead::model::Card& Deck::cards(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Deck.cards)
+  return _internal_cards(index);
+}
+inline ::sheepshead::model::Card* Deck::_internal_add_cards() {
+  return _impl_.cards_.Add();
+}
+inline ::sheepshead::model::Card* Deck::add_cards() {
+  ::sheepshead::model::Card* _add = _internal_add_cards();
+  // @@protoc_insertion_point(field_add:sheepshead.model.Deck.cards)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+Deck::cards() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.Deck.cards)
+  return _impl_.cards_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace model
+}  // namespace sheepshead
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::sheepshead::model::Suit> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sheepshead::model::Suit>() {
+  return ::sheepshead::model::Suit_descriptor();
+}
+template <> struct is_proto_enum< ::sheepshead::model::Rank> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sheepshead::model::Rank>() {
+  return ::sheepshead::model::Rank_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_deck_2eproto
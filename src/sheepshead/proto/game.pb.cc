@@ -0,0 +1,1479 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: game.proto
+
+#include "game.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace sheepshead {
+namespace model {
+PROTOBUF_CONSTEXPR Hand::Hand(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tricks_)*/{}
+  , /*decltype(_impl_.seats_)*/{}
+  , /*decltype(_impl_.rule_variation_)*/nullptr
+  , /*decltype(_impl_.picking_round_)*/nullptr} {}
+struct HandDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HandDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HandDefaultTypeInternal() {}
+  union {
+    Hand _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HandDefaultTypeInternal _Hand_default_instance_;
+PROTOBUF_CONSTEXPR Seat::Seat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.held_cards_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SeatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SeatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SeatDefaultTypeInternal() {}
+  union {
+    Seat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeatDefaultTypeInternal _Seat_default_instance_;
+PROTOBUF_CONSTEXPR Trick::Trick(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.laid_cards_)*/{}
+  , /*decltype(_impl_.leader_position_)*/0} {}
+struct TrickDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TrickDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TrickDefaultTypeInternal() {}
+  union {
+    Trick _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrickDefaultTypeInternal _Trick_default_instance_;
+PROTOBUF_CONSTEXPR PickingRound::PickingRound(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.picking_decisions_)*/{}
+  , /*decltype(_impl_.discarded_cards_)*/{}
+  , /*decltype(_impl_.blinds_)*/{}
+  , /*decltype(_impl_.partner_card_)*/nullptr
+  , /*decltype(_impl_.leader_position_)*/0
+  , /*decltype(_impl_.loner_decision_)*/0
+  , /*decltype(_impl_.unknown_decision_made_)*/false} {}
+struct PickingRoundDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PickingRoundDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PickingRoundDefaultTypeInternal() {}
+  union {
+    PickingRound _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PickingRoundDefaultTypeInternal _PickingRound_default_instance_;
+}  // namespace model
+}  // namespace sheepshead
+static ::_pb::Metadata file_level_metadata_game_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_game_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_game_2eproto = nullptr;
+
+const uint32_t TableStruct_game_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Hand, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Hand, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Hand, _impl_.rule_variation_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Hand, _impl_.picking_round_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Hand, _impl_.tricks_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Hand, _impl_.seats_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Seat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Seat, _impl_.held_cards_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Trick, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Trick, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Trick, _impl_.leader_position_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::Trick, _impl_.laid_cards_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _impl_.leader_position_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _impl_.picking_decisions_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _impl_.loner_decision_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _impl_.partner_card_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _impl_.unknown_decision_made_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _impl_.discarded_cards_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::PickingRound, _impl_.blinds_),
+  1,
+  ~0u,
+  2,
+  0,
+  3,
+  ~0u,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::sheepshead::model::Hand)},
+  { 14, -1, -1, sizeof(::sheepshead::model::Seat)},
+  { 21, 29, -1, sizeof(::sheepshead::model::Trick)},
+  { 31, 44, -1, sizeof(::sheepshead::model::PickingRound)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::sheepshead::model::_Hand_default_instance_._instance,
+  &::sheepshead::model::_Seat_default_instance_._instance,
+  &::sheepshead::model::_Trick_default_instance_._instance,
+  &::sheepshead::model::_PickingRound_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_game_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\ngame.proto\022\020sheepshead.model\032\024rule_var"
+  "iation.proto\032\ndeck.proto\"\306\001\n\004Hand\0227\n\016rul"
+  "e_variation\030\001 \002(\0132\037.sheepshead.model.Rul"
+  "eVariation\0225\n\rpicking_round\030\004 \001(\0132\036.shee"
+  "pshead.model.PickingRound\022\'\n\006tricks\030\003 \003("
+  "\0132\027.sheepshead.model.Trick\022%\n\005seats\030\005 \003("
+  "\0132\026.sheepshead.model.Seat\"2\n\004Seat\022*\n\nhel"
+  "d_cards\030\001 \003(\0132\026.sheepshead.model.Card\"L\n"
+  "\005Trick\022\027\n\017leader_position\030\001 \001(\005\022*\n\nlaid_"
+  "cards\030\002 \003(\0132\026.sheepshead.model.Card\"\256\003\n\014"
+  "PickingRound\022\027\n\017leader_position\030\001 \001(\005\022I\n"
+  "\021picking_decisions\030\002 \003(\0162..sheepshead.mo"
+  "del.PickingRound.PickingDecision\022D\n\016lone"
+  "r_decision\030\003 \001(\0162,.sheepshead.model.Pick"
+  "ingRound.LonerDecision\022,\n\014partner_card\030\004"
+  " \001(\0132\026.sheepshead.model.Card\022\035\n\025unknown_"
+  "decision_made\030\005 \001(\010\022/\n\017discarded_cards\030\006"
+  " \003(\0132\026.sheepshead.model.Card\022&\n\006blinds\030\007"
+  " \003(\0132\026.sheepshead.model.Card\"%\n\017PickingD"
+  "ecision\022\010\n\004PICK\020\000\022\010\n\004PASS\020\001\"\'\n\rLonerDeci"
+  "sion\022\013\n\007PARTNER\020\000\022\t\n\005LONER\020\001"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_game_2eproto_deps[2] = {
+  &::descriptor_table_deck_2eproto,
+  &::descriptor_table_rule_5fvariation_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_game_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_game_2eproto = {
+    false, false, 828, descriptor_table_protodef_game_2eproto,
+    "game.proto",
+    &descriptor_table_game_2eproto_once, descriptor_table_game_2eproto_deps, 2, 4,
+    schemas, file_default_instances, TableStruct_game_2eproto::offsets,
+    file_level_metadata_game_2eproto, file_level_enum_descriptors_game_2eproto,
+    file_level_service_descriptors_game_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_game_2eproto_getter() {
+  return &descriptor_table_game_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_game_2eproto(&descriptor_table_game_2eproto);
+namespace sheepshead {
+namespace model {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PickingRound_PickingDecision_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_game_2eproto);
+  return file_level_enum_descriptors_game_2eproto[0];
+}
+bool PickingRound_PickingDecision_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PickingRound_PickingDecision PickingRound::PICK;
+constexpr PickingRound_PickingDecision PickingRound::PASS;
+constexpr PickingRound_PickingDecision PickingRound::PickingDecision_MIN;
+constexpr PickingRound_PickingDecision PickingRound::PickingDecision_MAX;
+constexpr int PickingRound::PickingDecision_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PickingRound_LonerDecision_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_game_2eproto);
+  return file_level_enum_descriptors_game_2eproto[1];
+}
+bool PickingRound_LonerDecision_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PickingRound_LonerDecision PickingRound::PARTNER;
+constexpr PickingRound_LonerDecision PickingRound::LONER;
+constexpr PickingRound_LonerDecision PickingRound::LonerDecision_MIN;
+constexpr PickingRound_LonerDecision PickingRound::LonerDecision_MAX;
+constexpr int PickingRound::LonerDecision_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Hand::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Hand>()._impl_._has_bits_);
+  static const ::sheepshead::model::RuleVariation& rule_variation(const Hand* msg);
+  static void set_has_rule_variation(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::sheepshead::model::PickingRound& picking_round(const Hand* msg);
+  static void set_has_picking_round(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::sheepshead::model::RuleVariation&
+Hand::_Internal::rule_variation(const Hand* msg) {
+  return *msg->_impl_.rule_variation_;
+}
+const ::sheepshead::model::PickingRound&
+Hand::_Internal::picking_round(const Hand* msg) {
+  return *msg->_impl_.picking_round_;
+}
+void Hand::clear_rule_variation() {
+  if (_impl_.rule_variation_ != nullptr) _impl_.rule_variation_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+Hand::Hand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sheepshead.model.Hand)
+}
+Hand::Hand(const Hand& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Hand* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tricks_){from._impl_.tricks_}
+    , decltype(_impl_.seats_){from._impl_.seats_}
+    , decltype(_impl_.rule_variation_){nullptr}
+    , decltype(_impl_.picking_round_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_rule_variation()) {
+    _this->_impl_.rule_variation_ = new ::sheepshead::model::RuleVariation(*from._impl_.rule_variation_);
+  }
+  if (from._internal_has_picking_round()) {
+    _this->_impl_.picking_round_ = new ::sheepshead::model::PickingRound(*from._impl_.picking_round_);
+  }
+  // @@protoc_insertion_point(copy_constructor:sheepshead.model.Hand)
+}
+
+inline void Hand::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tricks_){arena}
+    , decltype(_impl_.seats_){arena}
+    , decltype(_impl_.rule_variation_){nullptr}
+    , decltype(_impl_.picking_round_){nullptr}
+  };
+}
+
+Hand::~Hand() {
+  // @@protoc_insertion_point(destructor:sheepshead.model.Hand)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Hand::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tricks_.~RepeatedPtrField();
+  _impl_.seats_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.rule_variation_;
+  if (this != internal_default_instance()) delete _impl_.picking_round_;
+}
+
+void Hand::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Hand::Clear() {
+// @@protoc_insertion_point(message_clear_start:sheepshead.model.Hand)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tricks_.Clear();
+  _impl_.seats_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.rule_variation_ != nullptr);
+      _impl_.rule_variation_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.picking_round_ != nullptr);
+      _impl_.picking_round_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Hand::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .sheepshead.model.RuleVariation rule_variation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rule_variation(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sheepshead.model.Trick tricks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tricks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sheepshead.model.PickingRound picking_round = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_picking_round(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sheepshead.model.Seat seats = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_seats(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Hand::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sheepshead.model.Hand)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .sheepshead.model.RuleVariation rule_variation = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::rule_variation(this),
+        _Internal::rule_variation(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .sheepshead.model.Trick tricks = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tricks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tricks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .sheepshead.model.PickingRound picking_round = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::picking_round(this),
+        _Internal::picking_round(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .sheepshead.model.Seat seats = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_seats_size()); i < n; i++) {
+    const auto& repfield = this->_internal_seats(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sheepshead.model.Hand)
+  return target;
+}
+
+size_t Hand::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sheepshead.model.Hand)
+  size_t total_size = 0;
+
+  // required .sheepshead.model.RuleVariation rule_variation = 1;
+  if (_internal_has_rule_variation()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rule_variation_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sheepshead.model.Trick tricks = 3;
+  total_size += 1UL * this->_internal_tricks_size();
+  for (const auto& msg : this->_impl_.tricks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .sheepshead.model.Seat seats = 5;
+  total_size += 1UL * this->_internal_seats_size();
+  for (const auto& msg : this->_impl_.seats_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional .sheepshead.model.PickingRound picking_round = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.picking_round_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Hand::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Hand::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Hand::GetClassData() const { return &_class_data_; }
+
+
+void Hand::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Hand*>(&to_msg);
+  auto& from = static_cast<const Hand&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sheepshead.model.Hand)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tricks_.MergeFrom(from._impl_.tricks_);
+  _this->_impl_.seats_.MergeFrom(from._impl_.seats_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_rule_variation()->::sheepshead::model::RuleVariation::MergeFrom(
+          from._internal_rule_variation());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_picking_round()->::sheepshead::model::PickingRound::MergeFrom(
+          from._internal_picking_round());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Hand::CopyFrom(const Hand& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sheepshead.model.Hand)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Hand::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.tricks_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.seats_))
+    return false;
+  if (_internal_has_picking_round()) {
+    if (!_impl_.picking_round_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Hand::InternalSwap(Hand* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.tricks_.InternalSwap(&other->_impl_.tricks_);
+  _impl_.seats_.InternalSwap(&other->_impl_.seats_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Hand, _impl_.picking_round_)
+      + sizeof(Hand::_impl_.picking_round_)
+      - PROTOBUF_FIELD_OFFSET(Hand, _impl_.rule_variation_)>(
+          reinterpret_cast<char*>(&_impl_.rule_variation_),
+          reinterpret_cast<char*>(&other->_impl_.rule_variation_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Hand::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[0]);
+}
+
+// ===================================================================
+
+class Seat::_Internal {
+ public:
+};
+
+void Seat::clear_held_cards() {
+  _impl_.held_cards_.Clear();
+}
+Seat::Seat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sheepshead.model.Seat)
+}
+Seat::Seat(const Seat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Seat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.held_cards_){from._impl_.held_cards_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:sheepshead.model.Seat)
+}
+
+inline void Seat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.held_cards_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Seat::~Seat() {
+  // @@protoc_insertion_point(destructor:sheepshead.model.Seat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Seat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.held_cards_.~RepeatedPtrField();
+}
+
+void Seat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Seat::Clear() {
+// @@protoc_insertion_point(message_clear_start:sheepshead.model.Seat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.held_cards_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Seat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .sheepshead.model.Card held_cards = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_held_cards(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Seat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sheepshead.model.Seat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .sheepshead.model.Card held_cards = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_held_cards_size()); i < n; i++) {
+    const auto& repfield = this->_internal_held_cards(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sheepshead.model.Seat)
+  return target;
+}
+
+size_t Seat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sheepshead.model.Seat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sheepshead.model.Card held_cards = 1;
+  total_size += 1UL * this->_internal_held_cards_size();
+  for (const auto& msg : this->_impl_.held_cards_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Seat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Seat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Seat::GetClassData() const { return &_class_data_; }
+
+
+void Seat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Seat*>(&to_msg);
+  auto& from = static_cast<const Seat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sheepshead.model.Seat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.held_cards_.MergeFrom(from._impl_.held_cards_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Seat::CopyFrom(const Seat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sheepshead.model.Seat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Seat::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.held_cards_))
+    return false;
+  return true;
+}
+
+void Seat::InternalSwap(Seat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.held_cards_.InternalSwap(&other->_impl_.held_cards_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Seat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[1]);
+}
+
+// ===================================================================
+
+class Trick::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Trick>()._impl_._has_bits_);
+  static void set_has_leader_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+void Trick::clear_laid_cards() {
+  _impl_.laid_cards_.Clear();
+}
+Trick::Trick(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sheepshead.model.Trick)
+}
+Trick::Trick(const Trick& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Trick* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.laid_cards_){from._impl_.laid_cards_}
+    , decltype(_impl_.leader_position_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.leader_position_ = from._impl_.leader_position_;
+  // @@protoc_insertion_point(copy_constructor:sheepshead.model.Trick)
+}
+
+inline void Trick::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.laid_cards_){arena}
+    , decltype(_impl_.leader_position_){0}
+  };
+}
+
+Trick::~Trick() {
+  // @@protoc_insertion_point(destructor:sheepshead.model.Trick)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Trick::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.laid_cards_.~RepeatedPtrField();
+}
+
+void Trick::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Trick::Clear() {
+// @@protoc_insertion_point(message_clear_start:sheepshead.model.Trick)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.laid_cards_.Clear();
+  _impl_.leader_position_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Trick::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 leader_position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_leader_position(&has_bits);
+          _impl_.leader_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sheepshead.model.Card laid_cards = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_laid_cards(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Trick::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sheepshead.model.Trick)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 leader_position = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_leader_position(), target);
+  }
+
+  // repeated .sheepshead.model.Card laid_cards = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_laid_cards_size()); i < n; i++) {
+    const auto& repfield = this->_internal_laid_cards(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sheepshead.model.Trick)
+  return target;
+}
+
+size_t Trick::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sheepshead.model.Trick)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sheepshead.model.Card laid_cards = 2;
+  total_size += 1UL * this->_internal_laid_cards_size();
+  for (const auto& msg : this->_impl_.laid_cards_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional int32 leader_position = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leader_position());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Trick::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Trick::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Trick::GetClassData() const { return &_class_data_; }
+
+
+void Trick::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Trick*>(&to_msg);
+  auto& from = static_cast<const Trick&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sheepshead.model.Trick)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.laid_cards_.MergeFrom(from._impl_.laid_cards_);
+  if (from._internal_has_leader_position()) {
+    _this->_internal_set_leader_position(from._internal_leader_position());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Trick::CopyFrom(const Trick& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sheepshead.model.Trick)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Trick::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.laid_cards_))
+    return false;
+  return true;
+}
+
+void Trick::InternalSwap(Trick* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.laid_cards_.InternalSwap(&other->_impl_.laid_cards_);
+  swap(_impl_.leader_position_, other->_impl_.leader_position_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Trick::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[2]);
+}
+
+// ===================================================================
+
+class PickingRound::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PickingRound>()._impl_._has_bits_);
+  static void set_has_leader_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_loner_decision(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::sheepshead::model::Card& partner_card(const PickingRound* msg);
+  static void set_has_partner_card(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_unknown_decision_made(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::sheepshead::model::Card&
+PickingRound::_Internal::partner_card(const PickingRound* msg) {
+  return *msg->_impl_.partner_card_;
+}
+void PickingRound::clear_partner_card() {
+  if (_impl_.partner_card_ != nullptr) _impl_.partner_card_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+void PickingRound::clear_discarded_cards() {
+  _impl_.discarded_cards_.Clear();
+}
+void PickingRound::clear_blinds() {
+  _impl_.blinds_.Clear();
+}
+PickingRound::PickingRound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sheepshead.model.PickingRound)
+}
+PickingRound::PickingRound(const PickingRound& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PickingRound* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.picking_decisions_){from._impl_.picking_decisions_}
+    , decltype(_impl_.discarded_cards_){from._impl_.discarded_cards_}
+    , decltype(_impl_.blinds_){from._impl_.blinds_}
+    , decltype(_impl_.partner_card_){nullptr}
+    , decltype(_impl_.leader_position_){}
+    , decltype(_impl_.loner_decision_){}
+    , decltype(_impl_.unknown_decision_made_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_partner_card()) {
+    _this->_impl_.partner_card_ = new ::sheepshead::model::Card(*from._impl_.partner_card_);
+  }
+  ::memcpy(&_impl_.leader_position_, &from._impl_.leader_position_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unknown_decision_made_) -
+    reinterpret_cast<char*>(&_impl_.leader_position_)) + sizeof(_impl_.unknown_decision_made_));
+  // @@protoc_insertion_point(copy_constructor:sheepshead.model.PickingRound)
+}
+
+inline void PickingRound::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.picking_decisions_){arena}
+    , decltype(_impl_.discarded_cards_){arena}
+    , decltype(_impl_.blinds_){arena}
+    , decltype(_impl_.partner_card_){nullptr}
+    , decltype(_impl_.leader_position_){0}
+    , decltype(_impl_.loner_decision_){0}
+    , decltype(_impl_.unknown_decision_made_){false}
+  };
+}
+
+PickingRound::~PickingRound() {
+  // @@protoc_insertion_point(destructor:sheepshead.model.PickingRound)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PickingRound::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.picking_decisions_.~RepeatedField();
+  _impl_.discarded_cards_.~RepeatedPtrField();
+  _impl_.blinds_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.partner_card_;
+}
+
+void PickingRound::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PickingRound::Clear() {
+// @@protoc_insertion_point(message_clear_start:sheepshead.model.PickingRound)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.picking_decisions_.Clear();
+  _impl_.discarded_cards_.Clear();
+  _impl_.blinds_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.partner_card_ != nullptr);
+    _impl_.partner_card_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.leader_position_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.unknown_decision_made_) -
+        reinterpret_cast<char*>(&_impl_.leader_position_)) + sizeof(_impl_.unknown_decision_made_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PickingRound::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 leader_position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_leader_position(&has_bits);
+          _impl_.leader_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sheepshead.model.PickingRound.PickingDecision picking_decisions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::sheepshead::model::PickingRound_PickingDecision_IsValid(val))) {
+              _internal_add_picking_decisions(static_cast<::sheepshead::model::PickingRound_PickingDecision>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_picking_decisions(), ptr, ctx, ::sheepshead::model::PickingRound_PickingDecision_IsValid, &_internal_metadata_, 2);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sheepshead.model.PickingRound.LonerDecision loner_decision = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sheepshead::model::PickingRound_LonerDecision_IsValid(val))) {
+            _internal_set_loner_decision(static_cast<::sheepshead::model::PickingRound_LonerDecision>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sheepshead.model.Card partner_card = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_partner_card(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool unknown_decision_made = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_unknown_decision_made(&has_bits);
+          _impl_.unknown_decision_made_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sheepshead.model.Card discarded_cards = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_discarded_cards(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sheepshead.model.Card blinds = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blinds(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PickingRound::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sheepshead.model.PickingRound)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 leader_position = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_leader_position(), target);
+  }
+
+  // repeated .sheepshead.model.PickingRound.PickingDecision picking_decisions = 2;
+  for (int i = 0, n = this->_internal_picking_decisions_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        2, this->_internal_picking_decisions(i), target);
+  }
+
+  // optional .sheepshead.model.PickingRound.LonerDecision loner_decision = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_loner_decision(), target);
+  }
+
+  // optional .sheepshead.model.Card partner_card = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::partner_card(this),
+        _Internal::partner_card(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool unknown_decision_made = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_unknown_decision_made(), target);
+  }
+
+  // repeated .sheepshead.model.Card discarded_cards = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_discarded_cards_size()); i < n; i++) {
+    const auto& repfield = this->_internal_discarded_cards(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .sheepshead.model.Card blinds = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blinds_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blinds(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sheepshead.model.PickingRound)
+  return target;
+}
+
+size_t PickingRound::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sheepshead.model.PickingRound)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sheepshead.model.PickingRound.PickingDecision picking_decisions = 2;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_picking_decisions_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_picking_decisions(static_cast<int>(i)));
+    }
+    total_size += (1UL * count) + data_size;
+  }
+
+  // repeated .sheepshead.model.Card discarded_cards = 6;
+  total_size += 1UL * this->_internal_discarded_cards_size();
+  for (const auto& msg : this->_impl_.discarded_cards_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .sheepshead.model.Card blinds = 7;
+  total_size += 1UL * this->_internal_blinds_size();
+  for (const auto& msg : this->_impl_.blinds_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .sheepshead.model.Card partner_card = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.partner_card_);
+    }
+
+    // optional int32 leader_position = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leader_position());
+    }
+
+    // optional .sheepshead.model.PickingRound.LonerDecision loner_decision = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_loner_decision());
+    }
+
+    // optional bool unknown_decision_made = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PickingRound::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PickingRound::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PickingRound::GetClassData() const { return &_class_data_; }
+
+
+void PickingRound::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PickingRound*>(&to_msg);
+  auto& from = static_cast<const PickingRound&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sheepshead.model.PickingRound)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.picking_decisions_.MergeFrom(from._impl_.picking_decisions_);
+  _this->_impl_.discarded_cards_.MergeFrom(from._impl_.discarded_cards_);
+  _this->_impl_.blinds_.MergeFrom(from._impl_.blinds_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_partner_card()->::sheepshead::model::Card::MergeFrom(
+          from._internal_partner_card());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.leader_position_ = from._impl_.leader_position_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.loner_decision_ = from._impl_.loner_decision_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.unknown_decision_made_ = from._impl_.unknown_decision_made_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PickingRound::CopyFrom(const PickingRound& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sheepshead.model.PickingRound)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PickingRound::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.discarded_cards_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.blinds_))
+    return false;
+  if (_internal_has_partner_card()) {
+    if (!_impl_.partner_card_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PickingRound::InternalSwap(PickingRound* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.picking_decisions_.InternalSwap(&other->_impl_.picking_decisions_);
+  _impl_.discarded_cards_.InternalSwap(&other->_impl_.discarded_cards_);
+  _impl_.blinds_.InternalSwap(&other->_impl_.blinds_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PickingRound, _impl_.unknown_decision_made_)
+      + sizeof(PickingRound::_impl_.unknown_decision_made_)
+      - PROTOBUF_FIELD_OFFSET(PickingRound, _impl_.partner_card_)>(
+          reinterpret_cast<char*>(&_impl_.partner_card_),
+          reinterpret_cast<char*>(&other->_impl_.partner_card_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PickingRound::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace model
+}  // namespace sheepshead
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::sheepshead::model::Hand*
+Arena::CreateMaybeMessage< ::sheepshead::model::Hand >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sheepshead::model::Hand >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sheepshead::model::Seat*
+Arena::CreateMaybeMessage< ::sheepshead::model::Seat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sheepshead::model::Seat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sheepshead::model::Trick*
+Arena::CreateMaybeMessage< ::sheepshead::model::Trick >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sheepshead::model::Trick >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sheepshead::model::PickingRound*
+Arena::CreateMaybeMessage< ::sheepshead::model::PickingRound >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sheepshead::model::PickingRound >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
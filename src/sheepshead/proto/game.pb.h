@@ -0,0 +1,1725 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: game.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_game_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_game_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "rule_variation.pb.h"
+#include "deck.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_game_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_game_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_game_2eproto;
+namespace sheepshead {
+namespace model {
+class Hand;
+struct HandDefaultTypeInternal;
+extern HandDefaultTypeInternal _Hand_default_instance_;
+class PickingRound;
+struct PickingRoundDefaultTypeInternal;
+extern PickingRoundDefaultTypeInternal _PickingRound_default_instance_;
+class Seat;
+struct SeatDefaultTypeInternal;
+extern SeatDefaultTypeInternal _Seat_default_instance_;
+class Trick;
+struct TrickDefaultTypeInternal;
+extern TrickDefaultTypeInternal _Trick_default_instance_;
+}  // namespace model
+}  // namespace sheepshead
+PROTOBUF_NAMESPACE_OPEN
+template<> ::sheepshead::model::Hand* Arena::CreateMaybeMessage<::sheepshead::model::Hand>(Arena*);
+template<> ::sheepshead::model::PickingRound* Arena::CreateMaybeMessage<::sheepshead::model::PickingRound>(Arena*);
+template<> ::sheepshead::model::Seat* Arena::CreateMaybeMessage<::sheepshead::model::Seat>(Arena*);
+template<> ::sheepshead::model::Trick* Arena::CreateMaybeMessage<::sheepshead::model::Trick>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace sheepshead {
+namespace model {
+
+enum PickingRound_PickingDecision : int {
+  PickingRound_PickingDecision_PICK = 0,
+  PickingRound_PickingDecision_PASS = 1
+};
+bool PickingRound_PickingDecision_IsValid(int value);
+constexpr PickingRound_PickingDecision PickingRound_PickingDecision_PickingDecision_MIN = PickingRound_PickingDecision_PICK;
+constexpr PickingRound_PickingDecision PickingRound_PickingDecision_PickingDecision_MAX = PickingRound_PickingDecision_PASS;
+constexpr int PickingRound_PickingDecision_PickingDecision_ARRAYSIZE = PickingRound_PickingDecision_PickingDecision_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PickingRound_PickingDecision_descriptor();
+template<typename T>
+inline const std::string& PickingRound_PickingDecision_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PickingRound_PickingDecision>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PickingRound_PickingDecision_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PickingRound_PickingDecision_descriptor(), enum_t_value);
+}
+inline bool PickingRound_PickingDecision_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PickingRound_PickingDecision* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PickingRound_PickingDecision>(
+    PickingRound_PickingDecision_descriptor(), name, value);
+}
+enum PickingRound_LonerDecision : int {
+  PickingRound_LonerDecision_PARTNER = 0,
+  PickingRound_LonerDecision_LONER = 1
+};
+bool PickingRound_LonerDecision_IsValid(int value);
+constexpr PickingRound_LonerDecision PickingRound_LonerDecision_LonerDecision_MIN = PickingRound_LonerDecision_PARTNER;
+constexpr PickingRound_LonerDecision PickingRound_LonerDecision_LonerDecision_MAX = PickingRound_LonerDecision_LONER;
+constexpr int PickingRound_LonerDecision_LonerDecision_ARRAYSIZE = PickingRound_LonerDecision_LonerDecision_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PickingRound_LonerDecision_descriptor();
+template<typename T>
+inline const std::string& PickingRound_LonerDecision_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PickingRound_LonerDecision>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PickingRound_LonerDecision_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PickingRound_LonerDecision_descriptor(), enum_t_value);
+}
+inline bool PickingRound_LonerDecision_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PickingRound_LonerDecision* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PickingRound_LonerDecision>(
+    PickingRound_LonerDecision_descriptor(), name, value);
+}
+// ===================================================================
+
+class Hand final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sheepshead.model.Hand) */ {
+ public:
+  inline Hand() : Hand(nullptr) {}
+  ~Hand() override;
+  explicit PROTOBUF_CONSTEXPR Hand(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Hand(const Hand& from);
+  Hand(Hand&& from) noexcept
+    : Hand() {
+    *this = ::std::move(from);
+  }
+
+  inline Hand& operator=(const Hand& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Hand& operator=(Hand&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Hand& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Hand* internal_default_instance() {
+    return reinterpret_cast<const Hand*>(
+               &_Hand_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Hand& a, Hand& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Hand* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Hand* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Hand* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Hand>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Hand& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Hand& from) {
+    Hand::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Hand* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sheepshead.model.Hand";
+  }
+  protected:
+  explicit Hand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTricksFieldNumber = 3,
+    kSeatsFieldNumber = 5,
+    kRuleVariationFieldNumber = 1,
+    kPickingRoundFieldNumber = 4,
+  };
+  // repeated .sheepshead.model.Trick tricks = 3;
+  int tricks_size() const;
+  private:
+  int _internal_tricks_size() const;
+  public:
+  void clear_tricks();
+  ::sheepshead::model::Trick* mutable_tricks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Trick >*
+      mutable_tricks();
+  private:
+  const ::sheepshead::model::Trick& _internal_tricks(int index) const;
+  ::sheepshead::model::Trick* _internal_add_tricks();
+  public:
+  const ::sheepshead::model::Trick& tricks(int index) const;
+  ::sheepshead::model::Trick* add_tricks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Trick >&
+      tricks() const;
+
+  // repeated .sheepshead.model.Seat seats = 5;
+  int seats_size() const;
+  private:
+  int _internal_seats_size() const;
+  public:
+  void clear_seats();
+  ::sheepshead::model::Seat* mutable_seats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Seat >*
+      mutable_seats();
+  private:
+  const ::sheepshead::model::Seat& _internal_seats(int index) const;
+  ::sheepshead::model::Seat* _internal_add_seats();
+  public:
+  const ::sheepshead::model::Seat& seats(int index) const;
+  ::sheepshead::model::Seat* add_seats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Seat >&
+      seats() const;
+
+  // required .sheepshead.model.RuleVariation rule_variation = 1;
+  bool has_rule_variation() const;
+  private:
+  bool _internal_has_rule_variation() const;
+  public:
+  void clear_rule_variation();
+  const ::sheepshead::model::RuleVariation& rule_variation() const;
+  PROTOBUF_NODISCARD ::sheepshead::model::RuleVariation* release_rule_variation();
+  ::sheepshead::model::RuleVariation* mutable_rule_variation();
+  void set_allocated_rule_variation(::sheepshead::model::RuleVariation* rule_variation);
+  private:
+  const ::sheepshead::model::RuleVariation& _internal_rule_variation() const;
+  ::sheepshead::model::RuleVariation* _internal_mutable_rule_variation();
+  public:
+  void unsafe_arena_set_allocated_rule_variation(
+      ::sheepshead::model::RuleVariation* rule_variation);
+  ::sheepshead::model::RuleVariation* unsafe_arena_release_rule_variation();
+
+  // optional .sheepshead.model.PickingRound picking_round = 4;
+  bool has_picking_round() const;
+  private:
+  bool _internal_has_picking_round() const;
+  public:
+  void clear_picking_round();
+  const ::sheepshead::model::PickingRound& picking_round() const;
+  PROTOBUF_NODISCARD ::sheepshead::model::PickingRound* release_picking_round();
+  ::sheepshead::model::PickingRound* mutable_picking_round();
+  void set_allocated_picking_round(::sheepshead::model::PickingRound* picking_round);
+  private:
+  const ::sheepshead::model::PickingRound& _internal_picking_round() const;
+  ::sheepshead::model::PickingRound* _internal_mutable_picking_round();
+  public:
+  void unsafe_arena_set_allocated_picking_round(
+      ::sheepshead::model::PickingRound* picking_round);
+  ::sheepshead::model::PickingRound* unsafe_arena_release_picking_round();
+
+  // @@protoc_insertion_point(class_scope:sheepshead.model.Hand)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Trick > tricks_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Seat > seats_;
+    ::sheepshead::model::RuleVariation* rule_variation_;
+    ::sheepshead::model::PickingRound* picking_round_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Seat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sheepshead.model.Seat) */ {
+ public:
+  inline Seat() : Seat(nullptr) {}
+  ~Seat() override;
+  explicit PROTOBUF_CONSTEXPR Seat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Seat(const Seat& from);
+  Seat(Seat&& from) noexcept
+    : Seat() {
+    *this = ::std::move(from);
+  }
+
+  inline Seat& operator=(const Seat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Seat& operator=(Seat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Seat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Seat* internal_default_instance() {
+    return reinterpret_cast<const Seat*>(
+               &_Seat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Seat& a, Seat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Seat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Seat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Seat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Seat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Seat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Seat& from) {
+    Seat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Seat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sheepshead.model.Seat";
+  }
+  protected:
+  explicit Seat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeldCardsFieldNumber = 1,
+  };
+  // repeated .sheepshead.model.Card held_cards = 1;
+  int held_cards_size() const;
+  private:
+  int _internal_held_cards_size() const;
+  public:
+  void clear_held_cards();
+  ::sheepshead::model::Card* mutable_held_cards(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+      mutable_held_cards();
+  private:
+  const ::sheepshead::model::Card& _internal_held_cards(int index) const;
+  ::sheepshead::model::Card* _internal_add_held_cards();
+  public:
+  const ::sheepshead::model::Card& held_cards(int index) const;
+  ::sheepshead::model::Card* add_held_cards();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+      held_cards() const;
+
+  // @@protoc_insertion_point(class_scope:sheepshead.model.Seat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card > held_cards_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Trick final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sheepshead.model.Trick) */ {
+ public:
+  inline Trick() : Trick(nullptr) {}
+  ~Trick() override;
+  explicit PROTOBUF_CONSTEXPR Trick(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Trick(const Trick& from);
+  Trick(Trick&& from) noexcept
+    : Trick() {
+    *this = ::std::move(from);
+  }
+
+  inline Trick& operator=(const Trick& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Trick& operator=(Trick&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Trick& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Trick* internal_default_instance() {
+    return reinterpret_cast<const Trick*>(
+               &_Trick_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Trick& a, Trick& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Trick* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Trick* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Trick* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Trick>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Trick& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Trick& from) {
+    Trick::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Trick* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sheepshead.model.Trick";
+  }
+  protected:
+  explicit Trick(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLaidCardsFieldNumber = 2,
+    kLeaderPositionFieldNumber = 1,
+  };
+  // repeated .sheepshead.model.Card laid_cards = 2;
+  int laid_cards_size() const;
+  private:
+  int _internal_laid_cards_size() const;
+  public:
+  void clear_laid_cards();
+  ::sheepshead::model::Card* mutable_laid_cards(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+      mutable_laid_cards();
+  private:
+  const ::sheepshead::model::Card& _internal_laid_cards(int index) const;
+  ::sheepshead::model::Card* _internal_add_laid_cards();
+  public:
+  const ::sheepshead::model::Card& laid_cards(int index) const;
+  ::sheepshead::model::Card* add_laid_cards();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+      laid_cards() const;
+
+  // optional int32 leader_position = 1;
+  bool has_leader_position() const;
+  private:
+  bool _internal_has_leader_position() const;
+  public:
+  void clear_leader_position();
+  int32_t leader_position() const;
+  void set_leader_position(int32_t value);
+  private:
+  int32_t _internal_leader_position() const;
+  void _internal_set_leader_position(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sheepshead.model.Trick)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card > laid_cards_;
+    int32_t leader_position_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PickingRound final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sheepshead.model.PickingRound) */ {
+ public:
+  inline PickingRound() : PickingRound(nullptr) {}
+  ~PickingRound() override;
+  explicit PROTOBUF_CONSTEXPR PickingRound(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PickingRound(const PickingRound& from);
+  PickingRound(PickingRound&& from) noexcept
+    : PickingRound() {
+    *this = ::std::move(from);
+  }
+
+  inline PickingRound& operator=(const PickingRound& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PickingRound& operator=(PickingRound&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PickingRound& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PickingRound* internal_default_instance() {
+    return reinterpret_cast<const PickingRound*>(
+               &_PickingRound_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(PickingRound& a, PickingRound& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PickingRound* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PickingRound* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PickingRound* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PickingRound>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PickingRound& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PickingRound& from) {
+    PickingRound::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PickingRound* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sheepshead.model.PickingRound";
+  }
+  protected:
+  explicit PickingRound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef PickingRound_PickingDecision PickingDecision;
+  static constexpr PickingDecision PICK =
+    PickingRound_PickingDecision_PICK;
+  static constexpr PickingDecision PASS =
+    PickingRound_PickingDecision_PASS;
+  static inline bool PickingDecision_IsValid(int value) {
+    return PickingRound_PickingDecision_IsValid(value);
+  }
+  static constexpr PickingDecision PickingDecision_MIN =
+    PickingRound_PickingDecision_PickingDecision_MIN;
+  static constexpr PickingDecision PickingDecision_MAX =
+    PickingRound_PickingDecision_PickingDecision_MAX;
+  static constexpr int PickingDecision_ARRAYSIZE =
+    PickingRound_PickingDecision_PickingDecision_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  PickingDecision_descriptor() {
+    return PickingRound_PickingDecision_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& PickingDecision_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, PickingDecision>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function PickingDecision_Name.");
+    return PickingRound_PickingDecision_Name(enum_t_value);
+  }
+  static inline bool PickingDecision_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      PickingDecision* value) {
+    return PickingRound_PickingDecision_Parse(name, value);
+  }
+
+  typedef PickingRound_LonerDecision LonerDecision;
+  static constexpr LonerDecision PARTNER =
+    PickingRound_LonerDecision_PARTNER;
+  static constexpr LonerDecision LONER =
+    PickingRound_LonerDecision_LONER;
+  static inline bool LonerDecision_IsValid(int value) {
+    return PickingRound_LonerDecision_IsValid(value);
+  }
+  static constexpr LonerDecision LonerDecision_MIN =
+    PickingRound_LonerDecision_LonerDecision_MIN;
+  static constexpr LonerDecision LonerDecision_MAX =
+    PickingRound_LonerDecision_LonerDecision_MAX;
+  static constexpr int LonerDecision_ARRAYSIZE =
+    PickingRound_LonerDecision_LonerDecision_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  LonerDecision_descriptor() {
+    return PickingRound_LonerDecision_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& LonerDecision_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, LonerDecision>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function LonerDecision_Name.");
+    return PickingRound_LonerDecision_Name(enum_t_value);
+  }
+  static inline bool LonerDecision_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      LonerDecision* value) {
+    return PickingRound_LonerDecision_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPickingDecisionsFieldNumber = 2,
+    kDiscardedCardsFieldNumber = 6,
+    kBlindsFieldNumber = 7,
+    kPartnerCardFieldNumber = 4,
+    kLeaderPositionFieldNumber = 1,
+    kLonerDecisionFieldNumber = 3,
+    kUnknownDecisionMadeFieldNumber = 5,
+  };
+  // repeated .sheepshead.model.PickingRound.PickingDecision picking_decisions = 2;
+  int picking_decisions_size() const;
+  private:
+  int _internal_picking_decisions_size() const;
+  public:
+  void clear_picking_decisions();
+  private:
+  ::sheepshead::model::PickingRound_PickingDecision _internal_picking_decisions(int index) const;
+  void _internal_add_picking_decisions(::sheepshead::model::PickingRound_PickingDecision value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_picking_decisions();
+  public:
+  ::sheepshead::model::PickingRound_PickingDecision picking_decisions(int index) const;
+  void set_picking_decisions(int index, ::sheepshead::model::PickingRound_PickingDecision value);
+  void add_picking_decisions(::sheepshead::model::PickingRound_PickingDecision value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& picking_decisions() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_picking_decisions();
+
+  // repeated .sheepshead.model.Card discarded_cards = 6;
+  int discarded_cards_size() const;
+  private:
+  int _internal_discarded_cards_size() const;
+  public:
+  void clear_discarded_cards();
+  ::sheepshead::model::Card* mutable_discarded_cards(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+      mutable_discarded_cards();
+  private:
+  const ::sheepshead::model::Card& _internal_discarded_cards(int index) const;
+  ::sheepshead::model::Card* _internal_add_discarded_cards();
+  public:
+  const ::sheepshead::model::Card& discarded_cards(int index) const;
+  ::sheepshead::model::Card* add_discarded_cards();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+      discarded_cards() const;
+
+  // repeated .sheepshead.model.Card blinds = 7;
+  int blinds_size() const;
+  private:
+  int _internal_blinds_size() const;
+  public:
+  void clear_blinds();
+  ::sheepshead::model::Card* mutable_blinds(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+      mutable_blinds();
+  private:
+  const ::sheepshead::model::Card& _internal_blinds(int index) const;
+  ::sheepshead::model::Card* _internal_add_blinds();
+  public:
+  const ::sheepshead::model::Card& blinds(int index) const;
+  ::sheepshead::model::Card* add_blinds();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+      blinds() const;
+
+  // optional .sheepshead.model.Card partner_card = 4;
+  bool has_partner_card() const;
+  private:
+  bool _internal_has_partner_card() const;
+  public:
+  void clear_partner_card();
+  const ::sheepshead::model::Card& partner_card() const;
+  PROTOBUF_NODISCARD ::sheepshead::model::Card* release_partner_card();
+  ::sheepshead::model::Card* mutable_partner_card();
+  void set_allocated_partner_card(::sheepshead::model::Card* partner_card);
+  private:
+  const ::sheepshead::model::Card& _internal_partner_card() const;
+  ::sheepshead::model::Card* _internal_mutable_partner_card();
+  public:
+  void unsafe_arena_set_allocated_partner_card(
+      ::sheepshead::model::Card* partner_card);
+  ::sheepshead::model::Card* unsafe_arena_release_partner_card();
+
+  // optional int32 leader_position = 1;
+  bool has_leader_position() const;
+  private:
+  bool _internal_has_leader_position() const;
+  public:
+  void clear_leader_position();
+  int32_t leader_position() const;
+  void set_leader_position(int32_t value);
+  private:
+  int32_t _internal_leader_position() const;
+  void _internal_set_leader_position(int32_t value);
+  public:
+
+  // optional .sheepshead.model.PickingRound.LonerDecision loner_decision = 3;
+  bool has_loner_decision() const;
+  private:
+  bool _internal_has_loner_decision() const;
+  public:
+  void clear_loner_decision();
+  ::sheepshead::model::PickingRound_LonerDecision loner_decision() const;
+  void set_loner_decision(::sheepshead::model::PickingRound_LonerDecision value);
+  private:
+  ::sheepshead::model::PickingRound_LonerDecision _internal_loner_decision() const;
+  void _internal_set_loner_decision(::sheepshead::model::PickingRound_LonerDecision value);
+  public:
+
+  // optional bool unknown_decision_made = 5;
+  bool has_unknown_decision_made() const;
+  private:
+  bool _internal_has_unknown_decision_made() const;
+  public:
+  void clear_unknown_decision_made();
+  bool unknown_decision_made() const;
+  void set_unknown_decision_made(bool value);
+  private:
+  bool _internal_unknown_decision_made() const;
+  void _internal_set_unknown_decision_made(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sheepshead.model.PickingRound)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> picking_decisions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card > discarded_cards_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card > blinds_;
+    ::sheepshead::model::Card* partner_card_;
+    int32_t leader_position_;
+    int loner_decision_;
+    bool unknown_decision_made_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Hand
+
+// required .sheepshead.model.RuleVariation rule_variation = 1;
+inline bool Hand::_internal_has_rule_variation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rule_variation_ != nullptr);
+  return value;
+}
+inline bool Hand::has_rule_variation() const {
+  return _internal_has_rule_variation();
+}
+inline const ::sheepshead::model::RuleVariation& Hand::_internal_rule_variation() const {
+  const ::sheepshead::model::RuleVariation* p = _impl_.rule_variation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sheepshead::model::RuleVariation&>(
+      ::sheepshead::model::_RuleVariation_default_instance_);
+}
+inline const ::sheepshead::model::RuleVariation& Hand::rule_variation() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Hand.rule_variation)
+  return _internal_rule_variation();
+}
+inline void Hand::unsafe_arena_set_allocated_rule_variation(
+    ::sheepshead::model::RuleVariation* rule_variation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rule_variation_);
+  }
+  _impl_.rule_variation_ = rule_variation;
+  if (rule_variation) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sheepshead.model.Hand.rule_variation)
+}
+inline ::sheepshead::model::RuleVariation* Hand::release_rule_variation() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::sheepshead::model::RuleVariation* temp = _impl_.rule_variation_;
+  _impl_.rule_variation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sheepshead::model::RuleVariation* Hand::unsafe_arena_release_rule_variation() {
+  // @@protoc_insertion_point(field_release:sheepshead.model.Hand.rule_variation)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::sheepshead::model::RuleVariation* temp = _impl_.rule_variation_;
+  _impl_.rule_variation_ = nullptr;
+  return temp;
+}
+inline ::sheepshead::model::RuleVariation* Hand::_internal_mutable_rule_variation() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.rule_variation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sheepshead::model::RuleVariation>(GetArenaForAllocation());
+    _impl_.rule_variation_ = p;
+  }
+  return _impl_.rule_variation_;
+}
+inline ::sheepshead::model::RuleVariation* Hand::mutable_rule_variation() {
+  ::sheepshead::model::RuleVariation* _msg = _internal_mutable_rule_variation();
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.Hand.rule_variation)
+  return _msg;
+}
+inline void Hand::set_allocated_rule_variation(::sheepshead::model::RuleVariation* rule_variation) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rule_variation_);
+  }
+  if (rule_variation) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(rule_variation));
+    if (message_arena != submessage_arena) {
+      rule_variation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rule_variation, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.rule_variation_ = rule_variation;
+  // @@protoc_insertion_point(field_set_allocated:sheepshead.model.Hand.rule_variation)
+}
+
+// optional .sheepshead.model.PickingRound picking_round = 4;
+inline bool Hand::_internal_has_picking_round() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.picking_round_ != nullptr);
+  return value;
+}
+inline bool Hand::has_picking_round() const {
+  return _internal_has_picking_round();
+}
+inline void Hand::clear_picking_round() {
+  if (_impl_.picking_round_ != nullptr) _impl_.picking_round_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::sheepshead::model::PickingRound& Hand::_internal_picking_round() const {
+  const ::sheepshead::model::PickingRound* p = _impl_.picking_round_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sheepshead::model::PickingRound&>(
+      ::sheepshead::model::_PickingRound_default_instance_);
+}
+inline const ::sheepshead::model::PickingRound& Hand::picking_round() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Hand.picking_round)
+  return _internal_picking_round();
+}
+inline void Hand::unsafe_arena_set_allocated_picking_round(
+    ::sheepshead::model::PickingRound* picking_round) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.picking_round_);
+  }
+  _impl_.picking_round_ = picking_round;
+  if (picking_round) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sheepshead.model.Hand.picking_round)
+}
+inline ::sheepshead::model::PickingRound* Hand::release_picking_round() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::sheepshead::model::PickingRound* temp = _impl_.picking_round_;
+  _impl_.picking_round_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sheepshead::model::PickingRound* Hand::unsafe_arena_release_picking_round() {
+  // @@protoc_insertion_point(field_release:sheepshead.model.Hand.picking_round)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::sheepshead::model::PickingRound* temp = _impl_.picking_round_;
+  _impl_.picking_round_ = nullptr;
+  return temp;
+}
+inline ::sheepshead::model::PickingRound* Hand::_internal_mutable_picking_round() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.picking_round_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sheepshead::model::PickingRound>(GetArenaForAllocation());
+    _impl_.picking_round_ = p;
+  }
+  return _impl_.picking_round_;
+}
+inline ::sheepshead::model::PickingRound* Hand::mutable_picking_round() {
+  ::sheepshead::model::PickingRound* _msg = _internal_mutable_picking_round();
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.Hand.picking_round)
+  return _msg;
+}
+inline void Hand::set_allocated_picking_round(::sheepshead::model::PickingRound* picking_round) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.picking_round_;
+  }
+  if (picking_round) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(picking_round);
+    if (message_arena != submessage_arena) {
+      picking_round = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, picking_round, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.picking_round_ = picking_round;
+  // @@protoc_insertion_point(field_set_allocated:sheepshead.model.Hand.picking_round)
+}
+
+// repeated .sheepshead.model.Trick tricks = 3;
+inline int Hand::_internal_tricks_size() const {
+  return _impl_.tricks_.size();
+}
+inline int Hand::tricks_size() const {
+  return _internal_tricks_size();
+}
+inline void Hand::clear_tricks() {
+  _impl_.tricks_.Clear();
+}
+inline ::sheepshead::model::Trick* Hand::mutable_tricks(int index) {
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.Hand.tricks)
+  return _impl_.tricks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Trick >*
+Hand::mutable_tricks() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.Hand.tricks)
+  return &_impl_.tricks_;
+}
+inline const ::sheepshead::model::Trick& Hand::_internal_tricks(int index) const {
+  return _impl_.tricks_.Get(index);
+}
+inline const ::sheepshead::model::Trick& Hand::tricks(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Hand.tricks)
+  return _internal_tricks(index);
+}
+inline ::sheepshead::model::Trick* Hand::_internal_add_tricks() {
+  return _impl_.tricks_.Add();
+}
+inline ::sheepshead::model::Trick* Hand::add_tricks() {
+  ::sheepshead::model::Trick* _add = _internal_add_tricks();
+  // @@protoc_insertion_point(field_add:sheepshead.model.Hand.tricks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Trick >&
+Hand::tricks() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.Hand.tricks)
+  return _impl_.tricks_;
+}
+
+// repeated .sheepshead.model.Seat seats = 5;
+inline int Hand::_internal_seats_size() const {
+  return _impl_.seats_.size();
+}
+inline int Hand::seats_size() const {
+  return _internal_seats_size();
+}
+inline void Hand::clear_seats() {
+  _impl_.seats_.Clear();
+}
+inline ::sheepshead::model::Seat* Hand::mutable_seats(int index) {
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.Hand.seats)
+  return _impl_.seats_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Seat >*
+Hand::mutable_seats() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.Hand.seats)
+  return &_impl_.seats_;
+}
+inline const ::sheepshead::model::Seat& Hand::_internal_seats(int index) const {
+  return _impl_.seats_.Get(index);
+}
+inline const ::sheepshead::model::Seat& Hand::seats(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Hand.seats)
+  return _internal_seats(index);
+}
+inline ::sheepshead::model::Seat* Hand::_internal_add_seats() {
+  return _impl_.seats_.Add();
+}
+inline ::sheepshead::model::Seat* Hand::add_seats() {
+  ::sheepshead::model::Seat* _add = _internal_add_seats();
+  // @@protoc_insertion_point(field_add:sheepshead.model.Hand.seats)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Seat >&
+Hand::seats() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.Hand.seats)
+  return _impl_.seats_;
+}
+
+// -------------------------------------------------------------------
+
+// Seat
+
+// repeated .sheepshead.model.Card held_cards = 1;
+inline int Seat::_internal_held_cards_size() const {
+  return _impl_.held_cards_.size();
+}
+inline int Seat::held_cards_size() const {
+  return _internal_held_cards_size();
+}
+inline ::sheepshead::model::Card* Seat::mutable_held_cards(int index) {
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.Seat.held_cards)
+  return _impl_.held_cards_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+Seat::mutable_held_cards() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.Seat.held_cards)
+  return &_impl_.held_cards_;
+}
+inline const ::sheepshead::model::Card& Seat::_internal_held_cards(int index) const {
+  return _impl_.held_cards_.Get(index);
+}
+inline const ::sheepshead::model::Card& Seat::held_cards(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Seat.held_cards)
+  return _internal_held_cards(index);
+}
+inline ::sheepshead::model::Card* Seat::_internal_add_held_cards() {
+  return _impl_.held_cards_.Add();
+}
+inline ::sheepshead::model::Card* Seat::add_held_cards() {
+  ::sheepshead::model::Card* _add = _internal_add_held_cards();
+  // @@protoc_insertion_point(field_add:sheepshead.model.Seat.held_cards)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+Seat::held_cards() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.Seat.held_cards)
+  return _impl_.held_cards_;
+}
+
+// -------------------------------------------------------------------
+
+// Trick
+
+// optional int32 leader_position = 1;
+inline bool Trick::_internal_has_leader_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Trick::has_leader_position() const {
+  return _internal_has_leader_position();
+}
+inline void Trick::clear_leader_position() {
+  _impl_.leader_position_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t Trick::_internal_leader_position() const {
+  return _impl_.leader_position_;
+}
+inline int32_t Trick::leader_position() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Trick.leader_position)
+  return _internal_leader_position();
+}
+inline void Trick::_internal_set_leader_position(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.leader_position_ = value;
+}
+inline void Trick::set_leader_position(int32_t value) {
+  _internal_set_leader_position(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.Trick.leader_position)
+}
+
+// repeated .sheepshead.model.Card laid_cards = 2;
+inline int Trick::_internal_laid_cards_size() const {
+  return _impl_.laid_cards_.size();
+}
+inline int Trick::laid_cards_size() const {
+  return _internal_laid_cards_size();
+}
+inline ::sheepshead::model::Card* Trick::mutable_laid_cards(int index) {
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.Trick.laid_cards)
+  return _impl_.laid_cards_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+Trick::mutable_laid_cards() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.Trick.laid_cards)
+  return &_impl_.laid_cards_;
+}
+inline const ::sheepshead::model::Card& Trick::_internal_laid_cards(int index) const {
+  return _impl_.laid_cards_.Get(index);
+}
+inline const ::sheepshead::model::Card& Trick::laid_cards(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.Trick.laid_cards)
+  return _internal_laid_cards(index);
+}
+inline ::sheepshead::model::Card* Trick::_internal_add_laid_cards() {
+  return _impl_.laid_cards_.Add();
+}
+inline ::sheepshead::model::Card* Trick::add_laid_cards() {
+  ::sheepshead::model::Card* _add = _internal_add_laid_cards();
+  // @@protoc_insertion_point(field_add:sheepshead.model.Trick.laid_cards)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+Trick::laid_cards() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.Trick.laid_cards)
+  return _impl_.laid_cards_;
+}
+
+// -------------------------------------------------------------------
+
+// PickingRound
+
+// optional int32 leader_position = 1;
+inline bool PickingRound::_internal_has_leader_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PickingRound::has_leader_position() const {
+  return _internal_has_leader_position();
+}
+inline void PickingRound::clear_leader_position() {
+  _impl_.leader_position_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t PickingRound::_internal_leader_position() const {
+  return _impl_.leader_position_;
+}
+inline int32_t PickingRound::leader_position() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.PickingRound.leader_position)
+  return _internal_leader_position();
+}
+inline void PickingRound::_internal_set_leader_position(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.leader_position_ = value;
+}
+inline void PickingRound::set_leader_position(int32_t value) {
+  _internal_set_leader_position(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.PickingRound.leader_position)
+}
+
+// repeated .sheepshead.model.PickingRound.PickingDecision picking_decisions = 2;
+inline int PickingRound::_internal_picking_decisions_size() const {
+  return _impl_.picking_decisions_.size();
+}
+inline int PickingRound::picking_decisions_size() const {
+  return _internal_picking_decisions_size();
+}
+inline void PickingRound::clear_picking_decisions() {
+  _impl_.picking_decisions_.Clear();
+}
+inline ::sheepshead::model::PickingRound_PickingDecision PickingRound::_internal_picking_decisions(int index) const {
+  return static_cast< ::sheepshead::model::PickingRound_PickingDecision >(_impl_.picking_decisions_.Get(index));
+}
+inline ::sheepshead::model::PickingRound_PickingDecision PickingRound::picking_decisions(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.PickingRound.picking_decisions)
+  return _internal_picking_decisions(index);
+}
+inline void PickingRound::set_picking_decisions(int index, ::sheepshead::model::PickingRound_PickingDecision value) {
+  assert(::sheepshead::model::PickingRound_PickingDecision_IsValid(value));
+  _impl_.picking_decisions_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.PickingRound.picking_decisions)
+}
+inline void PickingRound::_internal_add_picking_decisions(::sheepshead::model::PickingRound_PickingDecision value) {
+  assert(::sheepshead::model::PickingRound_PickingDecision_IsValid(value));
+  _impl_.picking_decisions_.Add(value);
+}
+inline void PickingRound::add_picking_decisions(::sheepshead::model::PickingRound_PickingDecision value) {
+  _internal_add_picking_decisions(value);
+  // @@protoc_insertion_point(field_add:sheepshead.model.PickingRound.picking_decisions)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+PickingRound::picking_decisions() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.PickingRound.picking_decisions)
+  return _impl_.picking_decisions_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+PickingRound::_internal_mutable_picking_decisions() {
+  return &_impl_.picking_decisions_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+PickingRound::mutable_picking_decisions() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.PickingRound.picking_decisions)
+  return _internal_mutable_picking_decisions();
+}
+
+// optional .sheepshead.model.PickingRound.LonerDecision loner_decision = 3;
+inline bool PickingRound::_internal_has_loner_decision() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PickingRound::has_loner_decision() const {
+  return _internal_has_loner_decision();
+}
+inline void PickingRound::clear_loner_decision() {
+  _impl_.loner_decision_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::sheepshead::model::PickingRound_LonerDecision PickingRound::_internal_loner_decision() const {
+  return static_cast< ::sheepshead::model::PickingRound_LonerDecision >(_impl_.loner_decision_);
+}
+inline ::sheepshead::model::PickingRound_LonerDecision PickingRound::loner_decision() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.PickingRound.loner_decision)
+  return _internal_loner_decision();
+}
+inline void PickingRound::_internal_set_loner_decision(::sheepshead::model::PickingRound_LonerDecision value) {
+  assert(::sheepshead::model::PickingRound_LonerDecision_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.loner_decision_ = value;
+}
+inline void PickingRound::set_loner_decision(::sheepshead::model::PickingRound_LonerDecision value) {
+  _internal_set_loner_decision(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.PickingRound.loner_decision)
+}
+
+// optional .sheepshead.model.Card partner_card = 4;
+inline bool PickingRound::_internal_has_partner_card() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.partner_card_ != nullptr);
+  return value;
+}
+inline bool PickingRound::has_partner_card() const {
+  return _internal_has_partner_card();
+}
+inline const ::sheepshead::model::Card& PickingRound::_internal_partner_card() const {
+  const ::sheepshead::model::Card* p = _impl_.partner_card_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sheepshead::model::Card&>(
+      ::sheepshead::model::_Card_default_instance_);
+}
+inline const ::sheepshead::model::Card& PickingRound::partner_card() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.PickingRound.partner_card)
+  return _internal_partner_card();
+}
+inline void PickingRound::unsafe_arena_set_allocated_partner_card(
+    ::sheepshead::model::Card* partner_card) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.partner_card_);
+  }
+  _impl_.partner_card_ = partner_card;
+  if (partner_card) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sheepshead.model.PickingRound.partner_card)
+}
+inline ::sheepshead::model::Card* PickingRound::release_partner_card() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::sheepshead::model::Card* temp = _impl_.partner_card_;
+  _impl_.partner_card_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sheepshead::model::Card* PickingRound::unsafe_arena_release_partner_card() {
+  // @@protoc_insertion_point(field_release:sheepshead.model.PickingRound.partner_card)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::sheepshead::model::Card* temp = _impl_.partner_card_;
+  _impl_.partner_card_ = nullptr;
+  return temp;
+}
+inline ::sheepshead::model::Card* PickingRound::_internal_mutable_partner_card() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.partner_card_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sheepshead::model::Card>(GetArenaForAllocation());
+    _impl_.partner_card_ = p;
+  }
+  return _impl_.partner_card_;
+}
+inline ::sheepshead::model::Card* PickingRound::mutable_partner_card() {
+  ::sheepshead::model::Card* _msg = _internal_mutable_partner_card();
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.PickingRound.partner_card)
+  return _msg;
+}
+inline void PickingRound::set_allocated_partner_card(::sheepshead::model::Card* partner_card) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.partner_card_);
+  }
+  if (partner_card) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(partner_card));
+    if (message_arena != submessage_arena) {
+      partner_card = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, partner_card, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.partner_card_ = partner_card;
+  // @@protoc_insertion_point(field_set_allocated:sheepshead.model.PickingRound.partner_card)
+}
+
+// optional bool unknown_decision_made = 5;
+inline bool PickingRound::_internal_has_unknown_decision_made() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PickingRound::has_unknown_decision_made() const {
+  return _internal_has_unknown_decision_made();
+}
+inline void PickingRound::clear_unknown_decision_made() {
+  _impl_.unknown_decision_made_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool PickingRound::_internal_unknown_decision_made() const {
+  return _impl_.unknown_decision_made_;
+}
+inline bool PickingRound::unknown_decision_made() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.PickingRound.unknown_decision_made)
+  return _internal_unknown_decision_made();
+}
+inline void PickingRound::_internal_set_unknown_decision_made(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.unknown_decision_made_ = value;
+}
+inline void PickingRound::set_unknown_decision_made(bool value) {
+  _internal_set_unknown_decision_made(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.PickingRound.unknown_decision_made)
+}
+
+// repeated .sheepshead.model.Card discarded_cards = 6;
+inline int PickingRound::_internal_discarded_cards_size() const {
+  return _impl_.discarded_cards_.size();
+}
+inline int PickingRound::discarded_cards_size() const {
+  return _internal_discarded_cards_size();
+}
+inline ::sheepshead::model::Card* PickingRound::mutable_discarded_cards(int index) {
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.PickingRound.discarded_cards)
+  return _impl_.discarded_cards_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+PickingRound::mutable_discarded_cards() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.PickingRound.discarded_cards)
+  return &_impl_.discarded_cards_;
+}
+inline const ::sheepshead::model::Card& PickingRound::_internal_discarded_cards(int index) const {
+  return _impl_.discarded_cards_.Get(index);
+}
+inline const ::sheepshead::model::Card& PickingRound::discarded_cards(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.PickingRound.discarded_cards)
+  return _internal_discarded_cards(index);
+}
+inline ::sheepshead::model::Card* PickingRound::_internal_add_discarded_cards() {
+  return _impl_.discarded_cards_.Add();
+}
+inline ::sheepshead::model::Card* PickingRound::add_discarded_cards() {
+  ::sheepshead::model::Card* _add = _internal_add_discarded_cards();
+  // @@protoc_insertion_point(field_add:sheepshead.model.PickingRound.discarded_cards)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+PickingRound::discarded_cards() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.PickingRound.discarded_cards)
+  return _impl_.discarded_cards_;
+}
+
+// repeated .sheepshead.model.Card blinds = 7;
+inline int PickingRound::_internal_blinds_size() const {
+  return _impl_.blinds_.size();
+}
+inline int PickingRound::blinds_size() const {
+  return _internal_blinds_size();
+}
+inline ::sheepshead::model::Card* PickingRound::mutable_blinds(int index) {
+  // @@protoc_insertion_point(field_mutable:sheepshead.model.PickingRound.blinds)
+  return _impl_.blinds_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >*
+PickingRound::mutable_blinds() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.PickingRound.blinds)
+  return &_impl_.blinds_;
+}
+inline const ::sheepshead::model::Card& PickingRound::_internal_blinds(int index) const {
+  return _impl_.blinds_.Get(index);
+}
+inline const ::sheepshead::model::Card& PickingRound::blinds(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.PickingRound.blinds)
+  return _internal_blinds(index);
+}
+inline ::sheepshead::model::Card* PickingRound::_internal_add_blinds() {
+  return _impl_.blinds_.Add();
+}
+inline ::sheepshead::model::Card* PickingRound::add_blinds() {
+  ::sheepshead::model::Card* _add = _internal_add_blinds();
+  // @@protoc_insertion_point(field_add:sheepshead.model.PickingRound.blinds)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sheepshead::model::Card >&
+PickingRound::blinds() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.PickingRound.blinds)
+  return _impl_.blinds_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace model
+}  // namespace sheepshead
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::sheepshead::model::PickingRound_PickingDecision> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sheepshead::model::PickingRound_PickingDecision>() {
+  return ::sheepshead::model::PickingRound_PickingDecision_descriptor();
+}
+template <> struct is_proto_enum< ::sheepshead::model::PickingRound_LonerDecision> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sheepshead::model::PickingRound_LonerDecision>() {
+  return ::sheepshead::model::PickingRound_LonerDecision_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_game_2eproto
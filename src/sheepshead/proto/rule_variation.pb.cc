@@ -0,0 +1,556 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rule_variation.proto
+
+#include "rule_variation.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace sheepshead {
+namespace model {
+PROTOBUF_CONSTEXPR RuleVariation::RuleVariation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.stakes_doubler_)*/{}
+  , /*decltype(_impl_.trump_suit_)*/0
+  , /*decltype(_impl_.partner_method_)*/0
+  , /*decltype(_impl_.no_picker_result_)*/0
+  , /*decltype(_impl_.the_spitz_)*/false
+  , /*decltype(_impl_.num_players_)*/5} {}
+struct RuleVariationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RuleVariationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RuleVariationDefaultTypeInternal() {}
+  union {
+    RuleVariation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RuleVariationDefaultTypeInternal _RuleVariation_default_instance_;
+}  // namespace model
+}  // namespace sheepshead
+static ::_pb::Metadata file_level_metadata_rule_5fvariation_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_rule_5fvariation_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rule_5fvariation_2eproto = nullptr;
+
+const uint32_t TableStruct_rule_5fvariation_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::RuleVariation, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::RuleVariation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::RuleVariation, _impl_.num_players_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::RuleVariation, _impl_.trump_suit_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::RuleVariation, _impl_.partner_method_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::RuleVariation, _impl_.no_picker_result_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::RuleVariation, _impl_.the_spitz_),
+  PROTOBUF_FIELD_OFFSET(::sheepshead::model::RuleVariation, _impl_.stakes_doubler_),
+  4,
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::sheepshead::model::RuleVariation)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::sheepshead::model::_RuleVariation_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_rule_5fvariation_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024rule_variation.proto\022\020sheepshead.model"
+  "\032\ndeck.proto\"\273\002\n\rRuleVariation\022\026\n\013num_pl"
+  "ayers\030\001 \001(\005:\0015\0224\n\ntrump_suit\030\002 \001(\0162\026.she"
+  "epshead.model.Suit:\010DIAMONDS\022C\n\016partner_"
+  "method\030\003 \001(\0162\037.sheepshead.model.PartnerM"
+  "ethod:\nCALLED_ACE\022D\n\020no_picker_result\030\004 "
+  "\001(\0162 .sheepshead.model.NoPickerResult:\010L"
+  "EASTERS\022\030\n\tthe_spitz\030\005 \001(\010:\005false\0227\n\016sta"
+  "kes_doubler\030\006 \003(\0162\037.sheepshead.model.Sta"
+  "kesDoubler*E\n\rPartnerMethod\022\016\n\nCALLED_AC"
+  "E\020\000\022\024\n\020JACK_OF_DIAMONDS\020\001\022\016\n\nNO_PARTNER\020"
+  "\002*<\n\016NoPickerResult\022\014\n\010LEASTERS\020\000\022\013\n\007DOU"
+  "BLER\020\001\022\017\n\013FORCED_PICK\020\002*4\n\rStakesDoubler"
+  "\022\t\n\005CRACK\020\000\022\r\n\tCRACKBACK\020\001\022\t\n\005BLITZ\020\002"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_rule_5fvariation_2eproto_deps[1] = {
+  &::descriptor_table_deck_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_rule_5fvariation_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rule_5fvariation_2eproto = {
+    false, false, 557, descriptor_table_protodef_rule_5fvariation_2eproto,
+    "rule_variation.proto",
+    &descriptor_table_rule_5fvariation_2eproto_once, descriptor_table_rule_5fvariation_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_rule_5fvariation_2eproto::offsets,
+    file_level_metadata_rule_5fvariation_2eproto, file_level_enum_descriptors_rule_5fvariation_2eproto,
+    file_level_service_descriptors_rule_5fvariation_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rule_5fvariation_2eproto_getter() {
+  return &descriptor_table_rule_5fvariation_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rule_5fvariation_2eproto(&descriptor_table_rule_5fvariation_2eproto);
+namespace sheepshead {
+namespace model {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PartnerMethod_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rule_5fvariation_2eproto);
+  return file_level_enum_descriptors_rule_5fvariation_2eproto[0];
+}
+bool PartnerMethod_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NoPickerResult_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rule_5fvariation_2eproto);
+  return file_level_enum_descriptors_rule_5fvariation_2eproto[1];
+}
+bool NoPickerResult_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StakesDoubler_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rule_5fvariation_2eproto);
+  return file_level_enum_descriptors_rule_5fvariation_2eproto[2];
+}
+bool StakesDoubler_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class RuleVariation::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RuleVariation>()._impl_._has_bits_);
+  static void set_has_num_players(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_trump_suit(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partner_method(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_no_picker_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_the_spitz(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+RuleVariation::RuleVariation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sheepshead.model.RuleVariation)
+}
+RuleVariation::RuleVariation(const RuleVariation& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RuleVariation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stakes_doubler_){from._impl_.stakes_doubler_}
+    , decltype(_impl_.trump_suit_){}
+    , decltype(_impl_.partner_method_){}
+    , decltype(_impl_.no_picker_result_){}
+    , decltype(_impl_.the_spitz_){}
+    , decltype(_impl_.num_players_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.trump_suit_, &from._impl_.trump_suit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_players_) -
+    reinterpret_cast<char*>(&_impl_.trump_suit_)) + sizeof(_impl_.num_players_));
+  // @@protoc_insertion_point(copy_constructor:sheepshead.model.RuleVariation)
+}
+
+inline void RuleVariation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stakes_doubler_){arena}
+    , decltype(_impl_.trump_suit_){0}
+    , decltype(_impl_.partner_method_){0}
+    , decltype(_impl_.no_picker_result_){0}
+    , decltype(_impl_.the_spitz_){false}
+    , decltype(_impl_.num_players_){5}
+  };
+}
+
+RuleVariation::~RuleVariation() {
+  // @@protoc_insertion_point(destructor:sheepshead.model.RuleVariation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RuleVariation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stakes_doubler_.~RepeatedField();
+}
+
+void RuleVariation::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RuleVariation::Clear() {
+// @@protoc_insertion_point(message_clear_start:sheepshead.model.RuleVariation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stakes_doubler_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.trump_suit_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.the_spitz_) -
+        reinterpret_cast<char*>(&_impl_.trump_suit_)) + sizeof(_impl_.the_spitz_));
+    _impl_.num_players_ = 5;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RuleVariation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 num_players = 1 [default = 5];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_players(&has_bits);
+          _impl_.num_players_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sheepshead.model.Suit trump_suit = 2 [default = DIAMONDS];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sheepshead::model::Suit_IsValid(val))) {
+            _internal_set_trump_suit(static_cast<::sheepshead::model::Suit>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sheepshead.model.PartnerMethod partner_method = 3 [default = CALLED_ACE];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sheepshead::model::PartnerMethod_IsValid(val))) {
+            _internal_set_partner_method(static_cast<::sheepshead::model::PartnerMethod>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sheepshead.model.NoPickerResult no_picker_result = 4 [default = LEASTERS];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::sheepshead::model::NoPickerResult_IsValid(val))) {
+            _internal_set_no_picker_result(static_cast<::sheepshead::model::NoPickerResult>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool the_spitz = 5 [default = false];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_the_spitz(&has_bits);
+          _impl_.the_spitz_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sheepshead.model.StakesDoubler stakes_doubler = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::sheepshead::model::StakesDoubler_IsValid(val))) {
+              _internal_add_stakes_doubler(static_cast<::sheepshead::model::StakesDoubler>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_stakes_doubler(), ptr, ctx, ::sheepshead::model::StakesDoubler_IsValid, &_internal_metadata_, 6);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RuleVariation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sheepshead.model.RuleVariation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 num_players = 1 [default = 5];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_num_players(), target);
+  }
+
+  // optional .sheepshead.model.Suit trump_suit = 2 [default = DIAMONDS];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_trump_suit(), target);
+  }
+
+  // optional .sheepshead.model.PartnerMethod partner_method = 3 [default = CALLED_ACE];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_partner_method(), target);
+  }
+
+  // optional .sheepshead.model.NoPickerResult no_picker_result = 4 [default = LEASTERS];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_no_picker_result(), target);
+  }
+
+  // optional bool the_spitz = 5 [default = false];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_the_spitz(), target);
+  }
+
+  // repeated .sheepshead.model.StakesDoubler stakes_doubler = 6;
+  for (int i = 0, n = this->_internal_stakes_doubler_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        6, this->_internal_stakes_doubler(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sheepshead.model.RuleVariation)
+  return target;
+}
+
+size_t RuleVariation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sheepshead.model.RuleVariation)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sheepshead.model.StakesDoubler stakes_doubler = 6;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_stakes_doubler_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_stakes_doubler(static_cast<int>(i)));
+    }
+    total_size += (1UL * count) + data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .sheepshead.model.Suit trump_suit = 2 [default = DIAMONDS];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_trump_suit());
+    }
+
+    // optional .sheepshead.model.PartnerMethod partner_method = 3 [default = CALLED_ACE];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_partner_method());
+    }
+
+    // optional .sheepshead.model.NoPickerResult no_picker_result = 4 [default = LEASTERS];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_no_picker_result());
+    }
+
+    // optional bool the_spitz = 5 [default = false];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 num_players = 1 [default = 5];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_players());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RuleVariation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RuleVariation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RuleVariation::GetClassData() const { return &_class_data_; }
+
+
+void RuleVariation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RuleVariation*>(&to_msg);
+  auto& from = static_cast<const RuleVariation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sheepshead.model.RuleVariation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stakes_doubler_.MergeFrom(from._impl_.stakes_doubler_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.trump_suit_ = from._impl_.trump_suit_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partner_method_ = from._impl_.partner_method_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.no_picker_result_ = from._impl_.no_picker_result_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.the_spitz_ = from._impl_.the_spitz_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.num_players_ = from._impl_.num_players_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RuleVariation::CopyFrom(const RuleVariation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sheepshead.model.RuleVariation)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RuleVariation::IsInitialized() const {
+  return true;
+}
+
+void RuleVariation::InternalSwap(RuleVariation* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.stakes_doubler_.InternalSwap(&other->_impl_.stakes_doubler_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RuleVariation, _impl_.the_spitz_)
+      + sizeof(RuleVariation::_impl_.the_spitz_)
+      - PROTOBUF_FIELD_OFFSET(RuleVariation, _impl_.trump_suit_)>(
+          reinterpret_cast<char*>(&_impl_.trump_suit_),
+          reinterpret_cast<char*>(&other->_impl_.trump_suit_));
+  swap(_impl_.num_players_, other->_impl_.num_players_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RuleVariation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rule_5fvariation_2eproto_getter, &descriptor_table_rule_5fvariation_2eproto_once,
+      file_level_metadata_rule_5fvariation_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace model
+}  // namespace sheepshead
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::sheepshead::model::RuleVariation*
+Arena::CreateMaybeMessage< ::sheepshead::model::RuleVariation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sheepshead::model::RuleVariation >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,604 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rule_variation.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rule_5fvariation_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rule_5fvariation_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "deck.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rule_5fvariation_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rule_5fvariation_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rule_5fvariation_2eproto;
+namespace sheepshead {
+namespace model {
+class RuleVariation;
+struct RuleVariationDefaultTypeInternal;
+extern RuleVariationDefaultTypeInternal _RuleVariation_default_instance_;
+}  // namespace model
+}  // namespace sheepshead
+PROTOBUF_NAMESPACE_OPEN
+template<> ::sheepshead::model::RuleVariation* Arena::CreateMaybeMessage<::sheepshead::model::RuleVariation>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace sheepshead {
+namespace model {
+
+enum PartnerMethod : int {
+  CALLED_ACE = 0,
+  JACK_OF_DIAMONDS = 1,
+  NO_PARTNER = 2
+};
+bool PartnerMethod_IsValid(int value);
+constexpr PartnerMethod PartnerMethod_MIN = CALLED_ACE;
+constexpr PartnerMethod PartnerMethod_MAX = NO_PARTNER;
+constexpr int PartnerMethod_ARRAYSIZE = PartnerMethod_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PartnerMethod_descriptor();
+template<typename T>
+inline const std::string& PartnerMethod_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PartnerMethod>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PartnerMethod_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PartnerMethod_descriptor(), enum_t_value);
+}
+inline bool PartnerMethod_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PartnerMethod* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PartnerMethod>(
+    PartnerMethod_descriptor(), name, value);
+}
+enum NoPickerResult : int {
+  LEASTERS = 0,
+  DOUBLER = 1,
+  FORCED_PICK = 2
+};
+bool NoPickerResult_IsValid(int value);
+constexpr NoPickerResult NoPickerResult_MIN = LEASTERS;
+constexpr NoPickerResult NoPickerResult_MAX = FORCED_PICK;
+constexpr int NoPickerResult_ARRAYSIZE = NoPickerResult_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NoPickerResult_descriptor();
+template<typename T>
+inline const std::string& NoPickerResult_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, NoPickerResult>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function NoPickerResult_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    NoPickerResult_descriptor(), enum_t_value);
+}
+inline bool NoPickerResult_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, NoPickerResult* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<NoPickerResult>(
+    NoPickerResult_descriptor(), name, value);
+}
+enum StakesDoubler : int {
+  CRACK = 0,
+  CRACKBACK = 1,
+  BLITZ = 2
+};
+bool StakesDoubler_IsValid(int value);
+constexpr StakesDoubler StakesDoubler_MIN = CRACK;
+constexpr StakesDoubler StakesDoubler_MAX = BLITZ;
+constexpr int StakesDoubler_ARRAYSIZE = StakesDoubler_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StakesDoubler_descriptor();
+template<typename T>
+inline const std::string& StakesDoubler_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StakesDoubler>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StakesDoubler_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StakesDoubler_descriptor(), enum_t_value);
+}
+inline bool StakesDoubler_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StakesDoubler* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StakesDoubler>(
+    StakesDoubler_descriptor(), name, value);
+}
+// ===================================================================
+
+class RuleVariation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sheepshead.model.RuleVariation) */ {
+ public:
+  inline RuleVariation() : RuleVariation(nullptr) {}
+  ~RuleVariation() override;
+  explicit PROTOBUF_CONSTEXPR RuleVariation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RuleVariation(const RuleVariation& from);
+  RuleVariation(RuleVariation&& from) noexcept
+    : RuleVariation() {
+    *this = ::std::move(from);
+  }
+
+  inline RuleVariation& operator=(const RuleVariation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RuleVariation& operator=(RuleVariation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RuleVariation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RuleVariation* internal_default_instance() {
+    return reinterpret_cast<const RuleVariation*>(
+               &_RuleVariation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RuleVariation& a, RuleVariation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RuleVariation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RuleVariation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RuleVariation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RuleVariation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RuleVariation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RuleVariation& from) {
+    RuleVariation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RuleVariation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sheepshead.model.RuleVariation";
+  }
+  protected:
+  explicit RuleVariation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStakesDoublerFieldNumber = 6,
+    kTrumpSuitFieldNumber = 2,
+    kPartnerMethodFieldNumber = 3,
+    kNoPickerResultFieldNumber = 4,
+    kTheSpitzFieldNumber = 5,
+    kNumPlayersFieldNumber = 1,
+  };
+  // repeated .sheepshead.model.StakesDoubler stakes_doubler = 6;
+  int stakes_doubler_size() const;
+  private:
+  int _internal_stakes_doubler_size() const;
+  public:
+  void clear_stakes_doubler();
+  private:
+  ::sheepshead::model::StakesDoubler _internal_stakes_doubler(int index) const;
+  void _internal_add_stakes_doubler(::sheepshead::model::StakesDoubler value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_stakes_doubler();
+  public:
+  ::sheepshead::model::StakesDoubler stakes_doubler(int index) const;
+  void set_stakes_doubler(int index, ::sheepshead::model::StakesDoubler value);
+  void add_stakes_doubler(::sheepshead::model::StakesDoubler value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& stakes_doubler() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_stakes_doubler();
+
+  // optional .sheepshead.model.Suit trump_suit = 2 [default = DIAMONDS];
+  bool has_trump_suit() const;
+  private:
+  bool _internal_has_trump_suit() const;
+  public:
+  void clear_trump_suit();
+  ::sheepshead::model::Suit trump_suit() const;
+  void set_trump_suit(::sheepshead::model::Suit value);
+  private:
+  ::sheepshead::model::Suit _internal_trump_suit() const;
+  void _internal_set_trump_suit(::sheepshead::model::Suit value);
+  public:
+
+  // optional .sheepshead.model.PartnerMethod partner_method = 3 [default = CALLED_ACE];
+  bool has_partner_method() const;
+  private:
+  bool _internal_has_partner_method() const;
+  public:
+  void clear_partner_method();
+  ::sheepshead::model::PartnerMethod partner_method() const;
+  void set_partner_method(::sheepshead::model::PartnerMethod value);
+  private:
+  ::sheepshead::model::PartnerMethod _internal_partner_method() const;
+  void _internal_set_partner_method(::sheepshead::model::PartnerMethod value);
+  public:
+
+  // optional .sheepshead.model.NoPickerResult no_picker_result = 4 [default = LEASTERS];
+  bool has_no_picker_result() const;
+  private:
+  bool _internal_has_no_picker_result() const;
+  public:
+  void clear_no_picker_result();
+  ::sheepshead::model::NoPickerResult no_picker_result() const;
+  void set_no_picker_result(::sheepshead::model::NoPickerResult value);
+  private:
+  ::sheepshead::model::NoPickerResult _internal_no_picker_result() const;
+  void _internal_set_no_picker_result(::sheepshead::model::NoPickerResult value);
+  public:
+
+  // optional bool the_spitz = 5 [default = false];
+  bool has_the_spitz() const;
+  private:
+  bool _internal_has_the_spitz() const;
+  public:
+  void clear_the_spitz();
+  bool the_spitz() const;
+  void set_the_spitz(bool value);
+  private:
+  bool _internal_the_spitz() const;
+  void _internal_set_the_spitz(bool value);
+  public:
+
+  // optional int32 num_players = 1 [default = 5];
+  bool has_num_players() const;
+  private:
+  bool _internal_has_num_players() const;
+  public:
+  void clear_num_players();
+  int32_t num_players() const;
+  void set_num_players(int32_t value);
+  private:
+  int32_t _internal_num_players() const;
+  void _internal_set_num_players(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sheepshead.model.RuleVariation)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> stakes_doubler_;
+    int trump_suit_;
+    int partner_method_;
+    int no_picker_result_;
+    bool the_spitz_;
+    int32_t num_players_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rule_5fvariation_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RuleVariation
+
+// optional int32 num_players = 1 [default = 5];
+inline bool RuleVariation::_internal_has_num_players() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool RuleVariation::has_num_players() const {
+  return _internal_has_num_players();
+}
+inline void RuleVariation::clear_num_players() {
+  _impl_.num_players_ = 5;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t RuleVariation::_internal_num_players() const {
+  return _impl_.num_players_;
+}
+inline int32_t RuleVariation::num_players() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.RuleVariation.num_players)
+  return _internal_num_players();
+}
+inline void RuleVariation::_internal_set_num_players(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.num_players_ = value;
+}
+inline void RuleVariation::set_num_players(int32_t value) {
+  _internal_set_num_players(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.RuleVariation.num_players)
+}
+
+// optional .sheepshead.model.Suit trump_suit = 2 [default = DIAMONDS];
+inline bool RuleVariation::_internal_has_trump_suit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RuleVariation::has_trump_suit() const {
+  return _internal_has_trump_suit();
+}
+inline void RuleVariation::clear_trump_suit() {
+  _impl_.trump_suit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::sheepshead::model::Suit RuleVariation::_internal_trump_suit() const {
+  return static_cast< ::sheepshead::model::Suit >(_impl_.trump_suit_);
+}
+inline ::sheepshead::model::Suit RuleVariation::trump_suit() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.RuleVariation.trump_suit)
+  return _internal_trump_suit();
+}
+inline void RuleVariation::_internal_set_trump_suit(::sheepshead::model::Suit value) {
+  assert(::sheepshead::model::Suit_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.trump_suit_ = value;
+}
+inline void RuleVariation::set_trump_suit(::sheepshead::model::Suit value) {
+  _internal_set_trump_suit(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.RuleVariation.trump_suit)
+}
+
+// optional .sheepshead.model.PartnerMethod partner_method = 3 [default = CALLED_ACE];
+inline bool RuleVariation::_internal_has_partner_method() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RuleVariation::has_partner_method() const {
+  return _internal_has_partner_method();
+}
+inline void RuleVariation::clear_partner_method() {
+  _impl_.partner_method_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::sheepshead::model::PartnerMethod RuleVariation::_internal_partner_method() const {
+  return static_cast< ::sheepshead::model::PartnerMethod >(_impl_.partner_method_);
+}
+inline ::sheepshead::model::PartnerMethod RuleVariation::partner_method() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.RuleVariation.partner_method)
+  return _internal_partner_method();
+}
+inline void RuleVariation::_internal_set_partner_method(::sheepshead::model::PartnerMethod value) {
+  assert(::sheepshead::model::PartnerMethod_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partner_method_ = value;
+}
+inline void RuleVariation::set_partner_method(::sheepshead::model::PartnerMethod value) {
+  _internal_set_partner_method(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.RuleVariation.partner_method)
+}
+
+// optional .sheepshead.model.NoPickerResult no_picker_result = 4 [default = LEASTERS];
+inline bool RuleVariation::_internal_has_no_picker_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RuleVariation::has_no_picker_result() const {
+  return _internal_has_no_picker_result();
+}
+inline void RuleVariation::clear_no_picker_result() {
+  _impl_.no_picker_result_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::sheepshead::model::NoPickerResult RuleVariation::_internal_no_picker_result() const {
+  return static_cast< ::sheepshead::model::NoPickerResult >(_impl_.no_picker_result_);
+}
+inline ::sheepshead::model::NoPickerResult RuleVariation::no_picker_result() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.RuleVariation.no_picker_result)
+  return _internal_no_picker_result();
+}
+inline void RuleVariation::_internal_set_no_picker_result(::sheepshead::model::NoPickerResult value) {
+  assert(::sheepshead::model::NoPickerResult_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.no_picker_result_ = value;
+}
+inline void RuleVariation::set_no_picker_result(::sheepshead::model::NoPickerResult value) {
+  _internal_set_no_picker_result(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.RuleVariation.no_picker_result)
+}
+
+// optional bool the_spitz = 5 [default = false];
+inline bool RuleVariation::_internal_has_the_spitz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool RuleVariation::has_the_spitz() const {
+  return _internal_has_the_spitz();
+}
+inline void RuleVariation::clear_the_spitz() {
+  _impl_.the_spitz_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool RuleVariation::_internal_the_spitz() const {
+  return _impl_.the_spitz_;
+}
+inline bool RuleVariation::the_spitz() const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.RuleVariation.the_spitz)
+  return _internal_the_spitz();
+}
+inline void RuleVariation::_internal_set_the_spitz(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.the_spitz_ = value;
+}
+inline void RuleVariation::set_the_spitz(bool value) {
+  _internal_set_the_spitz(value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.RuleVariation.the_spitz)
+}
+
+// repeated .sheepshead.model.StakesDoubler stakes_doubler = 6;
+inline int RuleVariation::_internal_stakes_doubler_size() const {
+  return _impl_.stakes_doubler_.size();
+}
+inline int RuleVariation::stakes_doubler_size() const {
+  return _internal_stakes_doubler_size();
+}
+inline void RuleVariation::clear_stakes_doubler() {
+  _impl_.stakes_doubler_.Clear();
+}
+inline ::sheepshead::model::StakesDoubler RuleVariation::_internal_stakes_doubler(int index) const {
+  return static_cast< ::sheepshead::model::StakesDoubler >(_impl_.stakes_doubler_.Get(index));
+}
+inline ::sheepshead::model::StakesDoubler RuleVariation::stakes_doubler(int index) const {
+  // @@protoc_insertion_point(field_get:sheepshead.model.RuleVariation.stakes_doubler)
+  return _internal_stakes_doubler(index);
+}
+inline void RuleVariation::set_stakes_doubler(int index, ::sheepshead::model::StakesDoubler value) {
+  assert(::sheepshead::model::StakesDoubler_IsValid(value));
+  _impl_.stakes_doubler_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sheepshead.model.RuleVariation.stakes_doubler)
+}
+inline void RuleVariation::_internal_add_stakes_doubler(::sheepshead::model::StakesDoubler value) {
+  assert(::sheepshead::model::StakesDoubler_IsValid(value));
+  _impl_.stakes_doubler_.Add(value);
+}
+inline void RuleVariation::add_stakes_doubler(::sheepshead::model::StakesDoubler value) {
+  _internal_add_stakes_doubler(value);
+  // @@protoc_insertion_point(field_add:sheepshead.model.RuleVariation.stakes_doubler)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+RuleVariation::stakes_doubler() const {
+  // @@protoc_insertion_point(field_list:sheepshead.model.RuleVariation.stakes_doubler)
+  return _impl_.stakes_doubler_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+RuleVariation::_internal_mutable_stakes_doubler() {
+  return &_impl_.stakes_doubler_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+RuleVariation::mutable_stakes_doubler() {
+  // @@protoc_insertion_point(field_mutable_list:sheepshead.model.RuleVariation.stakes_doubler)
+  return _internal_mutable_stakes_doubler();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace model
+}  // namespace sheepshead
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::sheepshead::model::PartnerMethod> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sheepshead::model::PartnerMethod>() {
+  return ::sheepshead::model::PartnerMethod_descriptor();
+}
+template <> struct is_proto_enum< ::sheepshead::model::NoPickerResult> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sheepshead::model::NoPickerResult>() {
+  return ::sheepshead::model::NoPickerResult_descriptor();
+}
+template <> struct is_proto_enum< ::sheepshead::model::StakesDoubler> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sheepshead::model::StakesDoubler>() {
+  return ::sheepshead::model::StakesDoubler_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rule_5fvariation_2eproto
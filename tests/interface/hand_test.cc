@@ -26,6 +26,45 @@ TEST(TestHandInterface, TestDefaultConstructor)
   EXPECT_FALSE(hand.is_finished());
 }
 
+// Test that a Hand dealt from a stacked deck holds the cards in deck order.
+TEST(TestHandInterface, TestStackedDeckConstructor)
+{
+  using sheepshead::interface::Card;
+  std::vector<std::pair<Card::Suit, Card::Rank>> deck;
+  for(auto suit : {Card::Suit::SPADES, Card::Suit::CLUBS, Card::Suit::HEARTS,
+                   Card::Suit::DIAMONDS}) {
+    for(auto rank : {Card::Rank::SEVEN, Card::Rank::EIGHT, Card::Rank::NINE,
+                     Card::Rank::JACK, Card::Rank::QUEEN, Card::Rank::KING,
+                     Card::Rank::TEN, Card::Rank::ACE}) {
+      deck.emplace_back(suit, rank);
+    }
+  }
+
+  auto rules = sheepshead::interface::MutableRules();
+  auto hand = sheepshead::interface::Hand(rules.get_rules(), deck);
+  EXPECT_TRUE(hand.is_playable());
+  EXPECT_FALSE(hand.is_arbitrable());
+
+  size_t deck_position = 0;
+  auto player_itr = hand.dealer();
+  for(int seat = 0; seat < rules.get_rules().number_of_players(); ++seat, ++player_itr) {
+    auto hand_seat = hand.seat(*player_itr);
+    for(auto card_itr = hand_seat.held_cards_begin();
+             card_itr != hand_seat.held_cards_end();
+             ++card_itr) {
+      EXPECT_EQ(card_itr->true_suit(), deck[deck_position].first);
+      EXPECT_EQ(card_itr->true_rank(), deck[deck_position].second);
+      deck_position++;
+    }
+  }
+  for(auto& card : hand.history().picking_round().blinds()) {
+    EXPECT_EQ(card.true_suit(), deck[deck_position].first);
+    EXPECT_EQ(card.true_rank(), deck[deck_position].second);
+    deck_position++;
+  }
+  EXPECT_EQ(deck_position, deck.size());
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   auto results = RUN_ALL_TESTS();
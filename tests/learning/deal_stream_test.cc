@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include "learning/deal_stream.h"
+#include "learning/q_trainer.h"
+
+#include <algorithm>
+#include <vector>
+
+using sheepshead::interface::Card;
+
+namespace {
+
+// How many trump each seat holds in a deal, under the default rules.
+std::vector<int> trump_counts(const std::vector<int>& cards, int number_of_players,
+                              int cards_per_player)
+{
+  std::vector<int> counts(number_of_players, 0);
+  for(int seat = 0; seat < number_of_players; seat++) {
+    for(int i = 0; i < cards_per_player; i++) {
+      int card = cards[seat * cards_per_player + i];
+      auto rank = learning::card_true_rank(card);
+      counts[seat] += rank == Card::Rank::QUEEN || rank == Card::Rank::JACK ||
+                      learning::card_true_suit(card) == Card::Suit::DIAMONDS;
+    }
+  }
+  return counts;
+}
+
+} // namespace
+
+TEST(TestDealStream, TestDealsAreReproducible)
+{
+  auto rules = sheepshead::interface::MutableRules().get_rules();
+  learning::DealStream first(rules, 7);
+  learning::DealStream second(rules, 7);
+  learning::DealStream other(rules, 8);
+
+  // Any order gives the same deals.
+  for(long long n : {5, 0, 3}) {
+    auto cards = first.cards(n);
+    EXPECT_EQ(cards, second.cards(n));
+    EXPECT_EQ(first.play_seed(n), second.play_seed(n));
+    EXPECT_NE(cards, other.cards(n));
+    EXPECT_NE(cards, first.cards(n + 1));
+
+    std::vector<int> sorted(cards);
+    std::sort(sorted.begin(), sorted.end());
+    for(int card = 0; card < learning::NUMBER_OF_CARDS; card++) EXPECT_EQ(card, sorted[card]);
+  }
+  EXPECT_NE(first.play_seed(0), first.play_seed(1));
+
+  auto hand = first.hand(2);
+  EXPECT_FALSE(hand.is_finished());
+  EXPECT_EQ(1, first.group_size());
+}
+
+TEST(TestDealStream, TestAntitheticDealsMirrorStrength)
+{
+  auto rules = sheepshead::interface::MutableRules().get_rules();
+  learning::DealStream deals(rules, 3, learning::DealScheme::ANTITHETIC);
+  learning::DealStream independent(rules, 3);
+  ASSERT_EQ(2, deals.group_size());
+  EXPECT_EQ(independent.cards(0), deals.cards(0));
+
+  auto cards = deals.cards(4);
+  auto mirrored = deals.cards(5);
+  EXPECT_EQ(deals.cards(5), deals.cards(5));
+  for(size_t i = 0; i < cards.size(); i++) {
+    int card = cards[i];
+    int mirror = mirrored[i];
+    if(card == learning::parse_card("QC")) {
+      EXPECT_EQ(learning::parse_card("7D"), mirror);
+    }
+    if(card == learning::parse_card("JD")) {
+      EXPECT_EQ(learning::parse_card("JH"), mirror);
+    }
+    if(card == learning::parse_card("QD")) {
+      EXPECT_EQ(learning::parse_card("KD"), mirror);
+    }
+    if(card == learning::parse_card("AS")) {
+      EXPECT_EQ(learning::parse_card("7S"), mirror);
+    }
+    if(card == learning::parse_card("KH")) {
+      EXPECT_EQ(learning::parse_card("9H"), mirror);
+    }
+  }
+  // Trump stays trump, so every seat holds as many in both deals.
+  EXPECT_EQ(trump_counts(cards, 5, 6), trump_counts(mirrored, 5, 6));
+  EXPECT_NE(deals.play_seed(4), deals.play_seed(5));
+}
+
+TEST(TestDealStream, TestRotatedDealsBalanceSeats)
+{
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(3);
+  auto rules = mutable_rules.get_rules();
+  learning::DealStream deals(rules, 11, learning::DealScheme::ROTATED);
+  ASSERT_EQ(3, deals.group_size());
+
+  for(long long group = 0; group < 4; group++) {
+    std::vector<int> seat_totals(3, 0);
+    std::vector<int> first_counts;
+    for(int member = 0; member < 3; member++) {
+      auto cards = deals.cards(3 * group + member);
+      auto counts = trump_counts(cards, 3, 10);
+      if(member == 0) first_counts = counts;
+      for(int seat = 0; seat < 3; seat++) seat_totals[seat] += counts[seat];
+      // The blinds don't move.
+      EXPECT_TRUE(std::equal(cards.begin() + 30, cards.end(),
+                             deals.cards(3 * group).begin() + 30));
+    }
+    int total = first_counts[0] + first_counts[1] + first_counts[2];
+    for(int seat = 0; seat < 3; seat++) EXPECT_EQ(total, seat_totals[seat]);
+  }
+}
+
+TEST(TestDealStream, TestSchemesAreUnbiased)
+{
+  // With no values learned the first player always decides the same way,
+  // and every scheme should estimate its reward alike.
+  learning::QFunction q_function;
+  double independent = learning::greedy_pick_reward(q_function, 1000, 9);
+  double antithetic = learning::greedy_pick_reward(q_function, 1000, 9,
+                                                   learning::DealScheme::ANTITHETIC);
+  double rotated = learning::greedy_pick_reward(q_function, 1000, 9,
+                                                learning::DealScheme::ROTATED);
+  EXPECT_NEAR(independent, antithetic, 0.5);
+  EXPECT_NEAR(independent, rotated, 0.5);
+
+  learning::DealScheme scheme;
+  EXPECT_TRUE(learning::parse_deal_scheme("rotated", &scheme));
+  EXPECT_EQ(learning::DealScheme::ROTATED, scheme);
+  EXPECT_FALSE(learning::parse_deal_scheme("shuffled", &scheme));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
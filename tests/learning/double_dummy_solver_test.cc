@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include "learning/double_dummy_solver.h"
+#include "sheepshead/interface/hand.h"
+
+#include <algorithm>
+#include <random>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace {
+
+// Plain minimax over every legal card, for checking the solver.
+int minimax(learning::TrickPosition* position)
+{
+  if(position->is_finished()) return position->picking_team_points();
+
+  bool maximizing = position->on_picking_team(position->to_play());
+  int best_value = maximizing ? -1 : 121;
+  for(learning::CardMask moves = position->legal_moves(); moves; moves &= moves - 1) {
+    position->make_move(learning::mask_first(moves));
+    int value = minimax(position);
+    position->unmake_move();
+    best_value = maximizing ? std::max(best_value, value) : std::min(best_value, value);
+  }
+  return best_value;
+}
+
+// Plain minimax of the picking team's reward band.
+int band_minimax(learning::TrickPosition* position)
+{
+  if(position->is_finished()) return position->picking_team_band();
+
+  bool maximizing = position->on_picking_team(position->to_play());
+  int best_value = maximizing ? -4 : 4;
+  for(learning::CardMask moves = position->legal_moves(); moves; moves &= moves - 1) {
+    position->make_move(learning::mask_first(moves));
+    int value = band_minimax(position);
+    position->unmake_move();
+    best_value = maximizing ? std::max(best_value, value) : std::min(best_value, value);
+  }
+  return best_value;
+}
+
+// Play a hand at random until a number of trick cards remain to be played.
+void advance_to_cards_remaining(Hand* hand, int cards_remaining,
+                                std::default_random_engine& generator)
+{
+  int trick_cards = hand->rules().number_of_players() *
+                    hand->rules().number_of_cards_per_player();
+  int played = 0;
+  while(!hand->is_finished()) {
+    if(hand->is_arbitrable()) {
+      hand->arbiter().arbitrate();
+      continue;
+    }
+    auto current_player = hand->current_player();
+    auto available_plays = hand->available_plays(current_player);
+    if(available_plays[0].play_type() == Play::PlayType::TRICK_CARD) {
+      if(trick_cards - played <= cards_remaining) return;
+      played++;
+    }
+    std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+    hand->playmaker(current_player).make_play(available_plays[distribution(generator)]);
+  }
+}
+
+void check_against_minimax(const sheepshead::interface::Rules& rules, int cards_remaining)
+{
+  std::default_random_engine generator(3);
+  learning::DoubleDummySolver solver;
+  for(unsigned long seed = 1; seed < 60; seed++) {
+    auto hand = Hand(rules, seed);
+    advance_to_cards_remaining(&hand, cards_remaining, generator);
+    if(hand.is_finished()) continue;
+
+    auto position = learning::TrickPosition(hand);
+    if(position.is_leasters()) continue;
+
+    auto result = solver.solve(position);
+    auto copy = position;
+    EXPECT_EQ(result.picking_team_points, minimax(&copy));
+    EXPECT_EQ(result.picking_team_points + result.defending_team_points, 120);
+    ASSERT_NE(result.best_card, learning::NO_CARD);
+    EXPECT_TRUE(position.legal_moves() & learning::card_bit(result.best_card));
+
+    // The best card achieves the solved value.
+    copy.make_move(result.best_card);
+    EXPECT_EQ(minimax(&copy), result.picking_team_points);
+  }
+}
+
+} // namespace
+
+TEST(TestDoubleDummySolver, TestMatchesMinimax)
+{
+  check_against_minimax(sheepshead::interface::MutableRules().get_rules(), 13);
+}
+
+TEST(TestDoubleDummySolver, TestMatchesMinimaxJackOfDiamonds)
+{
+  auto rules = sheepshead::interface::MutableRules();
+  rules.set_partner_by_jack_of_diamonds();
+  check_against_minimax(rules.get_rules(), 13);
+}
+
+TEST(TestDoubleDummySolver, TestMatchesMinimaxThreePlayers)
+{
+  auto rules = sheepshead::interface::MutableRules();
+  rules.set_number_of_players(3);
+  check_against_minimax(rules.get_rules(), 10);
+}
+
+TEST(TestDoubleDummySolver, TestTranspositionTableAgrees)
+{
+  std::default_random_engine generator(11);
+  auto table = learning::TranspositionTable(4);
+  learning::DoubleDummySolver solver;
+  learning::DoubleDummySolver table_solver(&table);
+  for(unsigned long seed = 1; seed < 40; seed++) {
+    auto hand = Hand(seed);
+    advance_to_cards_remaining(&hand, 20, generator);
+    if(hand.is_finished()) continue;
+    auto position = learning::TrickPosition(hand);
+    if(position.is_leasters()) continue;
+
+    auto result = solver.solve(position);
+    auto table_result = table_solver.solve(position);
+    EXPECT_EQ(table_result.picking_team_points, result.picking_team_points);
+    EXPECT_LE(table_result.nodes, result.nodes);
+  }
+}
+
+TEST(TestDoubleDummySolver, TestMergingEquivalentMovesAgrees)
+{
+  std::default_random_engine generator(13);
+  learning::DoubleDummySolver solver;
+  learning::DoubleDummySolver unmerged_solver;
+  unmerged_solver.set_merge_equivalent_moves(false);
+  long long nodes = 0;
+  long long unmerged_nodes = 0;
+  for(unsigned long seed = 1; seed < 40; seed++) {
+    auto hand = Hand(seed);
+    advance_to_cards_remaining(&hand, 20, generator);
+    if(hand.is_finished()) continue;
+    auto position = learning::TrickPosition(hand);
+    if(position.is_leasters()) continue;
+
+    auto result = solver.solve(position);
+    auto unmerged_result = unmerged_solver.solve(position);
+    EXPECT_EQ(result.picking_team_points, unmerged_result.picking_team_points);
+    nodes += result.nodes;
+    unmerged_nodes += unmerged_result.nodes;
+  }
+  EXPECT_LT(nodes, unmerged_nodes);
+}
+
+TEST(TestDoubleDummySolver, TestThresholdsAndBands)
+{
+  std::default_random_engine generator(17);
+  auto table = learning::TranspositionTable(4);
+  learning::DoubleDummySolver solver;
+  learning::DoubleDummySolver table_solver(&table);
+  for(unsigned long seed = 1; seed < 80; seed++) {
+    auto hand = Hand(seed);
+    advance_to_cards_remaining(&hand, 12, generator);
+    if(hand.is_finished()) continue;
+    auto position = learning::TrickPosition(hand);
+    if(position.is_leasters()) continue;
+
+    int points = solver.solve(position).picking_team_points;
+    for(int threshold : {31, 61, 91}) {
+      EXPECT_EQ(solver.reaches(position, threshold), points >= threshold);
+    }
+
+    auto copy = position;
+    int band = band_minimax(&copy);
+    for(int first_guess = -3; first_guess <= 3; first_guess++) {
+      EXPECT_EQ(solver.solve_band(position, first_guess), band);
+    }
+    EXPECT_EQ(table_solver.solve_band(position), band);
+  }
+}
+
+TEST(TestDoubleDummySolver, TestSolvesWholeHands)
+{
+  std::default_random_engine generator(7);
+  learning::DoubleDummySolver solver;
+  for(unsigned long seed = 1; seed < 10; seed++) {
+    auto hand = Hand(seed);
+    advance_to_cards_remaining(&hand, 30, generator);
+    if(hand.is_finished()) continue;
+    auto position = learning::TrickPosition(hand);
+    if(position.is_leasters()) continue;
+
+    auto result = solver.solve(position);
+    EXPECT_GE(result.picking_team_points, position.discard_points());
+    EXPECT_LE(result.picking_team_points, 120);
+    EXPECT_TRUE(position.legal_moves() & learning::card_bit(result.best_card));
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "learning/experience_record.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+TEST(TestExperienceRecord, TestActionsRoundTrip)
+{
+  auto hand = Hand(6);
+  std::default_random_engine generator(6);
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto available_plays = hand.available_plays(hand.current_player());
+    for(size_t i = 0; i < available_plays.size(); i++) {
+      EXPECT_EQ(learning::find_action(available_plays,
+                                      learning::encode_action(available_plays[i])),
+                static_cast<int>(i));
+    }
+    std::uniform_int_distribution<size_t> distribution(0, available_plays.size() - 1);
+    hand.playmaker(hand.current_player()).make_play(available_plays[distribution(generator)]);
+  }
+}
+
+TEST(TestExperienceRecord, TestRecordsChainAndEnd)
+{
+  learning::RandomPolicy policy;
+  std::default_random_engine generator(2);
+  for(unsigned long seed = 1; seed < 10; seed++) {
+    auto hand = Hand(seed);
+    std::vector<learning::ExperienceRecord> records;
+    int added = learning::record_hand(policy, &hand, generator, &records);
+    ASSERT_TRUE(hand.is_finished());
+    ASSERT_EQ(added, static_cast<int>(records.size()));
+    // At least every trick card, plus the picking decisions.
+    EXPECT_GE(added, 30);
+
+    int done = 0;
+    for(size_t i = 0; i < records.size(); i++) {
+      const auto& record = records[i];
+      if(record.done) {
+        done++;
+        auto player = learning::player_at_seat(hand, record.observation.seat);
+        EXPECT_EQ(record.reward, hand.reward(player));
+        continue;
+      }
+      EXPECT_EQ(record.reward, 0);
+      // The next observation is the one the seat makes its next play from.
+      size_t next = i + 1;
+      while(records[next].observation.seat != record.observation.seat) next++;
+      EXPECT_EQ(memcmp(&record.next_observation, &records[next].observation,
+                       sizeof(learning::Observation)), 0);
+    }
+    EXPECT_EQ(done, 5);
+  }
+}
+
+TEST(TestExperienceRecord, TestObservationHidesOthersCards)
+{
+  auto hand = Hand(8);
+  learning::RandomPolicy policy;
+  std::default_random_engine generator(8);
+  std::vector<learning::ExperienceRecord> records;
+  learning::record_hand(policy, &hand, generator, &records);
+
+  for(const auto& record : records) {
+    const auto& observation = record.observation;
+    EXPECT_EQ(observation.number_of_players, 5);
+    EXPECT_EQ(observation.held_cards & observation.played_cards, 0u);
+    if(observation.picker != observation.seat) {
+      EXPECT_EQ(observation.discarded_cards, 0u);
+    }
+    if(observation.trick_cards[0] != learning::NO_CARD) {
+      EXPECT_GE(observation.leader, 0);
+    }
+  }
+
+  // The records copy as plain bytes.
+  std::vector<learning::ExperienceRecord> copy(records.size());
+  memcpy(copy.data(), records.data(), records.size() * sizeof(learning::ExperienceRecord));
+  EXPECT_EQ(memcmp(copy.data(), records.data(),
+                   records.size() * sizeof(learning::ExperienceRecord)), 0);
+}
+
+TEST(TestExperienceRecord, TestObserveTrickPosition)
+{
+  learning::RandomPolicy policy;
+  std::default_random_engine generator(5);
+  auto hand = Hand(5);
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand.current_player();
+    auto plays = hand.available_plays(player);
+    if(plays[0].play_type() == Play::PlayType::TRICK_CARD) {
+      learning::TrickPosition position(hand);
+      auto from_hand = learning::observe(hand, player);
+      auto from_position = learning::observe(position, position.to_play());
+      EXPECT_EQ(memcmp(&from_hand, &from_position, sizeof(from_hand)), 0);
+    }
+    hand.playmaker(player).make_play(policy.choose_play(hand, generator));
+  }
+
+  learning::TrickPosition position(hand);
+  ASSERT_TRUE(position.is_finished());
+  for(int seat = 0; seat < position.number_of_players(); seat++) {
+    auto from_hand = learning::observe(hand, learning::player_at_seat(hand, seat));
+    auto from_position = learning::observe(position, seat);
+    EXPECT_EQ(from_hand.turn, static_cast<uint8_t>(Hand::TurnType::FINISHED));
+    EXPECT_EQ(memcmp(&from_hand, &from_position, sizeof(from_hand)), 0);
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
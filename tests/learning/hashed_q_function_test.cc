@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "learning/hashed_q_function.h"
+#include "learning/policy.h"
+#include "learning/q_function.h"
+
+#include <random>
+#include <set>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+TEST(TestHashedQFunction, TestTableUpdatesAndFinds)
+{
+  learning::QTable table(1);
+  float value = 0;
+  EXPECT_FALSE(table.find(42, &value));
+
+  table.update(42, 10, 0.5);
+  table.update(42, 10, 0.5);
+  table.update(0, -4, 1);
+  ASSERT_TRUE(table.find(42, &value));
+  EXPECT_FLOAT_EQ(value, 7.5);
+  EXPECT_EQ(table.updates(42), 2u);
+  ASSERT_TRUE(table.find(0, &value));
+  EXPECT_FLOAT_EQ(value, -4);
+  EXPECT_EQ(table.size(), 2u);
+  EXPECT_EQ(table.evictions(), 0u);
+
+  table.clear();
+  EXPECT_FALSE(table.find(42, &value));
+  EXPECT_EQ(table.size(), 0u);
+}
+
+TEST(TestHashedQFunction, TestTableEvictsLeastUpdated)
+{
+  learning::QTable table(1);
+  uint64_t stride = table.capacity();
+
+  // Every key here has the same home slot, so they compete for one window.
+  for(int i = 0; i < learning::QTable::PROBE_LIMIT; i++) {
+    for(int j = 0; j <= i; j++) table.update(5 + i * stride, i, 1);
+  }
+  EXPECT_EQ(table.evictions(), 0u);
+
+  uint64_t newcomer = 5 + learning::QTable::PROBE_LIMIT * stride;
+  table.update(newcomer, 1, 1);
+  EXPECT_EQ(table.evictions(), 1u);
+  EXPECT_EQ(table.size(), static_cast<size_t>(learning::QTable::PROBE_LIMIT));
+
+  float value = 0;
+  EXPECT_FALSE(table.find(5, &value));
+  EXPECT_TRUE(table.find(newcomer, &value));
+  for(int i = 1; i < learning::QTable::PROBE_LIMIT; i++) {
+    EXPECT_TRUE(table.find(5 + i * stride, &value));
+  }
+}
+
+TEST(TestHashedQFunction, TestKeysSeparatePlays)
+{
+  auto hand = Hand(3);
+  hand.arbiter().arbitrate();
+  auto plays = hand.available_plays(hand.current_player());
+  ASSERT_EQ(plays.size(), 2u);
+
+  learning::HashedQFunction coarse(1, learning::HashedQFunction::TRUMP_COUNT);
+  learning::HashedQFunction fine(1, learning::HashedQFunction::HELD_CARDS);
+  EXPECT_NE(coarse.key(hand, plays[0]), coarse.key(hand, plays[1]));
+  EXPECT_NE(coarse.key(hand, plays[0]), fine.key(hand, plays[0]));
+  EXPECT_EQ(coarse.key(coarse.state_key(hand), plays[1]), coarse.key(hand, plays[1]));
+}
+
+TEST(TestHashedQFunction, TestTrickFeaturesReachTheLastTrick)
+{
+  // Hand::current_turn() stops telling trick turns apart after four tricks,
+  // which a five-player hand goes past.
+  learning::HashedQFunction by_trick(1, learning::HashedQFunction::TRICK_NUMBER);
+  learning::HeuristicPolicy policy;
+  std::default_random_engine generator(4);
+  auto hand = Hand(4);
+  std::set<uint64_t> keys;
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand.current_player();
+    if(hand.available_plays(player)[0].play_type() == Play::PlayType::TRICK_CARD) {
+      keys.insert(by_trick.state_key(hand));
+    }
+    hand.playmaker(player).make_play(policy.choose_play(hand, generator));
+  }
+  // One key for each trick, the last included.
+  EXPECT_EQ(static_cast<size_t>(hand.rules().number_of_cards_per_player()), keys.size());
+}
+
+TEST(TestHashedQFunction, TestLearnsEveryPlayType)
+{
+  learning::HashedQFunction q_function(4);
+  std::default_random_engine generator(9);
+  int decisions = 0;
+  for(unsigned long seed = 1; seed <= 50; seed++) {
+    auto hand = Hand(seed);
+    decisions += learning::learn_from_hand(&q_function, &hand, 0.2, generator);
+    EXPECT_TRUE(hand.is_finished());
+  }
+  // Every hand has at least its picking decisions and all its trick cards.
+  EXPECT_GT(decisions, 50 * 30);
+  EXPECT_GT(q_function.table().size(), 100u);
+  EXPECT_EQ(q_function.table().evictions(), 0u);
+}
+
+TEST(TestHashedQFunction, TestQFunctionIgnoresOtherPlays)
+{
+  // QFunction only tabulates pick decisions, and mustn't look inside others.
+  learning::QFunction q_function;
+  auto hand = Hand(4);
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto plays = hand.available_plays(hand.current_player());
+    for(auto& play : plays) {
+      int id = q_function.project(hand, play);
+      if(play.play_type() == Play::PlayType::PICK) {
+        EXPECT_GE(id, 0);
+      } else {
+        EXPECT_EQ(id, -1);
+        EXPECT_EQ(q_function.evaluate(hand, play), 0);
+      }
+    }
+    hand.playmaker(hand.current_player()).make_play(plays[0]);
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
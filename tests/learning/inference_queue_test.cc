@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include "learning/inference_queue.h"
+#include "learning/mcts.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace {
+
+// Outputs the sum of the inputs and the row's batch size, and counts calls.
+learning::InferenceQueue::BatchEvaluator summing_evaluator(int input_size,
+                                                           std::atomic<int>* calls)
+{
+  return [input_size, calls](const float* inputs, int batch_size, float* outputs) {
+    calls->fetch_add(1);
+    for(int row = 0; row < batch_size; row++) {
+      float sum = 0;
+      for(int i = 0; i < input_size; i++) sum += inputs[row * input_size + i];
+      outputs[2 * row] = sum;
+      outputs[2 * row + 1] = batch_size;
+    }
+  };
+}
+
+void check_threads(bool yield)
+{
+  learning::InferenceQueueConfig config;
+  config.max_batch_size = 4;
+  config.max_wait_microseconds = 20000;
+  config.yield = yield;
+  std::atomic<int> calls(0);
+  learning::InferenceQueue queue(3, 2, summing_evaluator(3, &calls), config);
+
+  const int number_of_threads = 4;
+  const int requests = 50;
+  std::atomic<int> wrong(0);
+  std::vector<std::thread> threads;
+  for(int t = 0; t < number_of_threads; t++) {
+    threads.emplace_back([&, t]() {
+      for(int r = 0; r < requests; r++) {
+        float input[3] = {static_cast<float>(t), static_cast<float>(r), 1};
+        float output[2];
+        queue.evaluate(input, output);
+        if(output[0] != t + r + 1 || output[1] < 1 || output[1] > 4) wrong++;
+      }
+    });
+  }
+  for(auto& thread : threads) thread.join();
+
+  EXPECT_EQ(wrong.load(), 0);
+  auto stats = queue.stats();
+  EXPECT_EQ(stats.requests, number_of_threads * requests);
+  EXPECT_EQ(stats.batches, calls.load());
+  EXPECT_LE(stats.full_batches, stats.batches);
+  EXPECT_GT(stats.mean_fill, 0.25);
+  EXPECT_LE(stats.mean_fill, 1);
+  EXPECT_GT(stats.max_latency_microseconds, 0);
+  EXPECT_LE(stats.mean_latency_microseconds, stats.max_latency_microseconds);
+}
+
+} // namespace
+
+TEST(TestInferenceQueue, TestSingleRequestsTimeOut)
+{
+  learning::InferenceQueueConfig config;
+  config.max_batch_size = 8;
+  config.max_wait_microseconds = 100;
+  std::atomic<int> calls(0);
+  learning::InferenceQueue queue(2, 2, summing_evaluator(2, &calls), config);
+
+  for(int r = 0; r < 10; r++) {
+    float input[2] = {1, static_cast<float>(r)};
+    float output[2];
+    queue.evaluate(input, output);
+    EXPECT_EQ(output[0], r + 1);
+    EXPECT_EQ(output[1], 1);
+  }
+  auto stats = queue.stats();
+  EXPECT_EQ(stats.requests, 10);
+  EXPECT_EQ(stats.batches, 10);
+  EXPECT_EQ(stats.full_batches, 0);
+  EXPECT_DOUBLE_EQ(stats.mean_fill, 1.0 / 8);
+
+  queue.reset_stats();
+  EXPECT_EQ(queue.stats().requests, 0);
+}
+
+TEST(TestInferenceQueue, TestThreadsShareBatches)
+{
+  check_threads(false);
+  check_threads(true);
+}
+
+TEST(TestInferenceQueue, TestMlpEvaluator)
+{
+  std::default_random_engine generator(1);
+  std::normal_distribution<float> normal(0, 0.3);
+  learning::Mlp mlp;
+  std::vector<float> weights(10 * 3), bias(3);
+  for(auto& w : weights) w = normal(generator);
+  for(auto& b : bias) b = normal(generator);
+  mlp.add_layer(10, 3, learning::Activation::NONE, weights.data(), bias.data());
+
+  learning::InferenceQueueConfig config;
+  config.max_batch_size = 2;
+  config.max_wait_microseconds = 50;
+  learning::InferenceQueue queue(10, 3, learning::mlp_evaluator(&mlp), config);
+  std::vector<float> input(10);
+  for(auto& x : input) x = normal(generator);
+  float expected[3], actual[3];
+  mlp.forward(input.data(), 1, expected);
+  queue.evaluate(input.data(), actual);
+  for(int i = 0; i < 3; i++) EXPECT_FLOAT_EQ(actual[i], expected[i]);
+}
+
+TEST(TestInferenceQueue, TestMctsLeafEvaluation)
+{
+  // A leaf evaluator that says the seat to move always wins big.
+  std::atomic<int> calls(0);
+  int outputs = learning::TrickPosition::MAX_PLAYERS;
+  learning::InferenceQueueConfig queue_config;
+  queue_config.max_batch_size = 3;
+  learning::InferenceQueue queue(
+      learning::observation_input_size(), outputs,
+      [&calls, outputs](const float*, int batch_size, float* values) {
+        calls.fetch_add(batch_size);
+        for(int i = 0; i < batch_size * outputs; i++) values[i] = i % outputs == 0 ? 4 : -1;
+      },
+      queue_config);
+
+  learning::MctsConfig config;
+  config.parallelism = learning::MctsConfig::Parallelism::TREE;
+  config.number_of_threads = 3;
+  config.iterations = 300;
+  config.seed = 3;
+  config.leaf_evaluator = &queue;
+  learning::Mcts mcts(config);
+
+  std::default_random_engine generator(2);
+  auto hand = Hand(7);
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand.current_player();
+    auto plays = hand.available_plays(player);
+    if(plays[0].play_type() == Play::PlayType::TRICK_CARD && plays.size() > 1) break;
+    hand.playmaker(player).make_play(plays[0]);
+  }
+  ASSERT_FALSE(hand.is_finished());
+
+  auto result = mcts.search(hand);
+  learning::CardMask legal = learning::TrickPosition(hand).legal_moves();
+  EXPECT_TRUE(legal & learning::card_bit(result.best_card));
+  EXPECT_GT(calls.load(), 0);
+  EXPECT_EQ(queue.stats().requests, calls.load());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "learning/league.h"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+namespace {
+
+learning::LeagueConfig small_config()
+{
+  learning::LeagueConfig config;
+  config.matches_per_round = 4;
+  config.hands_per_match = 3;
+  config.rounds_per_snapshot = 2;
+  config.max_population = 4;
+  config.number_of_threads = 1;
+  config.seed = 21;
+  return config;
+}
+
+sheepshead::interface::Rules three_player_rules()
+{
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(3);
+  return mutable_rules.get_rules();
+}
+
+} // namespace
+
+TEST(TestLeague, TestEloExpectedScore)
+{
+  EXPECT_DOUBLE_EQ(0.5, learning::elo_expected_score(1000, 1000));
+  EXPECT_NEAR(10.0 / 11, learning::elo_expected_score(1400, 1000), 1e-12);
+  EXPECT_NEAR(1, learning::elo_expected_score(1200, 1000) +
+                 learning::elo_expected_score(1000, 1200), 1e-12);
+}
+
+TEST(TestLeague, TestMatchmaking)
+{
+  learning::RandomPolicy weak;
+  learning::HeuristicPolicy strong;
+  auto config = small_config();
+  learning::League league(three_player_rules(), config);
+  league.add_fixed_member("weak", &weak, 800);
+  league.add_fixed_member("strong", &strong, 1200);
+  ASSERT_EQ(3, league.population_size());
+  EXPECT_FALSE(league.member(0).fixed);
+  EXPECT_EQ(1000, league.member(0).rating);
+
+  // Against its own snapshot, the weak and the strong member.
+  auto hard = league.matchmaking_probabilities(0);
+  EXPECT_NEAR(1, hard[0] + hard[1] + hard[2], 1e-12);
+  EXPECT_GT(hard[2], hard[0]);
+  EXPECT_GT(hard[0], hard[1]);
+
+  config.matchmaking = learning::Matchmaking::VARIANCE;
+  learning::League variance_league(three_player_rules(), config);
+  variance_league.add_fixed_member("weak", &weak, 800);
+  variance_league.add_fixed_member("strong", &strong, 1200);
+  auto variance = variance_league.matchmaking_probabilities(0);
+  EXPECT_GT(variance[0], variance[1]);
+  EXPECT_NEAR(variance[1], variance[2], 1e-12);
+
+  config.matchmaking = learning::Matchmaking::UNIFORM;
+  learning::League uniform_league(three_player_rules(), config);
+  uniform_league.add_fixed_member("weak", &weak, 800);
+  for(double probability : uniform_league.matchmaking_probabilities(0)) {
+    EXPECT_DOUBLE_EQ(0.5, probability);
+  }
+}
+
+TEST(TestLeague, TestRoundsSpawnSnapshots)
+{
+  learning::HeuristicPolicy heuristic;
+  auto config = small_config();
+  learning::League league(three_player_rules(), config);
+  league.add_fixed_member("heuristic", &heuristic);
+
+  for(int round = 1; round <= 8; round++) {
+    auto stats = league.play_round();
+    EXPECT_EQ(round, stats.round);
+    EXPECT_EQ(config.matches_per_round * config.hands_per_match, stats.hands);
+    EXPECT_EQ(round % 2 == 0 ? 1 : 0, stats.spawned);
+    EXPECT_GE(stats.learner_score, 0);
+    EXPECT_LE(stats.learner_score, 1);
+  }
+  // Two members to start and a snapshot every other round, capped at four.
+  EXPECT_EQ(4, league.population_size());
+  EXPECT_EQ(8, league.rounds());
+  bool found_heuristic = false;
+  for(int index = 0; index < league.population_size(); index++) {
+    auto& member = league.member(index);
+    if(member.fixed) {
+      found_heuristic = true;
+      EXPECT_EQ(1000, member.rating);
+    }
+  }
+  EXPECT_TRUE(found_heuristic);
+  EXPECT_NE(1000, league.learner_rating(0));
+
+  // The same league on more threads learns the same weights.
+  config.number_of_threads = 3;
+  learning::League threaded(three_player_rules(), config);
+  threaded.add_fixed_member("heuristic", &heuristic);
+  for(int round = 0; round < 8; round++) threaded.play_round();
+  EXPECT_DOUBLE_EQ(league.learner_rating(0), threaded.learner_rating(0));
+  for(int feature = 0; feature < learning::LinearQFunction::NUMBER_OF_FEATURES; feature++) {
+    for(int slot = 0; slot < learning::LinearQFunction::ACTION_SLOTS; slot++) {
+      ASSERT_EQ(league.learner(0).row(feature)[slot], threaded.learner(0).row(feature)[slot]);
+    }
+  }
+}
+
+TEST(TestLeague, TestLearnerHoldsEveryRotatedHand)
+{
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(4);
+  auto rules = mutable_rules.get_rules();
+  auto config = small_config();
+  config.deal_scheme = learning::DealScheme::ROTATED;
+  config.matches_per_round = 2;
+  config.hands_per_match = 8;
+  learning::League league(rules, config);
+  league.play_round();
+  ASSERT_EQ(16, league.deals_used());
+
+  // Within each group of four deals the learner holds each of the four
+  // hands once, and it moves seat from one group to the next.
+  learning::DealStream deals(rules, config.seed, config.deal_scheme);
+  int cards_per_player = rules.number_of_cards_per_player();
+  auto held = [&](long long deal, int seat) {
+    auto cards = deals.cards(deal);
+    std::vector<int> hand(cards.begin() + seat * cards_per_player,
+                          cards.begin() + (seat + 1) * cards_per_player);
+    std::sort(hand.begin(), hand.end());
+    return hand;
+  };
+  for(long long first_deal = 0; first_deal < 16; first_deal += 4) {
+    std::set<std::vector<int>> dealt, learners;
+    for(int seat = 0; seat < 4; seat++) dealt.insert(held(first_deal, seat));
+    for(int h = 0; h < 4; h++) {
+      int hand = first_deal % config.hands_per_match + h;
+      learners.insert(held(first_deal + h, league.learner_seat(hand)));
+    }
+    EXPECT_EQ(dealt, learners);
+  }
+  EXPECT_NE(league.learner_seat(0), league.learner_seat(4));
+
+  // A match that doesn't fill its last group still starts the next match
+  // on a new one.
+  config.hands_per_match = 10;
+  learning::League uneven(rules, config);
+  uneven.play_round();
+  EXPECT_EQ(24, uneven.deals_used());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
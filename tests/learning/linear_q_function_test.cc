@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "learning/linear_q_function.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace {
+
+std::vector<learning::ExperienceRecord> record_hands(int number_of_hands, unsigned long seed)
+{
+  learning::RandomPolicy policy;
+  std::default_random_engine generator(seed);
+  std::vector<learning::ExperienceRecord> records;
+  for(int n = 0; n < number_of_hands; n++) {
+    auto hand = Hand(seed + n);
+    learning::record_hand(policy, &hand, generator, &records);
+  }
+  return records;
+}
+
+} // namespace
+
+TEST(TestLinearQFunction, TestFeaturesAreInRange)
+{
+  auto records = record_hands(5, 1);
+  for(auto& record : records) {
+    int active[learning::LinearQFunction::MAX_ACTIVE_FEATURES];
+    auto play_type = static_cast<Play::PlayType>(record.action.play_type);
+    int number_active = learning::LinearQFunction::active_features(record.observation,
+                                                                   play_type, active);
+    EXPECT_GT(number_active, 4);
+    for(int i = 0; i < number_active; i++) {
+      EXPECT_GE(active[i], 0);
+      EXPECT_LT(active[i], learning::LinearQFunction::NUMBER_OF_FEATURES);
+    }
+    int slots[4];
+    int number_of_slots = learning::LinearQFunction::action_slots(record.action, slots);
+    auto segment = learning::LinearQFunction::segment(play_type);
+    ASSERT_GT(number_of_slots, 0);
+    for(int j = 0; j < number_of_slots; j++) {
+      EXPECT_GE(slots[j], segment.begin);
+      EXPECT_LT(slots[j], segment.end);
+    }
+  }
+}
+
+TEST(TestLinearQFunction, TestUpdateReachesTarget)
+{
+  auto records = record_hands(1, 2);
+  learning::LinearQFunction q_function(1);
+  for(auto& record : records) {
+    if(record.action.play_type == static_cast<uint8_t>(Play::PlayType::DISCARD)) continue;
+    q_function.update(record.observation, record.action, 3.5);
+    EXPECT_NEAR(q_function.evaluate(record.observation, record.action), 3.5, 1e-4);
+  }
+}
+
+TEST(TestLinearQFunction, TestEvaluateAllMatchesEvaluate)
+{
+  auto records = record_hands(3, 3);
+  learning::LinearQFunction q_function(0.3);
+  std::default_random_engine generator(3);
+  std::uniform_real_distribution<float> reward(-6, 6);
+  for(auto& record : records) q_function.update(record.observation, record.action,
+                                                reward(generator));
+
+  // The played hands, replayed, give every kind of decision.
+  learning::RandomPolicy policy;
+  auto hand = Hand(3);
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand.current_player();
+    auto available_plays = hand.available_plays(player);
+    std::vector<float> values(available_plays.size());
+    q_function.evaluate_plays(hand, available_plays, values.data());
+    auto observation = learning::observe(hand, player);
+    for(size_t i = 0; i < available_plays.size(); i++) {
+      EXPECT_NEAR(values[i],
+                  q_function.evaluate(observation, learning::encode_action(available_plays[i])),
+                  1e-4);
+    }
+    hand.playmaker(player).make_play(policy.choose_play(hand, generator));
+  }
+}
+
+TEST(TestLinearQFunction, TestLearnHandReducesError)
+{
+  auto records = record_hands(20, 4);
+  learning::LinearQFunction q_function(0.1);
+
+  // With lambda 1 the targets are the final rewards of each seat.
+  auto error = [&]() {
+    double total = 0;
+    std::vector<float> returns(learning::TrickPosition::MAX_PLAYERS);
+    for(int i = records.size() - 1; i >= 0; i--) {
+      auto& record = records[i];
+      if(record.done) returns[record.observation.seat] = record.reward;
+      double difference = q_function.evaluate(record.observation, record.action) -
+                          returns[record.observation.seat];
+      total += difference * difference;
+    }
+    return total;
+  };
+
+  double before = error();
+  for(int pass = 0; pass < 10; pass++) {
+    q_function.learn_hand(records.data(), records.size(), 1);
+  }
+  EXPECT_LT(error(), before / 2);
+
+  // Bootstrapped learning runs too.
+  learning::LinearQFunction td(0.1);
+  td.learn_hand(records.data(), records.size(), 0.5);
+  learning::LinearQFunction copy(td);
+  EXPECT_EQ(copy.evaluate(records[0].observation, records[0].action),
+            td.evaluate(records[0].observation, records[0].action));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
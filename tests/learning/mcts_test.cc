@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "learning/determinization.h"
+#include "learning/double_dummy_solver.h"
+#include "learning/mcts.h"
+#include "sheepshead/interface/hand.h"
+
+#include <random>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace {
+
+// Advance a hand at random until it's waiting on a trick card with a choice.
+void advance_to_trick_decision(Hand* hand, std::default_random_engine& generator)
+{
+  while(!hand->is_finished()) {
+    if(hand->is_arbitrable()) {
+      hand->arbiter().arbitrate();
+      continue;
+    }
+    auto current_player = hand->current_player();
+    auto available_plays = hand->available_plays(current_player);
+    if(available_plays[0].play_type() == Play::PlayType::TRICK_CARD &&
+       available_plays.size() > 1) {
+      return;
+    }
+    std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+    hand->playmaker(current_player).make_play(available_plays[distribution(generator)]);
+  }
+}
+
+void check_search(learning::MctsConfig::Parallelism parallelism,
+                  learning::SharedTranspositionTable* table = nullptr)
+{
+  learning::MctsConfig config;
+  config.parallelism = parallelism;
+  config.table = table;
+  config.solve_cards = table ? 10 : 0;
+  config.number_of_threads = 3;
+  config.iterations = 600;
+  config.seed = 11;
+  auto mcts = learning::Mcts(config);
+
+  std::default_random_engine generator(5);
+  for(unsigned long seed = 1; seed < 10; seed++) {
+    auto hand = Hand(seed);
+    advance_to_trick_decision(&hand, generator);
+    if(hand.is_finished()) continue;
+
+    auto result = mcts.search(hand);
+    learning::CardMask legal = learning::TrickPosition(hand).legal_moves();
+    ASSERT_NE(result.best_card, learning::NO_CARD);
+    EXPECT_TRUE(legal & learning::card_bit(result.best_card));
+
+    int total_visits = 0;
+    for(int card = 0; card < learning::NUMBER_OF_CARDS; card++) {
+      if(!(legal & learning::card_bit(card))) {
+        EXPECT_EQ(result.visits[card], 0);
+      }
+      total_visits += result.visits[card];
+    }
+    EXPECT_EQ(total_visits, result.iterations);
+
+    auto play = mcts.choose_play(hand);
+    EXPECT_TRUE(hand.playmaker(hand.current_player()).make_play(play));
+  }
+}
+
+// The reward the seat to move gets for laying card, with every card after it
+// played double-dummy best.
+int solved_reward(learning::TrickPosition position, int card, learning::DoubleDummySolver* solver)
+{
+  int seat = position.to_play();
+  position.make_move(card);
+  while(!position.is_finished()) position.make_move(solver->solve(position).best_card);
+  return position.reward(seat);
+}
+
+// The card better for the player to move than every other card in every one
+// of many deals they could be facing, or NO_CARD if there isn't one.
+int dominant_card(const Hand& hand, learning::DoubleDummySolver* solver)
+{
+  learning::Determinizer determinizer(hand, hand.current_player());
+  std::default_random_engine generator(17);
+  std::vector<learning::TrickPosition> deals;
+  for(int n = 0; n < 24; n++) deals.push_back(determinizer.sample(generator));
+  learning::CardMask legal = deals[0].legal_moves();
+  for(int card = 0; card < learning::NUMBER_OF_CARDS; card++) {
+    if(!(legal & learning::card_bit(card))) continue;
+    bool dominant = true;
+    for(auto& deal : deals) {
+      int reward = solved_reward(deal, card, solver);
+      for(int other = 0; other < learning::NUMBER_OF_CARDS && dominant; other++) {
+        if(other != card && (legal & learning::card_bit(other)) &&
+           solved_reward(deal, other, solver) >= reward) {
+          dominant = false;
+        }
+      }
+      if(!dominant) break;
+    }
+    if(dominant) return card;
+  }
+  return learning::NO_CARD;
+}
+
+} // namespace
+
+TEST(TestMcts, TestRootParallel)
+{
+  check_search(learning::MctsConfig::Parallelism::ROOT);
+}
+
+TEST(TestMcts, TestOneThreadSearchesManyDeals)
+{
+  learning::MctsConfig config;
+  ASSERT_GE(config.determinizations, 8);
+  config.seed = 3;
+
+  std::default_random_engine generator(2);
+  auto hand = Hand(2);
+  advance_to_trick_decision(&hand, generator);
+  ASSERT_FALSE(hand.is_finished());
+  // The trees share the iterations exactly, however they divide.
+  for(int iterations : {200, 203, 5}) {
+    config.iterations = iterations;
+    auto result = learning::Mcts(config).search(hand);
+    EXPECT_EQ(iterations, result.iterations);
+    int total_visits = 0;
+    for(int visits : result.visits) total_visits += visits;
+    EXPECT_EQ(iterations, total_visits);
+  }
+}
+
+TEST(TestMcts, TestFindsWinningCard)
+{
+  learning::MctsConfig config;
+  config.iterations = 2000;
+  config.seed = 5;
+  auto mcts = learning::Mcts(config);
+  learning::DoubleDummySolver solver;
+
+  // Late in hands, find decisions where one card beats the rest whatever
+  // the unseen cards are, and check the search picks it.
+  std::default_random_engine generator(8);
+  int checked = 0;
+  for(unsigned long seed = 1; seed < 200 && checked < 5; seed++) {
+    auto hand = Hand(seed);
+    for(advance_to_trick_decision(&hand, generator); !hand.is_finished();
+        advance_to_trick_decision(&hand, generator)) {
+      auto player = hand.current_player();
+      auto position = learning::TrickPosition(hand);
+      if(position.picker() >= 0 && hand.history().number_of_finished_tricks() >=
+                                   hand.rules().number_of_cards_per_player() - 3) {
+        int card = dominant_card(hand, &solver);
+        if(card != learning::NO_CARD) {
+          EXPECT_EQ(card, mcts.search(hand).best_card) << "hand " << seed;
+          checked++;
+        }
+      }
+      auto plays = hand.available_plays(player);
+      std::uniform_int_distribution<int> distribution(0, plays.size() - 1);
+      hand.playmaker(player).make_play(plays[distribution(generator)]);
+    }
+  }
+  EXPECT_EQ(5, checked);
+}
+
+TEST(TestMcts, TestTreeParallel)
+{
+  check_search(learning::MctsConfig::Parallelism::TREE);
+}
+
+TEST(TestMcts, TestSolvedPlayouts)
+{
+  learning::SharedTranspositionTable table(4);
+  check_search(learning::MctsConfig::Parallelism::TREE, &table);
+  EXPECT_GT(table.stats().hits, 0u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
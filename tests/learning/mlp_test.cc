@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "learning/mlp.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace {
+
+struct ReferenceLayer
+{
+  int inputs;
+  int outputs;
+  learning::Activation activation;
+  std::vector<float> weights;
+  std::vector<float> bias;
+};
+
+std::vector<ReferenceLayer> random_layers(const std::vector<int>& sizes, unsigned long seed)
+{
+  std::default_random_engine generator(seed);
+  std::normal_distribution<float> normal(0, 0.3);
+  std::vector<ReferenceLayer> layers;
+  for(size_t i = 0; i + 1 < sizes.size(); i++) {
+    ReferenceLayer layer;
+    layer.inputs = sizes[i];
+    layer.outputs = sizes[i + 1];
+    layer.activation = i + 2 < sizes.size() ? learning::Activation::RELU :
+                                              learning::Activation::NONE;
+    for(int w = 0; w < layer.inputs * layer.outputs; w++) layer.weights.push_back(normal(generator));
+    for(int o = 0; o < layer.outputs; o++) layer.bias.push_back(normal(generator));
+    layers.push_back(layer);
+  }
+  return layers;
+}
+
+learning::Mlp build(const std::vector<ReferenceLayer>& layers)
+{
+  learning::Mlp mlp;
+  for(auto& layer : layers) {
+    mlp.add_layer(layer.inputs, layer.outputs, layer.activation,
+                  layer.weights.data(), layer.bias.data());
+  }
+  return mlp;
+}
+
+std::vector<float> reference_forward(const std::vector<ReferenceLayer>& layers,
+                                     const std::vector<float>& input)
+{
+  std::vector<float> x = input;
+  for(auto& layer : layers) {
+    std::vector<float> y(layer.outputs);
+    for(int o = 0; o < layer.outputs; o++) {
+      double sum = layer.bias[o];
+      for(int k = 0; k < layer.inputs; k++) sum += layer.weights[o * layer.inputs + k] * x[k];
+      if(layer.activation == learning::Activation::RELU && sum < 0) sum = 0;
+      y[o] = sum;
+    }
+    x = y;
+  }
+  return x;
+}
+
+} // namespace
+
+TEST(TestMlp, TestForwardMatchesReference)
+{
+  // Sizes that aren't multiples of a panel, an input layer wider than a
+  // block of inputs, and a batch that doesn't fill the last group of rows.
+  auto layers = random_layers({300, 37, 50, 19}, 1);
+  auto mlp = build(layers);
+  ASSERT_EQ(mlp.input_size(), 300);
+  ASSERT_EQ(mlp.output_size(), 19);
+  EXPECT_EQ(mlp.number_of_parameters(), 301 * 37 + 38 * 50 + 51 * 19);
+
+  const int batch_size = 7;
+  std::default_random_engine generator(2);
+  std::uniform_real_distribution<float> uniform(-1, 1);
+  std::vector<float> inputs(batch_size * 300);
+  for(auto& x : inputs) x = uniform(generator);
+
+  std::vector<float> outputs(batch_size * 19);
+  learning::Mlp::Workspace workspace;
+  mlp.forward(inputs.data(), batch_size, outputs.data(), &workspace);
+  for(int row = 0; row < batch_size; row++) {
+    std::vector<float> input(inputs.begin() + row * 300, inputs.begin() + (row + 1) * 300);
+    auto expected = reference_forward(layers, input);
+    for(int o = 0; o < 19; o++) EXPECT_NEAR(outputs[row * 19 + o], expected[o], 1e-3);
+  }
+
+  // A row's outputs don't depend on the rest of its batch.
+  std::vector<float> single(19);
+  mlp.forward(inputs.data() + 5 * 300, 1, single.data());
+  for(int o = 0; o < 19; o++) EXPECT_NEAR(single[o], outputs[5 * 19 + o], 1e-5);
+}
+
+TEST(TestMlp, TestSaveAndLoad)
+{
+  auto layers = random_layers({20, 33, 4}, 3);
+  auto mlp = build(layers);
+  std::string path = "mlp_test.bin";
+  ASSERT_TRUE(mlp.save(path));
+
+  learning::Mlp loaded;
+  ASSERT_TRUE(loaded.load(path));
+  EXPECT_EQ(loaded.number_of_layers(), 2);
+  EXPECT_EQ(loaded.number_of_parameters(), mlp.number_of_parameters());
+
+  std::vector<float> inputs(3 * 20);
+  for(size_t i = 0; i < inputs.size(); i++) inputs[i] = std::sin(i);
+  std::vector<float> expected(3 * 4), actual(3 * 4);
+  mlp.forward(inputs.data(), 3, expected.data());
+  loaded.forward(inputs.data(), 3, actual.data());
+  EXPECT_EQ(actual, expected);
+
+  learning::Mlp copy(loaded);
+  copy.forward(inputs.data(), 3, actual.data());
+  EXPECT_EQ(actual, expected);
+
+  // A truncated file is refused.
+  std::ifstream in(path, std::ios::binary);
+  std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  in.close();
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(contents.data(), contents.size() - 4);
+  out.close();
+  EXPECT_FALSE(loaded.load(path));
+  EXPECT_EQ(loaded.number_of_layers(), 0);
+
+  // So is one claiming a layer far bigger than the file, without
+  // allocating for it. The first layer's sizes follow the magic and count.
+  uint32_t huge = 1 << 16;
+  memcpy(&contents[12], &huge, sizeof(huge));
+  memcpy(&contents[16], &huge, sizeof(huge));
+  out.open(path, std::ios::binary | std::ios::trunc);
+  out.write(contents.data(), contents.size());
+  out.close();
+  EXPECT_FALSE(loaded.load(path));
+  EXPECT_FALSE(loaded.load("no_such_mlp.bin"));
+  std::remove(path.c_str());
+}
+
+TEST(TestMlp, TestSoftmaxMasksIllegalActions)
+{
+  float logits[8] = {1, 2, 3, 4, 0, 0, 0, 0};
+  uint8_t legal[8] = {1, 0, 1, 0, 0, 0, 0, 0};
+  float probabilities[8];
+  learning::Mlp::softmax(logits, legal, 2, 4, probabilities);
+
+  EXPECT_EQ(probabilities[1], 0);
+  EXPECT_EQ(probabilities[3], 0);
+  EXPECT_NEAR(probabilities[0] + probabilities[2], 1, 1e-6);
+  EXPECT_NEAR(probabilities[2] / probabilities[0], std::exp(2.0), 1e-3);
+  // No legal actions at all.
+  for(int i = 4; i < 8; i++) EXPECT_EQ(probabilities[i], 0);
+}
+
+TEST(TestMlp, TestEncodeObservation)
+{
+  learning::RandomPolicy policy;
+  std::default_random_engine generator(4);
+  std::vector<learning::ExperienceRecord> records;
+  auto hand = Hand(4);
+  learning::record_hand(policy, &hand, generator, &records);
+  ASSERT_FALSE(records.empty());
+
+  std::vector<float> inputs(learning::observation_input_size(), 7.0f);
+  for(auto& record : records) {
+    auto play_type = static_cast<Play::PlayType>(record.action.play_type);
+    learning::encode_observation(record.observation, play_type, inputs.data());
+    int ones = 0;
+    for(float x : inputs) {
+      EXPECT_TRUE(x == 0 || x == 1);
+      ones += x == 1;
+    }
+    EXPECT_GT(ones, 4);
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "learning/pick_cfr.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using sheepshead::interface::Play;
+
+namespace {
+
+learning::PickCfrConfig small_config()
+{
+  learning::PickCfrConfig config;
+  config.iterations = 300;
+  config.number_of_threads = 1;
+  config.exploitability_interval = 150;
+  config.exploitability_deals = 10;
+  config.seed = 17;
+  return config;
+}
+
+} // namespace
+
+TEST(TestPickCfr, TestHoldingBucket)
+{
+  learning::CardMask cards = 0;
+  for(auto name : {"QC", "QS", "JD", "AD", "AH", "7S"}) {
+    cards |= learning::card_bit(learning::parse_card(name));
+  }
+  // Two queens, a jack, one other trump and a fail ace.
+  EXPECT_EQ(((2 * 5 + 1) * 7 + 1) * 4 + 1, learning::PickCfr::holding_bucket(cards, false));
+  // With clubs trump the ace of diamonds is a fail ace.
+  EXPECT_EQ(((2 * 5 + 1) * 7 + 0) * 4 + 2, learning::PickCfr::holding_bucket(cards, true));
+  EXPECT_EQ(learning::PickCfr::HOLDING_BUCKETS - 1,
+            learning::PickCfr::holding_bucket(~0u, false));
+}
+
+TEST(TestPickCfr, TestInformationSets)
+{
+  auto hand = sheepshead::interface::Hand(4);
+  hand.arbiter().arbitrate();
+  auto player = hand.current_player();
+  auto available_plays = hand.available_plays(player);
+  std::vector<int> actions;
+  int information_set = learning::PickCfr::information_set(hand, available_plays, &actions);
+  ASSERT_GE(information_set, 0);
+  EXPECT_LT(information_set, learning::PickCfr::INFORMATION_SETS);
+  ASSERT_EQ(2u, actions.size());
+  EXPECT_EQ(sheepshead::interface::PickDecision::PASS,
+            *available_plays[actions[0]].pick_decision());
+  EXPECT_EQ(sheepshead::interface::PickDecision::PICK,
+            *available_plays[actions[1]].pick_decision());
+
+  // The same holding in the same seat is the same information set.
+  auto other_hand = sheepshead::interface::Hand(4);
+  other_hand.arbiter().arbitrate();
+  EXPECT_EQ(information_set, learning::PickCfr::information_set(
+      other_hand, other_hand.available_plays(other_hand.current_player()), &actions));
+}
+
+TEST(TestPickCfr, TestTraining)
+{
+  auto rules = sheepshead::interface::MutableRules().get_rules();
+  learning::HeuristicPolicy rollout;
+  learning::PickCfr cfr(rules, &rollout);
+  EXPECT_EQ(0, cfr.visited_information_sets());
+
+  std::vector<long long> estimated_at;
+  auto progress = cfr.train(small_config(),
+      [&](const learning::PickCfr&, const learning::PickCfrProgress& progress) {
+        estimated_at.push_back(progress.iterations);
+        EXPECT_GE(progress.exploitability, 0);
+      });
+  EXPECT_EQ(300, progress.iterations);
+  EXPECT_EQ(std::vector<long long>({150, 300}), estimated_at);
+  EXPECT_GE(progress.exploitability, 0);
+  EXPECT_GT(cfr.visited_information_sets(), 0);
+
+  // One thread with the same seed learns the same strategies.
+  learning::PickCfr again(rules, &rollout);
+  again.train(small_config());
+  int compared = 0;
+  for(int information_set = 0; information_set < learning::PickCfr::INFORMATION_SETS;
+      information_set++) {
+    if(!cfr.visited(information_set)) continue;
+    int number_of_actions = information_set % (learning::PickCfr::MAX_ACTIONS - 1) + 2;
+    float strategy[learning::PickCfr::MAX_ACTIONS], other[learning::PickCfr::MAX_ACTIONS];
+    cfr.average_strategy(information_set, number_of_actions, strategy);
+    again.average_strategy(information_set, number_of_actions, other);
+    float total = 0;
+    for(int action = 0; action < number_of_actions; action++) {
+      EXPECT_EQ(strategy[action], other[action]);
+      total += strategy[action];
+    }
+    EXPECT_NEAR(1, total, 1e-5);
+    compared++;
+  }
+  EXPECT_EQ(cfr.visited_information_sets(), compared);
+
+  // Saved and loaded, with the same estimate.
+  std::string path = "/tmp/deepsheep_test_pick_cfr_" + std::to_string(getpid());
+  ASSERT_TRUE(cfr.save(path));
+  learning::PickCfr loaded(rules, &rollout);
+  ASSERT_TRUE(loaded.load(path));
+  EXPECT_EQ(cfr.visited_information_sets(), loaded.visited_information_sets());
+  EXPECT_DOUBLE_EQ(cfr.estimate_exploitability(5, 3), loaded.estimate_exploitability(5, 3));
+
+  auto mutable_rules = sheepshead::interface::MutableRules();
+  mutable_rules.set_number_of_players(3);
+  learning::PickCfr three_players(mutable_rules.get_rules(), &rollout);
+  EXPECT_FALSE(three_players.load(path));
+  unlink(path.c_str());
+
+  // The policy plays whole hands.
+  learning::CfrPickPolicy policy(&cfr);
+  for(unsigned long seed = 1; seed <= 5; seed++) {
+    auto hand = sheepshead::interface::Hand(seed);
+    std::default_random_engine generator(seed);
+    policy.play_to_end(&hand, generator);
+    EXPECT_TRUE(hand.is_finished());
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
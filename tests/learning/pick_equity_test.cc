@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "learning/pick_equity.h"
+#include "sheepshead/interface/hand.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::MutableRules;
+
+namespace {
+
+learning::CardMask parse_cards(const std::vector<std::string>& names)
+{
+  learning::CardMask cards = 0;
+  for(auto& name : names) cards |= learning::card_bit(learning::parse_card(name));
+  return cards;
+}
+
+} // namespace
+
+TEST(TestPickEquity, TestParseCard)
+{
+  using sheepshead::interface::Card;
+  EXPECT_EQ(learning::parse_card("QC"), learning::card_index(Card::Suit::CLUBS, Card::Rank::QUEEN));
+  EXPECT_EQ(learning::parse_card("10s"), learning::card_index(Card::Suit::SPADES, Card::Rank::TEN));
+  EXPECT_EQ(learning::parse_card("TH"), learning::card_index(Card::Suit::HEARTS, Card::Rank::TEN));
+  EXPECT_EQ(learning::parse_card("7D"), learning::card_index(Card::Suit::DIAMONDS, Card::Rank::SEVEN));
+  EXPECT_EQ(learning::parse_card("QX"), learning::NO_CARD);
+  EXPECT_EQ(learning::parse_card("1D"), learning::NO_CARD);
+  EXPECT_EQ(learning::parse_card("Q"), learning::NO_CARD);
+}
+
+TEST(TestPickEquity, TestPlayOutMatchesPlayToEnd)
+{
+  // The heuristic policy doesn't use its random numbers, so playing out on a
+  // TrickPosition should finish every hand the same way the interface does.
+  learning::HeuristicPolicy policy;
+  for(unsigned long seed = 1; seed < 30; seed++) {
+    auto hand = Hand(seed);
+    std::default_random_engine generator(seed);
+
+    policy.play_to_end(&hand, generator);
+    ASSERT_TRUE(hand.is_finished());
+    for(int seat = 0; seat < 5; seat++) {
+      auto copy = Hand(seed);
+      std::default_random_engine copy_generator(seed);
+      EXPECT_EQ(policy.play_out(&copy, seat, copy_generator),
+                hand.reward(learning::player_at_seat(hand, seat)));
+    }
+  }
+}
+
+TEST(TestPickEquity, TestSolverPolicyFinishesHands)
+{
+  learning::SolverPolicy policy;
+  for(unsigned long seed = 1; seed < 4; seed++) {
+    auto hand = Hand(seed);
+    std::default_random_engine generator(seed);
+    policy.play_to_end(&hand, generator);
+    EXPECT_TRUE(hand.is_finished());
+  }
+}
+
+TEST(TestPickEquity, TestStrongHandPicks)
+{
+  auto rules = MutableRules().get_rules();
+  learning::PickEquityConfig config;
+  config.deals_per_blind = 2;
+  config.number_of_threads = 2;
+  config.seed = 7;
+
+  auto strong = parse_cards({"QC", "QS", "QH", "JC", "AD", "10D"});
+  auto result = learning::estimate_pick_equity(rules, 1, strong, learning::HeuristicPolicy(),
+                                               config);
+  EXPECT_EQ(result.strata, 325);
+  EXPECT_EQ(result.deals, 650);
+  EXPECT_FALSE(result.sampled_blinds);
+  EXPECT_GT(result.difference.mean - result.difference.half_width, 0);
+  EXPECT_NEAR(result.difference.mean, result.pick.mean - result.pass.mean, 1e-9);
+
+  auto weak = parse_cards({"7H", "8H", "9S", "KS", "8C", "9C"});
+  result = learning::estimate_pick_equity(rules, 1, weak, learning::HeuristicPolicy(), config);
+  EXPECT_LT(result.difference.mean + result.difference.half_width, 0);
+}
+
+TEST(TestPickEquity, TestIndependentOfThreads)
+{
+  auto mutable_rules = MutableRules();
+  mutable_rules.set_number_of_players(3);
+  auto rules = mutable_rules.get_rules();
+  auto cards = parse_cards({"QC", "JD", "AD", "7D", "AH", "10H", "KS", "9S", "8C", "7C"});
+
+  learning::PickEquityConfig config;
+  config.deals_per_blind = 1;
+  config.seed = 3;
+  config.number_of_threads = 1;
+  auto one_thread = learning::estimate_pick_equity(rules, 0, cards, learning::RandomPolicy(),
+                                                   config);
+  config.number_of_threads = 3;
+  auto three_threads = learning::estimate_pick_equity(rules, 0, cards, learning::RandomPolicy(),
+                                                      config);
+  EXPECT_EQ(one_thread.strata, 231);
+  EXPECT_EQ(one_thread.pick.mean, three_threads.pick.mean);
+  EXPECT_EQ(one_thread.pass.mean, three_threads.pass.mean);
+  EXPECT_EQ(one_thread.difference.half_width, three_threads.difference.half_width);
+}
+
+TEST(TestPickEquity, TestSampledBlinds)
+{
+  auto mutable_rules = MutableRules();
+  mutable_rules.set_number_of_players(4);
+  auto rules = mutable_rules.get_rules();
+  auto cards = parse_cards({"QC", "QS", "JD", "AD", "10D", "AH", "7H"});
+
+  learning::PickEquityConfig config;
+  config.deals_per_blind = 1;
+  config.max_blinds = 50;
+  config.seed = 5;
+  auto result = learning::estimate_pick_equity(rules, 3, cards, learning::HeuristicPolicy(),
+                                               config);
+  EXPECT_TRUE(result.sampled_blinds);
+  EXPECT_EQ(result.strata, 50);
+  EXPECT_EQ(result.deals, 50);
+  EXPECT_GT(result.pick.half_width, 0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
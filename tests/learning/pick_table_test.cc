@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "learning/pick_table.h"
+#include "learning/suit_permutation.h"
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+
+#include <cstdio>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::MutableRules;
+using sheepshead::interface::PickDecision;
+
+namespace {
+
+learning::CardMask parse_cards(const std::vector<std::string>& names)
+{
+  learning::CardMask cards = 0;
+  for(auto& name : names) cards |= learning::card_bit(learning::parse_card(name));
+  return cards;
+}
+
+learning::CardMask held_mask(const Hand& hand)
+{
+  learning::CardMask cards = 0;
+  auto seat = hand.seat(hand.current_player());
+  for(auto card = seat.held_cards_begin(); card != seat.held_cards_end(); ++card) {
+    cards |= learning::card_bit(learning::card_index(*card));
+  }
+  return cards;
+}
+
+} // namespace
+
+TEST(TestPickTable, TestMaskRankIsDense)
+{
+  // Every three-card mask gets its own rank below binomial(32, 3).
+  std::set<uint64_t> ranks;
+  for(int a = 0; a < 32; a++) {
+    for(int b = a + 1; b < 32; b++) {
+      for(int c = b + 1; c < 32; c++) {
+        auto rank = learning::mask_rank(learning::card_bit(a) | learning::card_bit(b) |
+                                        learning::card_bit(c));
+        EXPECT_LT(rank, learning::binomial(32, 3));
+        ranks.insert(rank);
+      }
+    }
+  }
+  EXPECT_EQ(ranks.size(), learning::binomial(32, 3));
+  EXPECT_EQ(learning::binomial(32, 6), 906192u);
+}
+
+TEST(TestPickTable, TestCanonicalHandsCoverEveryHand)
+{
+  for(bool clubs : {false, true}) {
+    auto hands = learning::canonical_hands(3, clubs);
+    std::set<uint64_t> covered;
+    for(auto hand : hands) {
+      for(int n = 0; n < learning::SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+        covered.insert(learning::SuitPermutation::fail_permutation(clubs, n).mask(hand));
+      }
+    }
+    EXPECT_EQ(covered.size(), learning::binomial(32, 3));
+    EXPECT_LT(hands.size() * 3, covered.size());
+  }
+}
+
+TEST(TestPickTable, TestWriteAndLookup)
+{
+  auto rules = MutableRules().get_rules();
+  learning::PickTableBuilder builder(rules);
+
+  auto hand = parse_cards({"QC", "QS", "JD", "AC", "10H", "7S"});
+  auto relabeled = parse_cards({"QC", "QS", "JD", "AH", "10S", "7C"});
+  builder.set(2, hand, 1.3);
+  EXPECT_TRUE(builder.contains(2, hand));
+  EXPECT_TRUE(builder.contains(2, relabeled));
+  EXPECT_FALSE(builder.contains(1, hand));
+  EXPECT_EQ(builder.size(), 6u);
+
+  const char* path = "pick_table_test.pt";
+  ASSERT_TRUE(builder.write(path));
+  {
+    learning::PickTable table(path);
+    ASSERT_TRUE(table.is_open());
+    EXPECT_EQ(table.number_of_players(), 5);
+    EXPECT_FALSE(table.trump_is_clubs());
+    EXPECT_EQ(table.cards_per_player(), 6);
+
+    double difference = 0;
+    ASSERT_TRUE(table.lookup(2, relabeled, &difference));
+    EXPECT_DOUBLE_EQ(difference, 1.25);
+    EXPECT_FALSE(table.lookup(1, hand, &difference));
+    EXPECT_FALSE(table.lookup(5, hand, &difference));
+    EXPECT_FALSE(table.lookup(2, hand | learning::card_bit(learning::parse_card("9D")),
+                              &difference));
+  }
+  std::remove(path);
+
+  learning::PickTable missing("pick_table_test.missing");
+  EXPECT_FALSE(missing.is_open());
+}
+
+TEST(TestPickTable, TestGenerateFillsEveryRelabeling)
+{
+  auto rules = MutableRules().get_rules();
+  learning::PickEquityConfig config;
+  config.deals_per_blind = 1;
+  config.max_blinds = 20;
+  config.number_of_threads = 3;
+  config.seed = 5;
+
+  auto hands = learning::canonical_hands(6, false);
+  hands.erase(hands.begin(), hands.end() - 4);
+  learning::PickTableBuilder builder(rules);
+  learning::HeuristicPolicy policy;
+  learning::generate_pick_table(rules, policy, config, hands, &builder);
+
+  std::set<uint64_t> relabeled;
+  for(auto hand : hands) {
+    for(int n = 0; n < learning::SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+      auto permuted = learning::SuitPermutation::fail_permutation(false, n).mask(hand);
+      relabeled.insert(permuted);
+      for(int seat = 0; seat < 5; seat++) EXPECT_TRUE(builder.contains(seat, permuted));
+    }
+  }
+  EXPECT_EQ(builder.size(), 5 * relabeled.size());
+}
+
+TEST(TestPickTable, TestPolicyFollowsTable)
+{
+  auto rules = MutableRules().get_rules();
+  const char* path = "pick_table_test.pt";
+
+  for(unsigned long seed = 1; seed < 6; seed++) {
+    auto hand = Hand(seed);
+    while(hand.is_arbitrable()) hand.arbiter().arbitrate();
+    int seat = learning::seat_index(hand, hand.current_player());
+    std::default_random_engine generator(seed);
+
+    for(double difference : {-2.0, 2.0}) {
+      learning::PickTableBuilder builder(rules);
+      builder.set(seat, held_mask(hand), difference);
+      ASSERT_TRUE(builder.write(path));
+      learning::PickTable table(path);
+      learning::PickTablePolicy policy(&table);
+
+      auto play = policy.choose_play(hand, generator);
+      EXPECT_EQ(*play.pick_decision(), difference > 0 ? PickDecision::PICK : PickDecision::PASS);
+    }
+
+    // Hands missing from the table are decided heuristically.
+    learning::PickTable empty;
+    learning::PickTablePolicy fallback(&empty, 0);
+    EXPECT_EQ(*fallback.choose_play(hand, generator).pick_decision(), PickDecision::PICK);
+  }
+  std::remove(path);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
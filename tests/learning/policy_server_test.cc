@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include "learning/policy_server.h"
+
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace {
+
+std::string observation_request(const learning::Observation& observation,
+                                Play::PlayType play_type,
+                                const std::vector<learning::ActionId>& actions)
+{
+  std::string request(1, static_cast<char>(learning::PolicyRequestKind::OBSERVATION));
+  request.append(reinterpret_cast<const char*>(&observation), sizeof(observation));
+  request += static_cast<char>(play_type);
+  request += static_cast<char>(actions.size());
+  request.append(reinterpret_cast<const char*>(actions.data()),
+                 actions.size() * sizeof(learning::ActionId));
+  return request;
+}
+
+// A hand played by the heuristic policy up to its first trick card.
+Hand hand_at_first_trick(unsigned long seed)
+{
+  learning::HeuristicPolicy policy;
+  std::default_random_engine generator(seed);
+  Hand hand(seed);
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+    auto player = hand.current_player();
+    auto available_plays = hand.available_plays(player);
+    if(available_plays[0].play_type() == Play::PlayType::TRICK_CARD) break;
+    hand.playmaker(player).make_play(policy.choose_play(hand, generator));
+  }
+  return hand;
+}
+
+} // namespace
+
+TEST(TestPolicyServer, TestAnswer)
+{
+  learning::LinearQFunction q_function;
+  learning::ValueModel model(learning::linear_evaluator(&q_function));
+  learning::PolicyServer server("/tmp/deepsheep_test_answer_" + std::to_string(getpid()),
+                                &model);
+  ASSERT_TRUE(server.is_open());
+
+  // Make the third card held worth the most.
+  auto hand = hand_at_first_trick(3);
+  auto player = hand.current_player();
+  auto observation = learning::observe(hand, player);
+  std::vector<learning::ActionId> actions;
+  for(auto& play : hand.available_plays(player)) actions.push_back(learning::encode_action(play));
+  ASSERT_GE(actions.size(), 3u);
+  for(int n = 0; n < 50; n++) q_function.update(observation, actions[2], 10);
+
+  auto response = server.answer(observation_request(observation, Play::PlayType::TRICK_CARD,
+                                                    actions));
+  ASSERT_EQ(1 + sizeof(learning::ActionId), response.size());
+  EXPECT_EQ(static_cast<char>(learning::PolicyStatus::OK), response[0]);
+  learning::ActionId chosen;
+  memcpy(&chosen, response.data() + 1, sizeof(chosen));
+  EXPECT_EQ(actions[2].value, chosen.value);
+
+  // The same choice from the Hand itself.
+  std::string serialized;
+  hand.serialize(&serialized);
+  response = server.answer(std::string(1, static_cast<char>(learning::PolicyRequestKind::HAND)) +
+                           serialized);
+  ASSERT_EQ(1 + sizeof(learning::ActionId), response.size());
+  memcpy(&chosen, response.data() + 1, sizeof(chosen));
+  EXPECT_EQ(actions[2].value, chosen.value);
+
+  auto request = observation_request(observation, Play::PlayType::TRICK_CARD, actions);
+  request.pop_back();
+  EXPECT_EQ(static_cast<char>(learning::PolicyStatus::MALFORMED), server.answer(request)[0]);
+  EXPECT_EQ(static_cast<char>(learning::PolicyStatus::MALFORMED), server.answer("")[0]);
+  EXPECT_EQ(static_cast<char>(learning::PolicyStatus::MALFORMED), server.answer("\x09")[0]);
+  EXPECT_EQ(static_cast<char>(learning::PolicyStatus::NO_DECISION),
+            server.answer(observation_request(observation, Play::PlayType::TRICK_CARD, {}))[0]);
+
+  learning::HashedQFunction hashed(1);
+  learning::HashedModel hashed_model(&hashed);
+  learning::PolicyServer hashed_server("/tmp/deepsheep_test_hashed_" +
+                                       std::to_string(getpid()), &hashed_model);
+  EXPECT_EQ(static_cast<char>(learning::PolicyStatus::UNSUPPORTED),
+            hashed_server.answer(observation_request(observation, Play::PlayType::TRICK_CARD,
+                                                     actions))[0]);
+}
+
+TEST(TestPolicyServer, TestMalformedRequests)
+{
+  learning::LinearQFunction q_function;
+  learning::ValueModel model(learning::linear_evaluator(&q_function));
+  learning::PolicyServer server("/tmp/deepsheep_test_malformed_" + std::to_string(getpid()),
+                                &model);
+  const char malformed = static_cast<char>(learning::PolicyStatus::MALFORMED);
+
+  auto hand = hand_at_first_trick(5);
+  auto player = hand.current_player();
+  auto observation = learning::observe(hand, player);
+  std::vector<learning::ActionId> actions;
+  for(auto& play : hand.available_plays(player)) actions.push_back(learning::encode_action(play));
+  auto answer = [&server](const learning::Observation& observation,
+                          const std::vector<learning::ActionId>& actions) {
+    return server.answer(observation_request(observation, Play::PlayType::TRICK_CARD,
+                                             actions))[0];
+  };
+  EXPECT_NE(malformed, answer(observation, actions));
+
+  std::vector<std::function<void(learning::Observation*)>> corruptions = {
+    [](learning::Observation* o) { o->number_of_players = 0; },
+    [](learning::Observation* o) { o->number_of_players = 6; },
+    [](learning::Observation* o) { o->seat = 5; },
+    [](learning::Observation* o) { o->seat = -1; },
+    [](learning::Observation* o) { o->picker = 9; },
+    [](learning::Observation* o) { o->partner_card = 32; },
+    [](learning::Observation* o) { o->trick_cards[0] = 100; },
+    [](learning::Observation* o) { o->trick_cards[0] = 3; o->leader = -1; },
+    [](learning::Observation* o) { o->trick_cards[0] = 3; o->leader = 7; },
+    [](learning::Observation* o) { for(auto& card : o->trick_cards) card = 3; },
+    [](learning::Observation* o) { o->trump_is_clubs = 2; }
+  };
+  for(size_t i = 0; i < corruptions.size(); i++) {
+    auto corrupted = observation;
+    corruptions[i](&corrupted);
+    EXPECT_EQ(malformed, answer(corrupted, actions)) << "corruption " << i;
+  }
+
+  auto bad_actions = actions;
+  bad_actions[0].value = 200;
+  EXPECT_EQ(malformed, answer(observation, bad_actions));
+  bad_actions = actions;
+  bad_actions[0].play_type = static_cast<uint8_t>(Play::PlayType::DISCARD);
+  EXPECT_EQ(malformed, answer(observation, bad_actions));
+
+  const std::string hand_kind(1, static_cast<char>(learning::PolicyRequestKind::HAND));
+  EXPECT_EQ(malformed, server.answer(hand_kind + "not a hand")[0]);
+  EXPECT_EQ(malformed, server.answer(hand_kind)[0]);
+  std::string serialized;
+  hand.serialize(&serialized);
+  // Cut short, the Hand loses cards.
+  EXPECT_EQ(malformed, server.answer(hand_kind + serialized.substr(0, serialized.size() - 4))[0]);
+
+  // Every state of real hands is still answered.
+  for(int players = 3; players <= 5; players++) {
+    auto mutable_rules = sheepshead::interface::MutableRules();
+    mutable_rules.set_number_of_players(players);
+    learning::HeuristicPolicy policy;
+    std::default_random_engine generator(players);
+    for(int n = 0; n < 20; n++) {
+      Hand played(mutable_rules.get_rules(), 100 * players + n);
+      while(true) {
+        std::string state;
+        played.serialize(&state);
+        ASSERT_NE(malformed, server.answer(hand_kind + state)[0]) << players << " players";
+        if(played.is_finished()) break;
+        if(played.is_arbitrable()) {
+          played.arbiter().arbitrate();
+          continue;
+        }
+        played.playmaker(played.current_player()).make_play(policy.choose_play(played,
+                                                                                generator));
+      }
+    }
+  }
+}
+
+TEST(TestPolicyServer, TestFrames)
+{
+  int sockets[2];
+  ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sockets));
+  std::string payload(3000, 'x');
+  payload[1234] = '\0';
+  ASSERT_TRUE(learning::write_frame(sockets[0], payload));
+  ASSERT_TRUE(learning::write_frame(sockets[0], ""));
+  ASSERT_TRUE(learning::write_frame(sockets[0], payload));
+
+  std::string received;
+  EXPECT_TRUE(learning::read_frame(sockets[1], &received, 5000));
+  EXPECT_EQ(payload, received);
+  EXPECT_TRUE(learning::read_frame(sockets[1], &received, 5000));
+  EXPECT_TRUE(received.empty());
+  // Too big for the reader.
+  EXPECT_FALSE(learning::read_frame(sockets[1], &received, 100));
+
+  close(sockets[0]);
+  close(sockets[1]);
+}
+
+TEST(TestPolicyServer, TestClientsShareBatches)
+{
+  learning::LinearQFunction q_function;
+  learning::InferenceQueueConfig config;
+  config.max_batch_size = 4;
+  config.max_wait_microseconds = 2000;
+  learning::ValueModel model(learning::linear_evaluator(&q_function), config);
+  std::string path = "/tmp/deepsheep_test_clients_" + std::to_string(getpid());
+  learning::PolicyServer server(path, &model);
+  ASSERT_TRUE(server.is_open());
+  std::thread serving(&learning::PolicyServer::serve, &server);
+
+  const int number_of_clients = 4;
+  const int hands = 3;
+  std::vector<std::thread> clients;
+  for(int c = 0; c < number_of_clients; c++) {
+    clients.emplace_back([&path, c]() {
+      learning::PolicyClient client(path);
+      ASSERT_TRUE(client.is_open());
+      for(int n = 0; n < hands; n++) {
+        auto hand = hand_at_first_trick(10 * c + n + 1);
+        auto available_plays = hand.available_plays(hand.current_player());
+        learning::ActionId action;
+        ASSERT_EQ(learning::PolicyStatus::OK, client.decide(hand, &action));
+        EXPECT_GE(learning::find_action(available_plays, action), 0);
+      }
+    });
+  }
+  for(auto& client : clients) client.join();
+
+  learning::PolicyClient client(path);
+  learning::PolicyServerStats stats;
+  ASSERT_EQ(learning::PolicyStatus::OK, client.stats(&stats));
+  EXPECT_EQ(number_of_clients * hands, stats.requests);
+  EXPECT_GT(stats.batches, 0);
+  EXPECT_LE(stats.batches, stats.requests);
+  EXPECT_LE(stats.p50_microseconds, stats.p99_microseconds);
+  EXPECT_LE(stats.p99_microseconds, stats.max_microseconds);
+
+  // Stopping closes connections still open.
+  server.stop();
+  serving.join();
+  learning::ActionId action;
+  EXPECT_EQ(learning::PolicyStatus::DISCONNECTED, client.decide(hand_at_first_trick(1), &action));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "learning/prioritized_replay.h"
+#include "learning/sum_tree.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+learning::ExperienceRecord make_record(uint32_t n)
+{
+  learning::ExperienceRecord record;
+  memset(&record, 0, sizeof(record));
+  record.action.value = n;
+  return record;
+}
+
+} // namespace
+
+TEST(TestPrioritizedReplay, TestSumTreeFinds)
+{
+  for(size_t size : {1, 5, 8, 100, 1000}) {
+    learning::SumTree tree(size);
+    EXPECT_EQ(tree.total(), 0);
+    for(size_t leaf = 0; leaf < size; leaf++) tree.set(leaf, leaf % 3);
+    double total = 0;
+    for(size_t leaf = 0; leaf < size; leaf++) total += leaf % 3;
+    EXPECT_DOUBLE_EQ(tree.total(), total);
+
+    // Every target lands on the leaf whose span of the running sum holds it.
+    double start = 0;
+    for(size_t leaf = 0; leaf < size; leaf++) {
+      double weight = tree.get(leaf);
+      if(weight > 0) {
+        EXPECT_EQ(tree.find(start), leaf);
+        EXPECT_EQ(tree.find(start + weight / 2), leaf);
+      }
+      start += weight;
+    }
+  }
+}
+
+TEST(TestPrioritizedReplay, TestFindSortedMatchesFind)
+{
+  learning::SumTree tree(300);
+  std::default_random_engine generator(4);
+  std::uniform_real_distribution<double> weight(0, 2);
+  for(size_t leaf = 0; leaf < 300; leaf++) tree.set(leaf, leaf % 7 == 0 ? 0 : weight(generator));
+
+  std::vector<double> targets;
+  for(int j = 0; j < 64; j++) targets.push_back(tree.total() * (j + 0.5) / 64);
+  std::vector<size_t> leaves(targets.size());
+  tree.find_sorted(targets.data(), targets.size(), leaves.data());
+  for(size_t j = 0; j < targets.size(); j++) {
+    EXPECT_EQ(leaves[j], tree.find(targets[j]));
+    EXPECT_NE(leaves[j] % 7, 0u);
+  }
+  // A target rounded past the end still finds a weighted leaf.
+  EXPECT_GT(tree.get(tree.find(tree.total())), 0);
+}
+
+TEST(TestPrioritizedReplay, TestSamplesInProportion)
+{
+  learning::PrioritizedReplayConfig config;
+  config.capacity = 10;
+  config.alpha = 1;
+  config.beta = 1;
+  config.epsilon = 0;
+  learning::PrioritizedReplay replay(config);
+  for(uint32_t n = 0; n < 10; n++) replay.add(make_record(n));
+  for(size_t i = 0; i < 10; i++) replay.update_error(i, i == 3 ? 9 : 1);
+  EXPECT_DOUBLE_EQ(replay.probability(3), 0.5);
+
+  std::default_random_engine generator(5);
+  const int batch_size = 32;
+  size_t indices[batch_size];
+  learning::ExperienceRecord records[batch_size];
+  float weights[batch_size];
+  int hits = 0;
+  int draws = 0;
+  for(int round = 0; round < 50; round++) {
+    ASSERT_EQ(replay.sample(batch_size, generator, indices, records, weights), batch_size);
+    for(int j = 0; j < batch_size; j++) {
+      EXPECT_EQ(records[j].action.value, indices[j]);
+      // The favored record is seen 9 times as often, so weighs a ninth as much.
+      EXPECT_FLOAT_EQ(weights[j], indices[j] == 3 ? 1.0f / 9 : 1.0f);
+      if(indices[j] == 3) hits++;
+      draws++;
+    }
+  }
+  // Stratified draws put all but the boundary strata exactly in proportion.
+  EXPECT_NEAR(hits, draws / 2, 50);
+}
+
+TEST(TestPrioritizedReplay, TestNewRecordsGetMaxPriority)
+{
+  learning::PrioritizedReplayConfig config;
+  config.capacity = 4;
+  learning::PrioritizedReplay replay(config);
+  size_t first = replay.add(make_record(0));
+  replay.update_error(first, 100);
+  size_t second = replay.add(make_record(1));
+  EXPECT_DOUBLE_EQ(replay.probability(first), replay.probability(second));
+
+  // Full memories replace their oldest record.
+  for(uint32_t n = 2; n < 6; n++) replay.add(make_record(n));
+  EXPECT_EQ(replay.size(), 4u);
+  EXPECT_EQ(replay.record(first).action.value, 4u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
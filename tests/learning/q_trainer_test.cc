@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "learning/q_trainer.h"
+
+#include <vector>
+
+TEST(TestQTrainer, TestUpdateMovesTowardsReward)
+{
+  learning::QFunction q_function;
+  q_function.update(3, 4);
+  learning::QFunction snapshot(q_function);
+  q_function.update(3, 4);
+
+  std::string before = snapshot.debug_string();
+  EXPECT_NE(before, q_function.debug_string());
+  snapshot = q_function;
+  EXPECT_EQ(snapshot.debug_string(), q_function.debug_string());
+  EXPECT_NE(before.find("0.200000"), std::string::npos);
+}
+
+TEST(TestQTrainer, TestSnapshotsAndProgress)
+{
+  learning::QTrainerConfig config;
+  config.number_of_hands = 600;
+  config.number_of_threads = 3;
+  config.snapshot_interval = 200;
+  config.seed = 11;
+
+  learning::QFunction q_function;
+  std::vector<long long> snapshot_hands;
+  auto progress = learning::train_q_function(&q_function, config,
+      [&](const learning::QFunction&, const learning::QTrainerProgress& progress) {
+        snapshot_hands.push_back(progress.hands);
+      });
+
+  EXPECT_EQ(progress.hands, 600);
+  EXPECT_GT(progress.hands_per_second, 0);
+  EXPECT_EQ(snapshot_hands, std::vector<long long>({200, 400, 600}));
+  EXPECT_NE(q_function.debug_string(), learning::QFunction().debug_string());
+}
+
+TEST(TestQTrainer, TestOneThreadIsReproducible)
+{
+  learning::QTrainerConfig config;
+  config.number_of_hands = 300;
+  config.number_of_threads = 1;
+  config.seed = 5;
+
+  learning::QFunction first;
+  learning::QFunction second;
+  learning::train_q_function(&first, config);
+  learning::train_q_function(&second, config);
+  EXPECT_EQ(first.debug_string(), second.debug_string());
+  EXPECT_EQ(learning::greedy_pick_reward(first, 100, 3),
+            learning::greedy_pick_reward(second, 100, 3));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
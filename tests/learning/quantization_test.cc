@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "learning/linear_q_function.h"
+#include "learning/mlp.h"
+#include "learning/q_table.h"
+#include "learning/quantization.h"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+using learning::Precision;
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+TEST(TestQuantization, TestHalfConversion)
+{
+  // Values a half represents exactly come back unchanged.
+  for(float value : {0.0f, 1.0f, -2.5f, 0.000061035156f, 65504.0f, 5.9604645e-8f}) {
+    EXPECT_EQ(learning::half_to_float(learning::float_to_half(value)), value);
+  }
+  EXPECT_EQ(learning::float_to_half(1.0f), 0x3c00);
+  EXPECT_EQ(learning::float_to_half(-2.0f), 0xc000);
+  // Too large becomes infinity, too small zero.
+  EXPECT_TRUE(std::isinf(learning::half_to_float(learning::float_to_half(1e6f))));
+  EXPECT_EQ(learning::half_to_float(learning::float_to_half(1e-10f)), 0.0f);
+  EXPECT_TRUE(std::isnan(learning::half_to_float(
+      learning::float_to_half(std::numeric_limits<float>::quiet_NaN()))));
+  // Halfway between 1 and the next half, 1 + 2^-10, rounds to even.
+  EXPECT_EQ(learning::float_to_half(1.0f + std::pow(2.0f, -11.0f)), 0x3c00);
+  EXPECT_EQ(learning::float_to_half(1.0f + 3 * std::pow(2.0f, -11.0f)), 0x3c02);
+
+  std::default_random_engine generator(1);
+  std::uniform_real_distribution<float> uniform(-100, 100);
+  for(int i = 0; i < 1000; i++) {
+    float value = uniform(generator);
+    float rounded = learning::half_to_float(learning::float_to_half(value));
+    EXPECT_LE(std::fabs(rounded - value), std::fabs(value) / 2048);
+  }
+}
+
+TEST(TestQuantization, TestInt8)
+{
+  std::vector<float> values = {0.5f, -1.27f, 0.0f, 0.01f, 1.0f};
+  std::vector<int8_t> quantized(values.size());
+  float scale = learning::quantize_int8(values.data(), values.size(), quantized.data());
+  EXPECT_FLOAT_EQ(scale, 0.01f);
+  EXPECT_EQ(quantized[1], -127);
+  for(size_t i = 0; i < values.size(); i++) {
+    EXPECT_NEAR(quantized[i] * scale, values[i], scale / 2 + 1e-6);
+  }
+
+  std::vector<float> zeros(4, 0.0f);
+  EXPECT_EQ(learning::quantize_int8(zeros.data(), zeros.size(), quantized.data()), 0);
+  EXPECT_EQ(quantized[0], 0);
+}
+
+TEST(TestQuantization, TestQuantizedLinearQFunction)
+{
+  learning::HeuristicPolicy policy;
+  std::default_random_engine generator(2);
+  learning::LinearQFunction q_function(0.05);
+  std::vector<learning::ExperienceRecord> records;
+  for(int n = 0; n < 50; n++) {
+    records.clear();
+    auto hand = Hand(100 + n);
+    learning::record_hand(policy, &hand, generator, &records);
+    q_function.learn_hand(records.data(), records.size(), 0.8);
+  }
+
+  learning::QuantizedLinearQFunction fp16(q_function, Precision::FP16);
+  learning::QuantizedLinearQFunction int8(q_function, Precision::INT8);
+  EXPECT_EQ(2 * fp16.weight_bytes(), learning::LinearQFunction::NUMBER_OF_FEATURES *
+                                     learning::LinearQFunction::ACTION_SLOTS * sizeof(float));
+  EXPECT_LT(int8.weight_bytes(), fp16.weight_bytes());
+
+  for(auto& record : records) {
+    auto play_type = static_cast<Play::PlayType>(record.action.play_type);
+    int active[learning::LinearQFunction::MAX_ACTIVE_FEATURES];
+    int number_active = learning::LinearQFunction::active_features(record.observation,
+                                                                   play_type, active);
+    auto segment = learning::LinearQFunction::segment(play_type);
+    float expected[learning::LinearQFunction::ACTION_SLOTS];
+    float half_values[learning::LinearQFunction::ACTION_SLOTS];
+    float byte_values[learning::LinearQFunction::ACTION_SLOTS];
+    q_function.evaluate_all(active, number_active, segment, expected);
+    fp16.evaluate_all(active, number_active, segment, half_values);
+    int8.evaluate_all(active, number_active, segment, byte_values);
+
+    for(int slot = segment.begin; slot < segment.end; slot++) {
+      // Each row's largest weight bounds its rounding error.
+      float int8_bound = 0;
+      float fp16_bound = 0;
+      for(int i = 0; i < number_active; i++) {
+        float largest = 0;
+        for(int s = 0; s < learning::LinearQFunction::ACTION_SLOTS; s++) {
+          largest = std::max(largest, std::fabs(q_function.row(active[i])[s]));
+        }
+        int8_bound += largest / 254 + 1e-6;
+        fp16_bound += std::fabs(q_function.row(active[i])[slot]) / 2048 + 1e-7;
+      }
+      EXPECT_NEAR(half_values[slot], expected[slot], fp16_bound);
+      EXPECT_NEAR(byte_values[slot], expected[slot], int8_bound);
+    }
+    EXPECT_NEAR(int8.evaluate(record.observation, record.action),
+                q_function.evaluate(record.observation, record.action), 0.05);
+  }
+}
+
+TEST(TestQuantization, TestQuantizedMlp)
+{
+  std::default_random_engine generator(3);
+  std::normal_distribution<float> normal(0, 0.2);
+  learning::Mlp mlp;
+  int sizes[] = {300, 40, 24};
+  for(int i = 0; i < 2; i++) {
+    std::vector<float> weights(sizes[i] * sizes[i + 1]);
+    std::vector<float> bias(sizes[i + 1]);
+    for(auto& w : weights) w = normal(generator);
+    for(auto& b : bias) b = normal(generator);
+    mlp.add_layer(sizes[i], sizes[i + 1],
+                  i == 0 ? learning::Activation::RELU : learning::Activation::NONE,
+                  weights.data(), bias.data());
+  }
+
+  const int batch_size = 9;
+  std::uniform_real_distribution<float> uniform(0, 1);
+  std::vector<float> inputs(batch_size * 300);
+  for(auto& x : inputs) x = uniform(generator);
+  std::vector<float> expected(batch_size * 24);
+  mlp.forward(inputs.data(), batch_size, expected.data());
+
+  for(Precision precision : {Precision::FP16, Precision::INT8}) {
+    learning::Mlp quantized(mlp);
+    quantized.quantize(precision);
+    EXPECT_EQ(quantized.precision(), precision);
+    EXPECT_LT(quantized.weight_bytes(), mlp.weight_bytes());
+
+    std::vector<float> actual(batch_size * 24);
+    quantized.forward(inputs.data(), batch_size, actual.data());
+    double tolerance = precision == Precision::FP16 ? 0.02 : 0.2;
+    for(size_t i = 0; i < actual.size(); i++) EXPECT_NEAR(actual[i], expected[i], tolerance);
+
+    // Saving writes the dequantized weights, which load back as the same network.
+    std::string path = "quantization_test.bin";
+    ASSERT_TRUE(quantized.save(path));
+    learning::Mlp loaded;
+    ASSERT_TRUE(loaded.load(path));
+    std::vector<float> reloaded(batch_size * 24);
+    loaded.forward(inputs.data(), batch_size, reloaded.data());
+    for(size_t i = 0; i < actual.size(); i++) EXPECT_NEAR(reloaded[i], actual[i], 1e-4);
+    std::remove(path.c_str());
+  }
+}
+
+TEST(TestQuantization, TestCompactQTable)
+{
+  learning::QTable table(1);
+  std::default_random_engine generator(4);
+  std::uniform_real_distribution<float> uniform(-10, 10);
+  std::vector<uint64_t> keys;
+  for(int i = 0; i < 5000; i++) {
+    uint64_t key = (static_cast<uint64_t>(generator()) << 32) ^ generator();
+    keys.push_back(key);
+    table.update(key, uniform(generator), 1);
+  }
+  table.update(0, 3, 1);
+  keys.push_back(0);
+
+  learning::CompactQTable compact(table);
+  EXPECT_EQ(compact.capacity(), table.capacity());
+  EXPECT_EQ(2 * compact.bytes(), table.bytes());
+  for(uint64_t key : keys) {
+    float expected = 0;
+    float actual = 0;
+    bool found = table.find(key, &expected);
+    EXPECT_EQ(compact.find(key, &actual), found);
+    if(found) {
+      EXPECT_NEAR(actual, expected, std::fabs(expected) / 1024);
+    }
+  }
+  float value = 0;
+  EXPECT_FALSE(compact.find(0x123456789abcdef0ULL, &value));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "learning/replay_ring.h"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// A record whose every field is derived from one number, so torn copies show.
+learning::ExperienceRecord make_record(uint32_t n)
+{
+  learning::ExperienceRecord record;
+  memset(&record, 0, sizeof(record));
+  record.observation.held_cards = n;
+  record.observation.played_cards = ~n;
+  record.next_observation.held_cards = n * 3;
+  record.action.value = n;
+  record.reward = static_cast<float>(n % 1000);
+  record.done = n & 1;
+  return record;
+}
+
+bool is_whole(const learning::ExperienceRecord& record)
+{
+  uint32_t n = record.action.value;
+  auto expected = make_record(n);
+  return memcmp(&record, &expected, sizeof(record)) == 0;
+}
+
+} // namespace
+
+TEST(TestReplayRing, TestPushAndSample)
+{
+  learning::ReplayRing ring(100);
+  EXPECT_EQ(ring.capacity(), 128u);
+  std::default_random_engine generator(1);
+  learning::ExperienceRecord batch[32];
+  EXPECT_EQ(ring.sample(batch, 32, generator), 0);
+
+  for(uint32_t n = 0; n < 10; n++) EXPECT_TRUE(ring.push(make_record(n)));
+  EXPECT_EQ(ring.size(), 10u);
+  ASSERT_EQ(ring.sample(batch, 32, generator), 32);
+  for(auto& record : batch) {
+    EXPECT_TRUE(is_whole(record));
+    EXPECT_LT(record.action.value, 10u);
+  }
+
+  auto stats = ring.stats();
+  EXPECT_EQ(stats.pushes, 10u);
+  EXPECT_EQ(stats.drops, 0u);
+  EXPECT_EQ(stats.samples, 32u);
+  EXPECT_GE(stats.mean_staleness, 0);
+  EXPECT_LE(stats.mean_staleness, 9);
+}
+
+TEST(TestReplayRing, TestOverwriteKeepsNewest)
+{
+  learning::ReplayRing ring(16);
+  for(uint32_t n = 0; n < 40; n++) ring.push(make_record(n));
+  EXPECT_EQ(ring.size(), 16u);
+  EXPECT_EQ(ring.stats().overwritten_unsampled, 24u);
+
+  std::default_random_engine generator(2);
+  learning::ExperienceRecord batch[64];
+  ASSERT_EQ(ring.sample(batch, 64, generator), 64);
+  for(auto& record : batch) EXPECT_GE(record.action.value, 24u);
+}
+
+TEST(TestReplayRing, TestDropWhenUnsampled)
+{
+  learning::ReplayRing ring(4, learning::OverwritePolicy::DROP_WHEN_UNSAMPLED);
+  for(uint32_t n = 0; n < 4; n++) EXPECT_TRUE(ring.push(make_record(n)));
+  EXPECT_FALSE(ring.push(make_record(4)));
+  EXPECT_EQ(ring.stats().drops, 1u);
+
+  // Once everything has been sampled, pushes go through again.
+  std::default_random_engine generator(3);
+  learning::ExperienceRecord batch[200];
+  ring.sample(batch, 200, generator);
+  for(uint32_t n = 5; n < 9; n++) EXPECT_TRUE(ring.push(make_record(n)));
+  EXPECT_EQ(ring.stats().overwritten_unsampled, 0u);
+}
+
+TEST(TestReplayRing, TestConcurrentPushAndSample)
+{
+  learning::ReplayRing ring(256);
+  const int producers = 3;
+  const int pushes_per_producer = 20000;
+  std::atomic<bool> producing(true);
+  std::atomic<int> torn(0);
+  std::atomic<long long> sampled(0);
+
+  std::vector<std::thread> threads;
+  for(int p = 0; p < producers; p++) {
+    threads.emplace_back([&, p]() {
+      for(int i = 0; i < pushes_per_producer; i++) {
+        ring.push(make_record(p * pushes_per_producer + i));
+      }
+    });
+  }
+  std::vector<std::thread> consumers;
+  for(int c = 0; c < 2; c++) {
+    consumers.emplace_back([&, c]() {
+      std::default_random_engine generator(c);
+      learning::ExperienceRecord batch[16];
+      while(producing) {
+        int n = ring.sample(batch, 16, generator);
+        for(int i = 0; i < n; i++) if(!is_whole(batch[i])) torn++;
+        sampled += n;
+      }
+    });
+  }
+  for(auto& thread : threads) thread.join();
+  producing = false;
+  for(auto& thread : consumers) thread.join();
+
+  EXPECT_EQ(torn, 0);
+  auto stats = ring.stats();
+  EXPECT_EQ(stats.pushes, static_cast<unsigned long long>(producers * pushes_per_producer));
+  EXPECT_EQ(stats.samples, static_cast<unsigned long long>(sampled));
+  EXPECT_EQ(ring.size(), 256u);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
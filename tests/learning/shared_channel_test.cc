@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include "learning/shared_channel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+std::string channel_name(const std::string& test)
+{
+  return "/deepsheep_test_" + test + "_" + std::to_string(getpid());
+}
+
+// Records tagged with who pushed them and their place in the push.
+std::vector<learning::ExperienceRecord> tagged_records(int producer, int push, int length)
+{
+  std::vector<learning::ExperienceRecord> records(length);
+  for(int i = 0; i < length; i++) {
+    records[i] = learning::ExperienceRecord();
+    records[i].action.value = producer;
+    records[i].reward = push;
+    records[i].done = i == length - 1;
+    records[i].observation.seat = i;
+  }
+  return records;
+}
+
+// Pop everything, checking each push arrived whole and each producer's
+// pushes arrived in order. Returns the number of records.
+int drain(learning::ExperienceChannel* channel, int number_of_producers, int expected_records)
+{
+  std::vector<learning::ExperienceRecord> records(channel->capacity());
+  std::vector<int> next_push(number_of_producers, 0);
+  int received = 0;
+  int index_in_push = 0;
+  while(received < expected_records) {
+    int popped = channel->pop(records.data(), records.size(), 2000);
+    if(popped == 0) break;
+    for(int i = 0; i < popped; i++) {
+      EXPECT_EQ(index_in_push, records[i].observation.seat);
+      if(records[i].done) {
+        int producer = records[i].action.value;
+        EXPECT_EQ(next_push[producer], static_cast<int>(records[i].reward));
+        next_push[producer]++;
+        index_in_push = 0;
+      } else {
+        index_in_push++;
+      }
+    }
+    received += popped;
+  }
+  EXPECT_EQ(0, index_in_push);
+  return received;
+}
+
+} // namespace
+
+TEST(TestExperienceChannel, TestRoundTrip)
+{
+  std::string name = channel_name("round_trip");
+  learning::ExperienceChannel created(name, 100);
+  ASSERT_TRUE(created.is_open());
+  EXPECT_EQ(128u, created.capacity());
+
+  learning::ExperienceChannel opened(name);
+  ASSERT_TRUE(opened.is_open());
+  EXPECT_EQ(128u, opened.capacity());
+
+  auto records = tagged_records(0, 0, 5);
+  EXPECT_TRUE(opened.push(records.data(), records.size()));
+  EXPECT_EQ(5u, created.size());
+  EXPECT_EQ(5u, created.pushed());
+
+  // A push that doesn't fit whole waits for the next pop.
+  std::vector<learning::ExperienceRecord> popped(128);
+  auto second = tagged_records(0, 1, 3);
+  EXPECT_TRUE(opened.push(second.data(), second.size()));
+  EXPECT_EQ(5, created.pop(popped.data(), 6, 0));
+  EXPECT_EQ(0, memcmp(records.data(), popped.data(), 5 * sizeof(learning::ExperienceRecord)));
+  EXPECT_EQ(3, created.pop(popped.data(), 128, 0));
+  EXPECT_EQ(1.0f, popped[0].reward);
+  EXPECT_EQ(0, created.pop(popped.data(), 128, 10));
+}
+
+TEST(TestExperienceChannel, TestBackPressure)
+{
+  learning::ExperienceChannel channel(channel_name("back_pressure"), 16);
+  ASSERT_TRUE(channel.is_open());
+
+  auto records = tagged_records(0, 0, 6);
+  EXPECT_TRUE(channel.try_push(records.data(), records.size()));
+  EXPECT_TRUE(channel.try_push(records.data(), records.size()));
+  EXPECT_FALSE(channel.try_push(records.data(), records.size()));
+  EXPECT_EQ(12u, channel.size());
+
+  // The blocked push goes through once the consumer makes room.
+  std::thread producer([&channel, &records]() {
+    EXPECT_TRUE(channel.push(records.data(), records.size()));
+  });
+  while(channel.full_waits() == 0) std::this_thread::yield();
+  std::vector<learning::ExperienceRecord> popped(16);
+  EXPECT_EQ(6, channel.pop(popped.data(), 6, 0));
+  producer.join();
+  EXPECT_EQ(12u, channel.size());
+
+  // Closing wakes and refuses producers, but what was pushed can be popped.
+  EXPECT_TRUE(channel.try_push(records.data(), 4));
+  std::thread refused([&channel, &records]() {
+    EXPECT_FALSE(channel.push(records.data(), records.size()));
+  });
+  while(channel.full_waits() < 2) std::this_thread::yield();
+  channel.close();
+  refused.join();
+  EXPECT_TRUE(channel.is_closed());
+  EXPECT_EQ(16, channel.pop(popped.data(), 16, 0));
+  EXPECT_EQ(0, channel.pop(popped.data(), 16, 1000));
+}
+
+TEST(TestExperienceChannel, TestSmallChannels)
+{
+  // A single slot couldn't tell a published record from a free one.
+  learning::ExperienceChannel channel(channel_name("small"), 1);
+  ASSERT_TRUE(channel.is_open());
+  EXPECT_EQ(2u, channel.capacity());
+
+  auto records = tagged_records(0, 0, 2);
+  EXPECT_TRUE(channel.try_push(records.data(), 1));
+  EXPECT_TRUE(channel.try_push(records.data() + 1, 1));
+  EXPECT_FALSE(channel.try_push(records.data(), 1));
+  std::vector<learning::ExperienceRecord> popped(2);
+  EXPECT_EQ(2, channel.pop(popped.data(), 2, 0));
+  EXPECT_EQ(0, memcmp(records.data(), popped.data(), 2 * sizeof(learning::ExperienceRecord)));
+
+  // A push too big for the pop stays put and is reported.
+  EXPECT_TRUE(channel.try_push(records.data(), 2));
+  EXPECT_EQ(-1, channel.pop(popped.data(), 1, 0));
+  EXPECT_EQ(2u, channel.size());
+  EXPECT_EQ(2, channel.pop(popped.data(), 2, 0));
+}
+
+TEST(TestExperienceChannel, TestThreadsPushWholeHands)
+{
+  learning::ExperienceChannel channel(channel_name("threads"), 64);
+  ASSERT_TRUE(channel.is_open());
+
+  const int number_of_producers = 4;
+  const int pushes = 500;
+  std::vector<std::thread> producers;
+  int expected = 0;
+  for(int producer = 0; producer < number_of_producers; producer++) {
+    for(int push = 0; push < pushes; push++) expected += 1 + (push + producer) % 7;
+    producers.emplace_back([&channel, producer]() {
+      for(int push = 0; push < pushes; push++) {
+        auto records = tagged_records(producer, push, 1 + (push + producer) % 7);
+        EXPECT_TRUE(channel.push(records.data(), records.size()));
+      }
+    });
+  }
+  EXPECT_EQ(expected, drain(&channel, number_of_producers, expected));
+  for(auto& producer : producers) producer.join();
+}
+
+TEST(TestExperienceChannel, TestProcessesPushWholeHands)
+{
+  std::string name = channel_name("processes");
+  learning::ExperienceChannel channel(name, 32);
+  ASSERT_TRUE(channel.is_open());
+
+  const int number_of_producers = 3;
+  const int pushes = 300;
+  std::vector<pid_t> children;
+  for(int producer = 0; producer < number_of_producers; producer++) {
+    pid_t pid = fork();
+    if(pid == 0) {
+      // The child only knows the name.
+      learning::ExperienceChannel opened(name);
+      bool ok = opened.is_open();
+      for(int push = 0; ok && push < pushes; push++) {
+        auto records = tagged_records(producer, push, 1 + push % 5);
+        ok = opened.push(records.data(), records.size());
+      }
+      _exit(ok ? 0 : 1);
+    }
+    ASSERT_GT(pid, 0);
+    children.push_back(pid);
+  }
+
+  int expected = 0;
+  for(int push = 0; push < pushes; push++) expected += number_of_producers * (1 + push % 5);
+  EXPECT_EQ(expected, drain(&channel, number_of_producers, expected));
+  for(pid_t pid : children) {
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+  }
+  EXPECT_EQ(static_cast<unsigned long long>(expected), channel.pushed());
+}
+
+TEST(TestExperienceChannel, TestOpenMissing)
+{
+  learning::ExperienceChannel channel(channel_name("missing"));
+  EXPECT_FALSE(channel.is_open());
+  learning::SnapshotChannel snapshots(channel_name("missing"));
+  EXPECT_FALSE(snapshots.is_open());
+}
+
+TEST(TestSnapshotChannel, TestReadNewer)
+{
+  std::string name = channel_name("snapshot");
+  learning::SnapshotChannel publisher(name, 1000);
+  ASSERT_TRUE(publisher.is_open());
+  learning::SnapshotChannel reader(name);
+  ASSERT_TRUE(reader.is_open());
+  EXPECT_EQ(1000u, reader.max_bytes());
+
+  uint64_t version = 0;
+  std::vector<char> data;
+  EXPECT_FALSE(reader.read_newer(&version, &data));
+
+  std::vector<float> weights(250, 1.5f);
+  publisher.publish(weights.data(), weights.size() * sizeof(float));
+  EXPECT_TRUE(reader.read_newer(&version, &data));
+  EXPECT_EQ(1u, version);
+  ASSERT_EQ(1000u, data.size());
+  EXPECT_EQ(1.5f, reinterpret_cast<const float*>(data.data())[249]);
+  EXPECT_FALSE(reader.read_newer(&version, &data));
+
+  publisher.publish("abc", 3);
+  publisher.publish("defg", 4);
+  EXPECT_TRUE(reader.read_newer(&version, &data));
+  EXPECT_EQ(3u, version);
+  EXPECT_EQ("defg", std::string(data.begin(), data.end()));
+}
+
+TEST(TestSnapshotChannel, TestReadersNeverSeeTornSnapshots)
+{
+  std::string name = channel_name("torn");
+  learning::SnapshotChannel publisher(name, 4096);
+  ASSERT_TRUE(publisher.is_open());
+
+  std::thread reader([&name]() {
+    learning::SnapshotChannel channel(name);
+    uint64_t version = 0;
+    std::vector<char> data;
+    while(version < 2000) {
+      if(!channel.read_newer(&version, &data)) continue;
+      // Every byte of a snapshot is the same.
+      for(char byte : data) ASSERT_EQ(data[0], byte);
+    }
+  });
+  std::vector<char> snapshot(4096);
+  for(int n = 1; n <= 2000; n++) {
+    std::fill(snapshot.begin(), snapshot.end(), static_cast<char>(n));
+    publisher.publish(snapshot.data(), snapshot.size());
+  }
+  reader.join();
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "learning/double_dummy_solver.h"
+#include "learning/shared_transposition_table.h"
+#include "sheepshead/interface/hand.h"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+using learning::Bound;
+using learning::SharedTranspositionTable;
+using learning::TranspositionEntry;
+
+TEST(TestSharedTranspositionTable, TestStoreProbeAndStats)
+{
+  SharedTranspositionTable table(1);
+  TranspositionEntry entry;
+  EXPECT_FALSE(table.probe(777, &entry));
+
+  table.store(777, -120, Bound::UPPER, 30, 5);
+  ASSERT_TRUE(table.probe(777, &entry));
+  EXPECT_EQ(entry.value, -120);
+  EXPECT_EQ(entry.bound, Bound::UPPER);
+  EXPECT_EQ(entry.depth, 30);
+  EXPECT_EQ(entry.best_move, 5);
+
+  // Fill the bucket with other keys to force a collision
+  uint64_t stride = table.capacity() / SharedTranspositionTable::ENTRIES_PER_BUCKET;
+  for(int i = 1; i <= SharedTranspositionTable::ENTRIES_PER_BUCKET; i++) {
+    table.store(777 + i * stride, i, Bound::EXACT, 40, -1);
+  }
+
+  auto stats = table.stats();
+  EXPECT_EQ(stats.probes, 2u);
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.stores, 5u);
+  EXPECT_EQ(stats.collisions, 1u);
+
+  table.reset_stats();
+  EXPECT_EQ(table.stats().probes, 0u);
+}
+
+TEST(TestSharedTranspositionTable, TestConcurrentAccessIsConsistent)
+{
+  // Every thread stores values derived from their keys into a small table,
+  // so any entry a probe returns can be checked against its key.
+  SharedTranspositionTable table(1);
+  std::vector<std::thread> threads;
+  std::vector<int> bad_entries(4, 0);
+  for(int t = 0; t < 4; t++) {
+    threads.emplace_back([&table, &bad_entries, t]() {
+      std::default_random_engine generator(t);
+      std::uniform_int_distribution<uint64_t> distribution(0, 5000);
+      for(int i = 0; i < 200000; i++) {
+        uint64_t key = distribution(generator) * 0x9E3779B97F4A7C15ULL;
+        TranspositionEntry entry;
+        if(table.probe(key, &entry)) {
+          if(entry.value != static_cast<int16_t>(key >> 48) || entry.depth != key % 200) {
+            bad_entries[t]++;
+          }
+        } else {
+          table.store(key, static_cast<int16_t>(key >> 48), Bound::EXACT, key % 200, -1);
+        }
+      }
+    });
+  }
+  for(auto& thread : threads) thread.join();
+  for(int bad : bad_entries) EXPECT_EQ(bad, 0);
+  EXPECT_GT(table.stats().hits, 0u);
+}
+
+TEST(TestSharedTranspositionTable, TestSolversShareTable)
+{
+  std::default_random_engine generator(3);
+  std::vector<learning::TrickPosition> positions;
+  for(unsigned long seed = 1; positions.size() < 8; seed++) {
+    auto hand = sheepshead::interface::Hand(seed);
+    while(!hand.history().picking_round().is_finished()) {
+      if(hand.is_arbitrable()) {
+        hand.arbiter().arbitrate();
+        continue;
+      }
+      auto available_plays = hand.available_plays(hand.current_player());
+      std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+      hand.playmaker(hand.current_player()).make_play(available_plays[distribution(generator)]);
+    }
+    auto position = learning::TrickPosition(hand);
+    if(position.is_leasters()) continue;
+    // Start three tricks in, so the solves are quick
+    for(int i = 0; i < 15; i++) {
+      position.make_move(learning::mask_first(position.legal_moves()));
+    }
+    positions.push_back(position);
+  }
+
+  std::vector<int> expected;
+  learning::DoubleDummySolver solver;
+  for(auto& position : positions) {
+    expected.push_back(solver.solve(position).picking_team_points);
+  }
+
+  // Two threads solve every position, in opposite orders, through one table.
+  SharedTranspositionTable table(4);
+  std::vector<int> results[2];
+  std::vector<std::thread> threads;
+  for(int t = 0; t < 2; t++) {
+    results[t].resize(positions.size());
+    threads.emplace_back([&, t]() {
+      learning::SharedDoubleDummySolver shared_solver(&table);
+      for(size_t i = 0; i < positions.size(); i++) {
+        size_t index = t == 0 ? i : positions.size() - 1 - i;
+        results[t][index] = shared_solver.solve(positions[index]).picking_team_points;
+      }
+    });
+  }
+  for(auto& thread : threads) thread.join();
+  EXPECT_EQ(results[0], expected);
+  EXPECT_EQ(results[1], expected);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
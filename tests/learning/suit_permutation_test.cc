@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "learning/double_dummy_solver.h"
+#include "learning/suit_permutation.h"
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+
+#include <random>
+#include <set>
+#include <vector>
+
+using learning::SuitPermutation;
+using learning::TrickPosition;
+using sheepshead::interface::Card;
+using sheepshead::interface::Hand;
+
+namespace {
+
+// Positions partway through the tricks of random deals, with random play.
+std::vector<TrickPosition> sample_positions(const sheepshead::interface::Rules& rules,
+                                            int number_of_hands, unsigned long seed)
+{
+  std::default_random_engine generator(seed);
+  std::vector<TrickPosition> positions;
+  for(int deal = 0; deal < number_of_hands; deal++) {
+    auto hand = Hand(rules, seed + deal);
+    while(!hand.history().picking_round().is_finished()) {
+      if(hand.is_arbitrable()) {
+        hand.arbiter().arbitrate();
+        continue;
+      }
+      auto available_plays = hand.available_plays(hand.current_player());
+      std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+      hand.playmaker(hand.current_player()).make_play(available_plays[distribution(generator)]);
+    }
+
+    auto position = TrickPosition(hand);
+    std::uniform_int_distribution<int> moves_distribution(0, 2 * position.number_of_players());
+    for(int move = moves_distribution(generator); move > 0 && !position.is_finished(); move--) {
+      learning::CardMask moves = position.legal_moves();
+      std::uniform_int_distribution<int> distribution(0, learning::mask_size(moves) - 1);
+      position.make_move(learning::mask_nth(moves, distribution(generator)));
+    }
+    positions.push_back(position);
+  }
+  return positions;
+}
+
+} // namespace
+
+TEST(TestSuitPermutation, TestPermutations)
+{
+  for(bool trump_is_clubs : {false, true}) {
+    int trump_suit = static_cast<int>(trump_is_clubs ? Card::Suit::CLUBS : Card::Suit::DIAMONDS);
+    std::set<std::vector<int>> seen;
+    for(int n = 0; n < SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+      auto permutation = SuitPermutation::fail_permutation(trump_is_clubs, n);
+      EXPECT_EQ(permutation.is_identity(), n == 0);
+      EXPECT_EQ(permutation.suit(trump_suit), trump_suit);
+      EXPECT_TRUE(permutation.inverse().after(permutation).is_identity());
+      EXPECT_EQ(permutation.card(learning::NO_CARD), learning::NO_CARD);
+
+      std::vector<int> suits;
+      for(int suit = 0; suit < 4; suit++) suits.push_back(permutation.suit(suit));
+      seen.insert(suits);
+
+      for(int card = 0; card < learning::NUMBER_OF_CARDS; card++) {
+        auto rank = learning::card_true_rank(card);
+        if(rank == Card::Rank::QUEEN || rank == Card::Rank::JACK || card / 8 == trump_suit) {
+          EXPECT_EQ(permutation.card(card), card);
+        }
+        EXPECT_EQ(permutation.card(card) % 8, card % 8);
+        EXPECT_EQ(permutation.mask(learning::card_bit(card)),
+                  learning::card_bit(permutation.card(card)));
+      }
+    }
+    EXPECT_EQ(seen.size(), 6u);
+  }
+
+  std::default_random_engine generator(3);
+  std::uniform_int_distribution<learning::CardMask> distribution;
+  auto first = SuitPermutation::fail_permutation(false, 2);
+  auto second = SuitPermutation::fail_permutation(false, 5);
+  for(int i = 0; i < 100; i++) {
+    learning::CardMask cards = distribution(generator);
+    EXPECT_EQ(learning::mask_size(first.mask(cards)), learning::mask_size(cards));
+    EXPECT_EQ(first.inverse().mask(first.mask(cards)), cards);
+    EXPECT_EQ(second.after(first).mask(cards), second.mask(first.mask(cards)));
+  }
+}
+
+TEST(TestSuitPermutation, TestPermutedPositionsPlayAlike)
+{
+  auto rules = sheepshead::interface::MutableRules();
+  learning::TranspositionTable table(16);
+  learning::DoubleDummySolver solver(&table);
+  int n = 0;
+  for(auto& position : sample_positions(rules.get_rules(), 20, 4)) {
+    auto permutation = SuitPermutation::fail_permutation(false, ++n % 6);
+    auto permuted = position;
+    permuted.permute_fail_suits(permutation);
+
+    for(int seat = 0; seat < position.number_of_players(); seat++) {
+      EXPECT_EQ(permuted.held_cards(seat), permutation.mask(position.held_cards(seat)));
+    }
+    EXPECT_EQ(permuted.legal_moves(), permutation.mask(position.legal_moves()));
+    EXPECT_EQ(permuted.partner_card(), permutation.card(position.partner_card()));
+    EXPECT_EQ(permuted.number_of_moves_made(), position.number_of_moves_made());
+    if(!position.is_leasters()) {
+      EXPECT_EQ(solver.solve(permuted).picking_team_points,
+                solver.solve(position).picking_team_points);
+    }
+
+    // Taking back the moves gives the permuted starting position.
+    auto start = position;
+    while(start.number_of_moves_made() > 0) start.unmake_move();
+    start.permute_fail_suits(permutation);
+    while(permuted.number_of_moves_made() > 0) permuted.unmake_move();
+    EXPECT_EQ(permuted.key(), start.key());
+  }
+}
+
+TEST(TestSuitPermutation, TestCanonicalize)
+{
+  for(bool trump_is_clubs : {false, true}) {
+    auto rules = sheepshead::interface::MutableRules();
+    if(trump_is_clubs) rules.set_trump_is_clubs();
+    std::set<uint64_t> keys;
+    std::set<uint64_t> canonical_keys;
+    for(auto& position : sample_positions(rules.get_rules(), 40, 6)) {
+      auto canonical = position;
+      auto applied = canonical.canonicalize();
+      EXPECT_EQ(applied, position.canonical_permutation());
+      keys.insert(position.key());
+      canonical_keys.insert(canonical.key());
+
+      for(int n = 1; n < SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+        auto permuted = position;
+        permuted.permute_fail_suits(SuitPermutation::fail_permutation(trump_is_clubs, n));
+        keys.insert(permuted.key());
+
+        // A move in the canonical position maps back through the inverse.
+        auto permutation = permuted.canonicalize();
+        EXPECT_EQ(permuted.key(), canonical.key());
+        EXPECT_EQ(permutation.inverse().mask(permuted.legal_moves()),
+                  SuitPermutation::fail_permutation(trump_is_clubs, n).mask(position.legal_moves()));
+
+        // Seats see the same canonical view of isomorphic positions.
+        auto view = SuitPermutation::fail_permutation(trump_is_clubs, n);
+        auto unpermuted = position;
+        unpermuted.permute_fail_suits(view);
+        for(int seat = 0; seat < position.number_of_players(); seat++) {
+          EXPECT_EQ(unpermuted.canonical_permutation(seat).mask(unpermuted.held_cards(seat)),
+                    position.canonical_permutation(seat).mask(position.held_cards(seat)));
+        }
+      }
+    }
+    // Canonicalizing folds most of the relabeled positions together.
+    EXPECT_LT(3 * canonical_keys.size(), keys.size());
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "learning/double_dummy_solver.h"
+#include "learning/tablebase.h"
+#include "sheepshead/interface/hand.h"
+
+#include <array>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+using sheepshead::interface::Hand;
+
+namespace {
+
+// Late positions at the start of a trick, from random play of random deals.
+std::vector<learning::TrickPosition> late_positions(const sheepshead::interface::Rules& rules,
+                                                    int max_tricks, unsigned long seed)
+{
+  std::default_random_engine generator(seed);
+  std::vector<learning::TrickPosition> positions;
+  for(unsigned long deal = 0; deal < 200; deal++) {
+    auto hand = Hand(rules, seed + deal);
+    while(!hand.history().picking_round().is_finished()) {
+      if(hand.is_arbitrable()) {
+        hand.arbiter().arbitrate();
+        continue;
+      }
+      auto available_plays = hand.available_plays(hand.current_player());
+      std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+      hand.playmaker(hand.current_player()).make_play(available_plays[distribution(generator)]);
+    }
+
+    auto position = learning::TrickPosition(hand);
+    while(!position.is_finished()) {
+      if(learning::Tablebase::indexable(position, max_tricks)) positions.push_back(position);
+      learning::CardMask moves = position.legal_moves();
+      std::uniform_int_distribution<int> distribution(0, learning::mask_size(moves) - 1);
+      position.make_move(learning::mask_nth(moves, distribution(generator)));
+    }
+  }
+  return positions;
+}
+
+typedef std::pair<std::array<learning::CardMask, 5>, int> Description;
+
+// Whether two descriptions are the same up to a relabeling of the fail suits.
+bool equivalent(const Description& lhs, const Description& rhs)
+{
+  for(int n = 0; n < learning::SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+    auto permutation = learning::SuitPermutation::fail_permutation(false, n);
+    Description permuted = lhs;
+    for(auto& cards : permuted.first) cards = permutation.mask(cards);
+    if(permuted == rhs) return true;
+  }
+  return false;
+}
+
+} // namespace
+
+TEST(TestTablebase, TestIndexIsCanonical)
+{
+  // Positions with the same index hold the same cards in the same seats
+  // relative to the leader, with the same teams, up to the fail suits.
+  std::map<uint64_t, Description> descriptions;
+  auto rules = sheepshead::interface::MutableRules();
+  for(auto& position : late_positions(rules.get_rules(), 3, 1)) {
+    Description description;
+    description.first.fill(0);
+    description.second = 0;
+    for(int relative = 0; relative < position.number_of_players(); relative++) {
+      int seat = (position.leader() + relative) % position.number_of_players();
+      description.first[relative] = position.held_cards(seat);
+      if(position.on_picking_team(seat)) description.second |= 1 << relative;
+    }
+
+    uint64_t index = learning::Tablebase::index(position);
+    auto found = descriptions.find(index);
+    if(found != descriptions.end()) {
+      EXPECT_TRUE(equivalent(found->second, description));
+    } else {
+      descriptions[index] = description;
+    }
+  }
+  EXPECT_GT(descriptions.size(), 100u);
+}
+
+TEST(TestTablebase, TestIndexIgnoresFailSuits)
+{
+  auto rules = sheepshead::interface::MutableRules();
+  for(auto& position : late_positions(rules.get_rules(), 3, 2)) {
+    for(int n = 1; n < learning::SuitPermutation::NUMBER_OF_FAIL_PERMUTATIONS; n++) {
+      auto permuted = position;
+      permuted.permute_fail_suits(learning::SuitPermutation::fail_permutation(false, n));
+      ASSERT_EQ(learning::Tablebase::index(permuted), learning::Tablebase::index(position));
+    }
+  }
+}
+
+TEST(TestTablebase, TestGenerateWriteAndProbe)
+{
+  auto rules = sheepshead::interface::MutableRules();
+  rules.set_number_of_players(3);
+  learning::TablebaseBuilder builder(3, false, 2);
+  learning::generate_tablebase(rules.get_rules(), 50, 5, &builder);
+  ASSERT_GT(builder.size(), 0u);
+
+  const char* path = "tablebase_test.tb";
+  ASSERT_TRUE(builder.write(path));
+  {
+    learning::Tablebase tablebase(path);
+    ASSERT_TRUE(tablebase.is_open());
+    EXPECT_EQ(tablebase.size(), builder.size());
+    EXPECT_EQ(tablebase.number_of_players(), 3);
+    EXPECT_EQ(tablebase.max_tricks(), 2);
+
+    // The same deals reach positions that are in the tablebase, and the
+    // stored values are what the solver finds.
+    learning::DoubleDummySolver solver;
+    learning::DoubleDummySolver tablebase_solver;
+    tablebase_solver.set_tablebase(&tablebase);
+    int hits = 0;
+    for(auto& position : late_positions(rules.get_rules(), 2, 5)) {
+      if(position.is_leasters()) continue;
+      int points = 0;
+      int solved = solver.solve(position).picking_team_points;
+      if(tablebase.probe(position, &points)) {
+        EXPECT_TRUE(builder.contains(position));
+        EXPECT_EQ(points + position.picking_team_points(), solved);
+        hits++;
+      }
+      EXPECT_EQ(tablebase_solver.solve(position).picking_team_points, solved);
+    }
+    EXPECT_GT(hits, 0);
+  }
+  std::remove(path);
+
+  EXPECT_FALSE(learning::Tablebase("no_such_tablebase.tb").is_open());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
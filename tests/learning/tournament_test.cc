@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "learning/tournament.h"
+
+#include <random>
+#include <vector>
+
+TEST(TestTournament, TestPlaySeatedMatchesPlayOut)
+{
+  learning::HeuristicPolicy policy;
+  std::vector<const learning::Policy*> seat_policies(5, &policy);
+  for(unsigned long seed = 1; seed <= 20; seed++) {
+    auto hand = sheepshead::interface::Hand(seed);
+    std::default_random_engine generator(seed);
+    std::vector<int> rewards;
+    std::vector<learning::SeatRole> roles;
+    learning::play_seated(seat_policies, &hand, generator, &rewards, &roles);
+    ASSERT_EQ(5u, rewards.size());
+
+    int total = 0;
+    int pickers = 0;
+    int leasters = 0;
+    for(int seat = 0; seat < 5; seat++) {
+      total += rewards[seat];
+      pickers += roles[seat] == learning::SeatRole::PICKER;
+      leasters += roles[seat] == learning::SeatRole::LEASTERS;
+    }
+    EXPECT_EQ(0, total);
+    EXPECT_TRUE((pickers == 1 && leasters == 0) || (pickers == 0 && leasters == 5));
+
+    for(int seat = 0; seat < 5; seat += 2) {
+      auto other_hand = sheepshead::interface::Hand(seed);
+      std::default_random_engine other_generator(seed);
+      EXPECT_EQ(rewards[seat], policy.play_out(&other_hand, seat, other_generator));
+    }
+  }
+}
+
+TEST(TestTournament, TestIdenticalPoliciesTie)
+{
+  learning::HeuristicPolicy first, second;
+  learning::TournamentConfig config;
+  config.deals = 40;
+  config.number_of_threads = 2;
+  config.bootstrap_samples = 200;
+  config.seed = 5;
+  auto rules = sheepshead::interface::MutableRules().get_rules();
+  auto result = learning::run_tournament(rules, {&first, &second}, config);
+
+  EXPECT_EQ(40 * 2 * 5, result.hands);
+  ASSERT_EQ(2u, result.competitors.size());
+  // Every seating is played with the labels swapped too, so the two split
+  // the same hands.
+  EXPECT_DOUBLE_EQ(0, result.competitors[0].overall.mean);
+  EXPECT_DOUBLE_EQ(0, result.competitors[1].versus_first.mean);
+  EXPECT_EQ(result.competitors[0].overall.hands, result.competitors[1].overall.hands);
+  for(int role = 0; role < learning::NUMBER_OF_SEAT_ROLES; role++) {
+    EXPECT_EQ(result.competitors[0].roles[role].hands, result.competitors[1].roles[role].hands);
+    EXPECT_DOUBLE_EQ(result.competitors[0].roles[role].mean,
+                     result.competitors[1].roles[role].mean);
+  }
+}
+
+TEST(TestTournament, TestHeuristicBeatsRandom)
+{
+  learning::RandomPolicy random;
+  learning::HeuristicPolicy heuristic;
+  learning::TournamentConfig config;
+  config.deals = 60;
+  config.number_of_threads = 1;
+  config.bootstrap_samples = 300;
+  config.seed = 11;
+  auto rules = sheepshead::interface::MutableRules().get_rules();
+  auto result = learning::run_tournament(rules, {&random, &heuristic}, config);
+
+  auto& versus = result.competitors[1].versus_first;
+  EXPECT_GT(versus.lower, 0);
+  EXPECT_LE(versus.lower, versus.mean);
+  EXPECT_LE(versus.mean, versus.upper);
+  auto& picker = result.competitors[1].roles[static_cast<int>(learning::SeatRole::PICKER)];
+  EXPECT_GT(picker.hands, 0);
+  EXPECT_LE(picker.lower, picker.upper);
+
+  // The thread count doesn't change the result.
+  config.number_of_threads = 3;
+  auto threaded = learning::run_tournament(rules, {&random, &heuristic}, config);
+  EXPECT_DOUBLE_EQ(versus.mean, threaded.competitors[1].versus_first.mean);
+  EXPECT_DOUBLE_EQ(versus.lower, threaded.competitors[1].versus_first.lower);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "learning/transposition_table.h"
+
+using learning::Bound;
+using learning::TranspositionEntry;
+using learning::TranspositionTable;
+
+TEST(TestTranspositionTable, TestStoreAndProbe)
+{
+  auto table = TranspositionTable(1);
+  EXPECT_EQ(table.capacity(), (1u << 20) / sizeof(TranspositionEntry));
+
+  TranspositionEntry entry;
+  EXPECT_FALSE(table.probe(12345, &entry));
+
+  table.store(12345, -17, Bound::LOWER, 9, 21);
+  ASSERT_TRUE(table.probe(12345, &entry));
+  EXPECT_EQ(entry.value, -17);
+  EXPECT_EQ(entry.bound, Bound::LOWER);
+  EXPECT_EQ(entry.depth, 9);
+  EXPECT_EQ(entry.best_move, 21);
+
+  table.clear();
+  EXPECT_FALSE(table.probe(12345, &entry));
+}
+
+TEST(TestTranspositionTable, TestDepthPreferredReplacement)
+{
+  auto table = TranspositionTable(1);
+  uint64_t stride = table.capacity() / TranspositionTable::ENTRIES_PER_BUCKET;
+
+  // Fill one bucket, then store one more key that lands in it
+  for(int i = 0; i < TranspositionTable::ENTRIES_PER_BUCKET; i++) {
+    table.store(1 + i * stride, i, Bound::EXACT, 10 + i, -1);
+  }
+  table.store(1 + 99 * stride, 0, Bound::EXACT, 20, -1);
+
+  TranspositionEntry entry;
+  EXPECT_FALSE(table.probe(1, &entry));
+  EXPECT_TRUE(table.probe(1 + 99 * stride, &entry));
+  for(int i = 1; i < TranspositionTable::ENTRIES_PER_BUCKET; i++) {
+    EXPECT_TRUE(table.probe(1 + i * stride, &entry));
+  }
+
+  // A shallower result for the same position doesn't replace a deeper one
+  table.store(1 + stride, 50, Bound::EXACT, 2, -1);
+  ASSERT_TRUE(table.probe(1 + stride, &entry));
+  EXPECT_EQ(entry.value, 1);
+
+  // Entries from an earlier search go before shallower ones from this search
+  table.new_search();
+  for(int i = 0; i < TranspositionTable::ENTRIES_PER_BUCKET; i++) {
+    table.store(1 + (100 + i) * stride, 0, Bound::EXACT, 0, -1);
+  }
+  for(int i = 0; i < TranspositionTable::ENTRIES_PER_BUCKET; i++) {
+    EXPECT_TRUE(table.probe(1 + (100 + i) * stride, &entry));
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "learning/determinization.h"
+#include "learning/trick_position.h"
+#include "sheepshead/interface/hand.h"
+
+#include <random>
+
+using sheepshead::interface::Hand;
+using sheepshead::interface::Play;
+
+namespace {
+
+learning::CardMask available_card_mask(const Hand& hand)
+{
+  learning::CardMask cards = 0;
+  for(auto& play : hand.available_plays(hand.current_player())) {
+    cards |= learning::card_bit(learning::card_index(*play.trick_card_decision()));
+  }
+  return cards;
+}
+
+// Play a hand at random, checking that a TrickPosition kept up to date with
+// make_move agrees with the interface at every trick decision.
+void check_random_hand(Hand hand, unsigned long seed)
+{
+  std::default_random_engine generator(seed);
+  learning::TrickPosition position;
+  bool have_position = false;
+
+  while(!hand.is_finished()) {
+    if(hand.is_arbitrable()) {
+      hand.arbiter().arbitrate();
+      continue;
+    }
+
+    auto current_player = hand.current_player();
+    auto available_plays = hand.available_plays(current_player);
+    std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+    auto play = available_plays[distribution(generator)];
+
+    if(play.play_type() == Play::PlayType::TRICK_CARD) {
+      if(!have_position) {
+        position = learning::TrickPosition(hand);
+        have_position = true;
+      }
+      ASSERT_EQ(position.to_play(), learning::seat_index(hand, current_player));
+      ASSERT_EQ(position.legal_moves(), available_card_mask(hand));
+
+      // Making and unmaking every legal move leaves the position unchanged
+      auto rebuilt = learning::TrickPosition(hand);
+      for(learning::CardMask moves = position.legal_moves(); moves; moves &= moves - 1) {
+        position.make_move(learning::mask_first(moves));
+        position.unmake_move();
+        ASSERT_EQ(position.legal_moves(), rebuilt.legal_moves());
+        ASSERT_EQ(position.leader(), rebuilt.leader());
+        ASSERT_EQ(position.picking_team_points(), rebuilt.picking_team_points());
+        ASSERT_EQ(position.key(), rebuilt.key());
+      }
+      ASSERT_EQ(position.cards_key(), rebuilt.cards_key());
+
+      // Merging equivalent moves keeps at least one card of each effective
+      // suit and point value
+      learning::CardMask legal = position.legal_moves();
+      learning::CardMask distinct = position.distinct_moves(legal);
+      ASSERT_EQ(distinct & ~legal, 0u);
+      for(learning::CardMask moves = legal; moves; moves &= moves - 1) {
+        int card = learning::mask_first(moves);
+        bool represented = false;
+        for(learning::CardMask kept = distinct; kept; kept &= kept - 1) {
+          int other = learning::mask_first(kept);
+          represented |= position.effective_suit(other) == position.effective_suit(card) &&
+                         learning::card_point_value(other) == learning::card_point_value(card);
+        }
+        ASSERT_TRUE(represented);
+      }
+
+      position.make_move(learning::card_index(*play.trick_card_decision()));
+    }
+    hand.playmaker(current_player).make_play(play);
+  }
+
+  if(!have_position) return;
+  ASSERT_TRUE(position.is_finished());
+  for(int seat = 0; seat < hand.rules().number_of_players(); seat++) {
+    EXPECT_EQ(position.reward(seat), hand.reward(learning::player_at_seat(hand, seat)));
+  }
+}
+
+} // namespace
+
+TEST(TestTrickPosition, TestDefaultRules)
+{
+  for(unsigned long seed = 1; seed < 200; seed++) {
+    check_random_hand(Hand(seed), seed);
+  }
+}
+
+TEST(TestTrickPosition, TestJackOfDiamondsAndClubsTrump)
+{
+  auto rules = sheepshead::interface::MutableRules();
+  rules.set_partner_by_jack_of_diamonds();
+  rules.set_trump_is_clubs();
+  for(unsigned long seed = 1; seed < 100; seed++) {
+    check_random_hand(Hand(rules.get_rules(), seed), seed);
+  }
+}
+
+TEST(TestTrickPosition, TestFewerPlayers)
+{
+  for(int players = 3; players <= 4; players++) {
+    auto rules = sheepshead::interface::MutableRules();
+    rules.set_number_of_players(players);
+    for(unsigned long seed = 1; seed < 100; seed++) {
+      check_random_hand(Hand(rules.get_rules(), seed), seed);
+    }
+  }
+}
+
+TEST(TestDeterminizer, TestSamplesAreConsistent)
+{
+  std::default_random_engine generator(17);
+  for(unsigned long seed = 1; seed < 50; seed++) {
+    auto hand = Hand(seed);
+    while(!hand.is_finished()) {
+      if(hand.is_arbitrable()) {
+        hand.arbiter().arbitrate();
+        continue;
+      }
+      auto current_player = hand.current_player();
+      auto available_plays = hand.available_plays(current_player);
+      if(available_plays[0].play_type() == Play::PlayType::TRICK_CARD) {
+        auto truth = learning::TrickPosition(hand);
+        auto determinizer = learning::Determinizer(hand, current_player);
+        auto sample = determinizer.sample(generator);
+
+        int observer = determinizer.observer();
+        EXPECT_EQ(sample.held_cards(observer), truth.held_cards(observer));
+        EXPECT_EQ(sample.legal_moves(), truth.legal_moves());
+        learning::CardMask all_cards = sample.played_cards() | sample.discarded_cards();
+        for(int seat = 0; seat < truth.number_of_players(); seat++) {
+          EXPECT_EQ(learning::mask_size(sample.held_cards(seat)),
+                    learning::mask_size(truth.held_cards(seat)));
+          EXPECT_EQ(all_cards & sample.held_cards(seat), 0u);
+          all_cards |= sample.held_cards(seat);
+        }
+        if(truth.picker() >= 0 && truth.partner_card() != learning::NO_CARD) {
+          EXPECT_NE(sample.partner(), sample.picker());
+        }
+      }
+      std::uniform_int_distribution<int> distribution(0, available_plays.size() - 1);
+      hand.playmaker(current_player).make_play(available_plays[distribution(generator)]);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  auto results = RUN_ALL_TESTS();
+  google::protobuf::ShutdownProtobufLibrary();
+  return results;
+}